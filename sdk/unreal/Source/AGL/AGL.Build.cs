@@ -35,7 +35,7 @@ public class AGL : ModuleRules
         PrivateDependencyModuleNames.AddRange(
             new string[]
             {
-                // ... add private dependencies that you statically link with here ...
+                "WebSockets"
             }
         );
 
@@ -0,0 +1,131 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLCallbackDispatcher.h"
+#include "HAL/PlatformTime.h"
+
+void UAGLCallbackDispatcher::Initialize(float InFrameBudgetMs)
+{
+    FrameBudgetMs = FMath::Max(0.1f, InFrameBudgetMs);
+
+    DrainTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UAGLCallbackDispatcher::TickDrain),
+        0.0f
+    );
+
+    UE_LOG(LogTemp, Log, TEXT("AGLCallbackDispatcher initialized (budget=%.1fms/frame)"), FrameBudgetMs);
+}
+
+void UAGLCallbackDispatcher::Shutdown()
+{
+    if (DrainTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(DrainTickerHandle);
+        DrainTickerHandle.Reset();
+    }
+
+    // Flush rather than drop: a queued callback may be the only signal a
+    // caller ever gets for its request
+    for (FLane& Lane : Lanes)
+    {
+        DrainLane(Lane);
+    }
+}
+
+void UAGLCallbackDispatcher::Dispatch(EAGLCallbackLane Lane, TFunction<void()>&& Work, bool bBypassBudget)
+{
+    FLane& Queue = Lanes[static_cast<int32>(Lane)];
+
+    if (bBypassBudget)
+    {
+        // Earlier responses for this service run first so per-service
+        // ordering holds even on the priority path
+        DrainLane(Queue);
+        Work();
+        DispatchedCount++;
+        return;
+    }
+
+    Queue.Items.Add(MoveTemp(Work));
+}
+
+int32 UAGLCallbackDispatcher::GetPendingCount() const
+{
+    int32 Pending = 0;
+    for (const FLane& Lane : Lanes)
+    {
+        Pending += Lane.Items.Num() - Lane.Head;
+    }
+    return Pending;
+}
+
+bool UAGLCallbackDispatcher::TickDrain(float DeltaTime)
+{
+    const double StartSeconds = FPlatformTime::Seconds();
+    const double BudgetSeconds = FrameBudgetMs / 1000.0;
+    constexpr int32 LaneCount = static_cast<int32>(EAGLCallbackLane::Count);
+
+    // Always run at least one item so the queue drains even when a single
+    // callback overruns the budget
+    bool bExecutedAny = false;
+
+    while (true)
+    {
+        FLane* Lane = nullptr;
+        for (int32 Offset = 0; Offset < LaneCount; Offset++)
+        {
+            const int32 LaneIndex = (NextLane + Offset) % LaneCount;
+            if (Lanes[LaneIndex].Head < Lanes[LaneIndex].Items.Num())
+            {
+                Lane = &Lanes[LaneIndex];
+                NextLane = (LaneIndex + 1) % LaneCount;
+                break;
+            }
+        }
+
+        if (!Lane)
+        {
+            break;
+        }
+
+        if (bExecutedAny && (FPlatformTime::Seconds() - StartSeconds) >= BudgetSeconds)
+        {
+            break;
+        }
+
+        TFunction<void()> Work = MoveTemp(Lane->Items[Lane->Head]);
+        Lane->Head++;
+        if (Lane->Head >= Lane->Items.Num())
+        {
+            Lane->Items.Reset();
+            Lane->Head = 0;
+        }
+
+        Work();
+        DispatchedCount++;
+        bExecutedAny = true;
+    }
+
+    return true;
+}
+
+void UAGLCallbackDispatcher::DrainLane(FLane& Lane)
+{
+    // A callback may queue more work into the same lane; the loop picks
+    // those up because Items grows behind Head
+    while (Lane.Head < Lane.Items.Num())
+    {
+        TFunction<void()> Work = MoveTemp(Lane.Items[Lane.Head]);
+        Lane.Head++;
+        Work();
+        DispatchedCount++;
+    }
+
+    Lane.Items.Reset();
+    Lane.Head = 0;
+}
+
+void UAGLCallbackDispatcher::BeginDestroy()
+{
+    Shutdown();
+    Super::BeginDestroy();
+}
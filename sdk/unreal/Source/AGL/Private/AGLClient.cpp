@@ -16,27 +16,130 @@ void UAGLClient::Initialize(const FAGLConfig& InConfig)
         return;
     }
 
+    // Create shared connection pool and pre-warm one connection per service
+    ConnectionPool = NewObject<UAGLConnectionPool>(this);
+    ConnectionPool->Initialize(Config.ConnectionPoolSize, Config.ConnectionIdleTimeout);
+    ConnectionPool->WarmUp(Config.EmotionServiceUrl);
+    ConnectionPool->WarmUp(Config.DialogueServiceUrl);
+    ConnectionPool->WarmUp(Config.MemoryServiceUrl);
+
     // Create service instances
     EmotionService = NewObject<UAGLEmotionService>(this);
     EmotionService->Initialize(
         Config.EmotionServiceUrl,
         Config.ApiKey,
-        Config.Timeout
+        Config.Timeout,
+        ConnectionPool
     );
+    EmotionService->ConfigureLocalRules(Config.bUseLocalRuleEngine, Config.LocalRuleConfidenceThreshold);
 
     DialogueService = NewObject<UAGLDialogueService>(this);
     DialogueService->Initialize(
         Config.DialogueServiceUrl,
         Config.ApiKey,
-        Config.Timeout
+        Config.Timeout,
+        ConnectionPool
     );
+    if (!Config.DialogueTemplatePackPath.IsEmpty())
+    {
+        DialogueService->LoadTemplatePack(Config.DialogueTemplatePackPath, Config.bUseLocalTemplates);
+    }
+    DialogueService->ConfigureResponseCache(Config.bUseDialogueCache, Config.DialogueCacheTTL, Config.DialogueCacheMaxEntries);
+    DialogueService->ConfigureRaceMode(Config.bUseDialogueRace, Config.DialogueRaceUpgradeWindow);
 
     MemoryService = NewObject<UAGLMemoryService>(this);
     MemoryService->Initialize(
         Config.MemoryServiceUrl,
         Config.ApiKey,
-        Config.Timeout
+        Config.Timeout,
+        ConnectionPool
     );
+    MemoryService->ConfigureContextCache(Config.bUseContextPrefetch, Config.ContextCacheTTL, Config.ContextPrefetchLimit);
+
+    // Create event batcher on top of the emotion service
+    EventBatcher = NewObject<UAGLEventBatcher>(this);
+    EventBatcher->Initialize(EmotionService, Config.EventBatchSize, Config.EventBatchFlushInterval);
+
+    // Write-behind queue collapses individual memory POSTs into bulk
+    // uploads; CreateMemory routes through it when enabled
+    if (Config.bUseMemoryWriteQueue)
+    {
+        MemoryWriteQueue = NewObject<UAGLMemoryWriteQueue>(this);
+        MemoryWriteQueue->Initialize(MemoryService, Config.MemoryWriteBatchSize, Config.MemoryWriteFlushInterval, Config.MemoryWriteMaxRetries);
+        MemoryService->SetWriteQueue(MemoryWriteQueue);
+    }
+
+    // Optionally multiplex service traffic over one persistent WebSocket
+    // to the realtime gateway; services fall back to HTTP when it drops
+    if (Config.bUseWebSocketTransport)
+    {
+        RealtimeTransport = NewObject<UAGLRealtimeTransport>(this);
+        RealtimeTransport->Initialize(Config.RealtimeGatewayUrl, Config.ApiKey, Config.Timeout);
+        RealtimeTransport->Connect();
+
+        EmotionService->SetRealtimeTransport(RealtimeTransport);
+        DialogueService->SetRealtimeTransport(RealtimeTransport);
+        MemoryService->SetRealtimeTransport(RealtimeTransport);
+    }
+
+    // Optionally encode HTTP payloads as MessagePack; the backend picks
+    // the codec from the Content-Type header
+    if (Config.bUseBinaryEncoding)
+    {
+        EmotionService->SetBinaryEncoding(true);
+        DialogueService->SetBinaryEncoding(true);
+        MemoryService->SetBinaryEncoding(true);
+    }
+
+    // Negotiate gzip on service traffic; large memory and context
+    // responses inflate off the game thread
+    if (Config.bUseCompression)
+    {
+        EmotionService->SetCompression(true, Config.bCompressRequestBodies, Config.CompressionMinRequestBytes);
+        DialogueService->SetCompression(true, Config.bCompressRequestBodies, Config.CompressionMinRequestBytes);
+        MemoryService->SetCompression(true, Config.bCompressRequestBodies, Config.CompressionMinRequestBytes);
+    }
+
+    // Scheduler coalesces identical in-flight requests across companion
+    // actors and queues background memory writes under burst load
+    if (Config.bUseRequestScheduler)
+    {
+        RequestScheduler = NewObject<UAGLRequestScheduler>(this);
+        RequestScheduler->Initialize(Config.MaxConcurrentRequests);
+
+        EmotionService->SetRequestScheduler(RequestScheduler);
+        DialogueService->SetRequestScheduler(RequestScheduler);
+        MemoryService->SetRequestScheduler(RequestScheduler);
+
+        if (MemoryWriteQueue)
+        {
+            MemoryWriteQueue->SetRequestScheduler(RequestScheduler);
+        }
+    }
+
+    // Journal transport-failed requests to disk and replay them through
+    // the services once connectivity returns
+    if (Config.bUseOfflineJournal)
+    {
+        OfflineJournal = NewObject<UAGLOfflineJournal>(this);
+        OfflineJournal->Initialize(EmotionService, DialogueService, MemoryService, Config.OfflineJournalMaxBytes, Config.OfflineReplayInterval);
+
+        EmotionService->SetOfflineJournal(OfflineJournal);
+        DialogueService->SetOfflineJournal(OfflineJournal);
+        MemoryService->SetOfflineJournal(OfflineJournal);
+    }
+
+    // Drain completed-response callbacks under a per-frame time budget
+    // so a response burst spreads across frames instead of hitching one
+    if (Config.bUseCallbackDispatcher)
+    {
+        CallbackDispatcher = NewObject<UAGLCallbackDispatcher>(this);
+        CallbackDispatcher->Initialize(Config.CallbackBudgetMs);
+
+        EmotionService->SetCallbackDispatcher(CallbackDispatcher);
+        DialogueService->SetCallbackDispatcher(CallbackDispatcher);
+        MemoryService->SetCallbackDispatcher(CallbackDispatcher);
+    }
 
     bInitialized = true;
 
@@ -47,6 +150,30 @@ void UAGLClient::SetPlayerId(const FString& InPlayerId)
 {
     PlayerId = InPlayerId;
     UE_LOG(LogTemp, Log, TEXT("AGLClient: Set player ID to %s"), *PlayerId);
+
+    // Warm the memory context cache for the new player's common event
+    // types so the session's first dialogue skips the context round trip
+    if (bInitialized && Config.bUseContextPrefetch && MemoryService)
+    {
+        MemoryService->PrefetchContext(PlayerId, Config.ContextPrefetchEvents);
+    }
+}
+
+void UAGLClient::NotifySessionEnd()
+{
+    // Session end is the last reliable moment to get queued traffic out
+    // before the player quits or the platform suspends the process
+    if (EventBatcher)
+    {
+        EventBatcher->Flush();
+    }
+
+    if (MemoryWriteQueue)
+    {
+        MemoryWriteQueue->Flush();
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("AGLClient: Session end, flushed batched traffic"));
 }
 
 void UAGLClient::SetGameId(const FString& InGameId)
@@ -0,0 +1,75 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLCompression.h"
+#include "Misc/Compression.h"
+
+namespace
+{
+    // Gzip streams are at least a 10-byte header plus an 8-byte trailer
+    constexpr int32 MinGzipStreamBytes = 18;
+
+    // Refuse trailer sizes beyond this; memory payloads are far smaller
+    // and a corrupt length field must not trigger a huge allocation
+    constexpr uint32 MaxInflatedBytes = 64 * 1024 * 1024;
+}
+
+const TCHAR* FAGLCompression::ContentEncoding = TEXT("gzip");
+
+bool FAGLCompression::Compress(const TArray<uint8>& Plain, TArray<uint8>& OutCompressed)
+{
+    if (Plain.Num() == 0)
+    {
+        OutCompressed.Reset();
+        return false;
+    }
+
+    int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Gzip, Plain.Num());
+    OutCompressed.SetNumUninitialized(CompressedSize, /*bAllowShrinking*/ false);
+
+    if (!FCompression::CompressMemory(NAME_Gzip, OutCompressed.GetData(), CompressedSize, Plain.GetData(), Plain.Num()))
+    {
+        return false;
+    }
+
+    OutCompressed.SetNum(CompressedSize, /*bAllowShrinking*/ false);
+    return true;
+}
+
+bool FAGLCompression::Decompress(const TArray<uint8>& Compressed, TArray<uint8>& OutPlain)
+{
+    if (Compressed.Num() < MinGzipStreamBytes)
+    {
+        return false;
+    }
+
+    // The gzip trailer stores the inflated size (mod 2^32) little-endian
+    // in the last four bytes
+    const uint8* Trailer = Compressed.GetData() + Compressed.Num() - 4;
+    const uint32 InflatedSize =
+        static_cast<uint32>(Trailer[0]) |
+        (static_cast<uint32>(Trailer[1]) << 8) |
+        (static_cast<uint32>(Trailer[2]) << 16) |
+        (static_cast<uint32>(Trailer[3]) << 24);
+
+    if (InflatedSize == 0 || InflatedSize > MaxInflatedBytes)
+    {
+        return false;
+    }
+
+    OutPlain.SetNumUninitialized(static_cast<int32>(InflatedSize), /*bAllowShrinking*/ false);
+
+    return FCompression::UncompressMemory(NAME_Gzip, OutPlain.GetData(), OutPlain.Num(), Compressed.GetData(), Compressed.Num());
+}
+
+FString FAGLCompression::BytesToString(const TArray<uint8>& Utf8Bytes)
+{
+    FUTF8ToTCHAR Converter(reinterpret_cast<const ANSICHAR*>(Utf8Bytes.GetData()), Utf8Bytes.Num());
+    return FString(Converter.Length(), Converter.Get());
+}
+
+void FAGLCompression::StringToBytes(const FString& Text, TArray<uint8>& OutUtf8Bytes)
+{
+    FTCHARToUTF8 Converter(*Text, Text.Len());
+    OutUtf8Bytes.Reset();
+    OutUtf8Bytes.Append(reinterpret_cast<const uint8*>(Converter.Get()), Converter.Length());
+}
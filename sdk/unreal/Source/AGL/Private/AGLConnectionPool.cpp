@@ -0,0 +1,133 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLConnectionPool.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+
+void UAGLConnectionPool::Initialize(int32 InPoolSize, float InIdleTimeout)
+{
+    PoolSize = FMath::Max(1, InPoolSize);
+    IdleTimeout = FMath::Max(1.0f, InIdleTimeout);
+
+    // Evict idle connections on a fraction of the timeout so eviction
+    // latency stays bounded without ticking every frame
+    EvictionTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UAGLConnectionPool::TickEviction),
+        IdleTimeout * 0.25f
+    );
+
+    UE_LOG(LogTemp, Log, TEXT("AGLConnectionPool initialized (size=%d, idle timeout=%.1fs)"), PoolSize, IdleTimeout);
+}
+
+void UAGLConnectionPool::Shutdown()
+{
+    if (EvictionTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(EvictionTickerHandle);
+        EvictionTickerHandle.Reset();
+    }
+
+    FScopeLock Lock(&PoolLock);
+    IdleConnections.Empty();
+}
+
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UAGLConnectionPool::AcquireRequest(const FString& ServiceUrl)
+{
+    {
+        FScopeLock Lock(&PoolLock);
+
+        TArray<FPooledConnection>* Pool = IdleConnections.Find(ServiceUrl);
+        if (Pool && Pool->Num() > 0)
+        {
+            // Most recently used connection is least likely to have been
+            // closed by the server, so pop from the back
+            FPooledConnection Connection = Pool->Pop();
+            if (Connection.Request.IsValid())
+            {
+                return Connection.Request.ToSharedRef();
+            }
+        }
+    }
+
+    // Pool empty: create a fresh request. The connection it opens will be
+    // returned to the pool on release.
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+    Request->SetHeader(TEXT("Connection"), TEXT("keep-alive"));
+    return Request;
+}
+
+void UAGLConnectionPool::ReleaseRequest(const FString& ServiceUrl, const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request)
+{
+    // Detach completion state so a pooled request cannot fire a stale callback
+    Request->OnProcessRequestComplete().Unbind();
+
+    FScopeLock Lock(&PoolLock);
+
+    TArray<FPooledConnection>& Pool = IdleConnections.FindOrAdd(ServiceUrl);
+    if (Pool.Num() >= PoolSize)
+    {
+        // Pool full: let the connection close
+        return;
+    }
+
+    FPooledConnection Connection;
+    Connection.Request = Request;
+    Connection.LastUsedTime = FPlatformTime::Seconds();
+    Pool.Add(MoveTemp(Connection));
+}
+
+void UAGLConnectionPool::WarmUp(const FString& ServiceUrl)
+{
+    // Issue a lightweight HEAD request so the TCP+TLS handshake happens at
+    // startup instead of on the first real service call
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> Request = FHttpModule::Get().CreateRequest();
+    Request->SetURL(ServiceUrl + TEXT("/health"));
+    Request->SetVerb(TEXT("HEAD"));
+    Request->SetHeader(TEXT("Connection"), TEXT("keep-alive"));
+
+    TWeakObjectPtr<UAGLConnectionPool> WeakThis(this);
+    Request->OnProcessRequestComplete().BindLambda(
+        [WeakThis, ServiceUrl](FHttpRequestPtr CompletedRequest, FHttpResponsePtr Response, bool bWasSuccessful)
+        {
+            if (WeakThis.IsValid() && bWasSuccessful && CompletedRequest.IsValid())
+            {
+                WeakThis->ReleaseRequest(ServiceUrl, CompletedRequest.ToSharedRef());
+            }
+        }
+    );
+
+    Request->ProcessRequest();
+
+    UE_LOG(LogTemp, Log, TEXT("AGLConnectionPool: Warming up connection to %s"), *ServiceUrl);
+}
+
+int32 UAGLConnectionPool::GetIdleCount(const FString& ServiceUrl) const
+{
+    FScopeLock Lock(&PoolLock);
+
+    const TArray<FPooledConnection>* Pool = IdleConnections.Find(ServiceUrl);
+    return Pool ? Pool->Num() : 0;
+}
+
+bool UAGLConnectionPool::TickEviction(float DeltaTime)
+{
+    const double Now = FPlatformTime::Seconds();
+
+    FScopeLock Lock(&PoolLock);
+
+    for (auto& Pair : IdleConnections)
+    {
+        Pair.Value.RemoveAll([this, Now](const FPooledConnection& Connection)
+        {
+            return (Now - Connection.LastUsedTime) > IdleTimeout;
+        });
+    }
+
+    return true;
+}
+
+void UAGLConnectionPool::BeginDestroy()
+{
+    Shutdown();
+    Super::BeginDestroy();
+}
@@ -0,0 +1,89 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLContextCache.h"
+
+void FAGLContextCache::Configure(float InTTLSeconds, int32 InMaxMemoriesPerEntry)
+{
+    TTLSeconds = FMath::Max(1.0f, InTTLSeconds);
+    MaxMemoriesPerEntry = FMath::Max(1, InMaxMemoriesPerEntry);
+}
+
+void FAGLContextCache::SetPlayer(const FString& InPlayerId)
+{
+    if (PlayerId != InPlayerId)
+    {
+        Entries.Empty();
+        PlayerId = InPlayerId;
+    }
+}
+
+bool FAGLContextCache::TryGet(const FString& ForPlayerId, const FString& EventType, TArray<FAGLMemory>& OutMemories)
+{
+    if (ForPlayerId != PlayerId)
+    {
+        ++MissCount;
+        return false;
+    }
+
+    FCacheEntry* Entry = Entries.Find(EventType);
+    if (!Entry)
+    {
+        ++MissCount;
+        return false;
+    }
+
+    if ((FPlatformTime::Seconds() - Entry->InsertTime) > TTLSeconds)
+    {
+        Entries.Remove(EventType);
+        ++MissCount;
+        return false;
+    }
+
+    OutMemories = Entry->Memories;
+    ++HitCount;
+    return true;
+}
+
+void FAGLContextCache::Put(const FString& ForPlayerId, const FString& EventType, const TArray<FAGLMemory>& Memories)
+{
+    // Drop responses that arrive after the player switched; the entry
+    // would describe the wrong session
+    if (ForPlayerId != PlayerId || EventType.IsEmpty())
+    {
+        return;
+    }
+
+    FCacheEntry& Entry = Entries.FindOrAdd(EventType);
+    Entry.Memories = Memories;
+    if (Entry.Memories.Num() > MaxMemoriesPerEntry)
+    {
+        Entry.Memories.SetNum(MaxMemoriesPerEntry, /*bAllowShrinking*/ false);
+    }
+    Entry.InsertTime = FPlatformTime::Seconds();
+}
+
+void FAGLContextCache::AddMemory(const FString& ForPlayerId, const FAGLMemory& Memory)
+{
+    if (ForPlayerId != PlayerId)
+    {
+        return;
+    }
+
+    // The backend returns newest-relevant first; prepend so served
+    // context surfaces the fresh memory immediately
+    for (auto& Pair : Entries)
+    {
+        Pair.Value.Memories.Insert(Memory, 0);
+        if (Pair.Value.Memories.Num() > MaxMemoriesPerEntry)
+        {
+            Pair.Value.Memories.SetNum(MaxMemoriesPerEntry, /*bAllowShrinking*/ false);
+        }
+    }
+}
+
+void FAGLContextCache::Reset()
+{
+    Entries.Empty();
+    HitCount = 0;
+    MissCount = 0;
+}
@@ -0,0 +1,93 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLDialogueCache.h"
+
+void FAGLDialogueCache::Configure(int32 InMaxEntries, float InTTLSeconds)
+{
+    MaxEntries = FMath::Max(1, InMaxEntries);
+    TTLSeconds = FMath::Max(1.0f, InTTLSeconds);
+
+    while (Entries.Num() > MaxEntries)
+    {
+        EvictOldest();
+    }
+}
+
+uint32 FAGLDialogueCache::ComputeKey(const FAGLDialogueRequest& Request)
+{
+    uint32 Hash = HashCombine(GetTypeHash(static_cast<uint8>(Request.EventType)), GetTypeHash(static_cast<uint8>(Request.Emotion)));
+    Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Request.Persona)));
+    Hash = HashCombine(Hash, GetTypeHash(Request.Language));
+
+    // The store's hash is order-independent, so context built in any
+    // insertion order keys identically
+    return HashCombine(Hash, Request.Context.ComputeHash());
+}
+
+bool FAGLDialogueCache::TryGet(uint32 Key, FAGLDialogueResponse& OutResponse)
+{
+    FCacheEntry* Entry = Entries.Find(Key);
+    if (!Entry)
+    {
+        ++MissCount;
+        return false;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    if ((Now - Entry->InsertTime) > TTLSeconds)
+    {
+        Entries.Remove(Key);
+        ++MissCount;
+        return false;
+    }
+
+    Entry->LastAccessTime = Now;
+    OutResponse = Entry->Response;
+    OutResponse.bCacheHit = true;
+    OutResponse.LatencyMs = 0;
+    ++HitCount;
+    return true;
+}
+
+void FAGLDialogueCache::Put(uint32 Key, const FAGLDialogueResponse& Response)
+{
+    if (Entries.Num() >= MaxEntries && !Entries.Contains(Key))
+    {
+        EvictOldest();
+    }
+
+    const double Now = FPlatformTime::Seconds();
+
+    FCacheEntry& Entry = Entries.FindOrAdd(Key);
+    Entry.Response = Response;
+    Entry.InsertTime = Now;
+    Entry.LastAccessTime = Now;
+}
+
+void FAGLDialogueCache::Reset()
+{
+    Entries.Empty();
+    HitCount = 0;
+    MissCount = 0;
+}
+
+void FAGLDialogueCache::EvictOldest()
+{
+    // Entry caps are small (hundreds), so a linear scan beats the
+    // bookkeeping cost of an intrusive LRU list
+    uint32 OldestKey = 0;
+    double OldestAccess = TNumericLimits<double>::Max();
+    for (const auto& Pair : Entries)
+    {
+        if (Pair.Value.LastAccessTime < OldestAccess)
+        {
+            OldestAccess = Pair.Value.LastAccessTime;
+            OldestKey = Pair.Key;
+        }
+    }
+
+    if (Entries.Num() > 0)
+    {
+        Entries.Remove(OldestKey);
+    }
+}
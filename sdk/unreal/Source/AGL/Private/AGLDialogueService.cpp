@@ -1,40 +1,267 @@
 // Copyright AGL Team. All Rights Reserved.
 
 #include "AGLDialogueService.h"
+#include "AGLConnectionPool.h"
+#include "AGLJsonReader.h"
+#include "AGLJsonWriter.h"
+#include "AGLMessagePack.h"
+#include "AGLMetrics.h"
+#include "AGLRealtimeTransport.h"
+#include "AGLRequestScheduler.h"
+#include "AGLOfflineJournal.h"
+#include "AGLCallbackDispatcher.h"
+#include "AGLCompression.h"
+#include "AGLWireNames.h"
+#include "Async/Async.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Json.h"
 #include "JsonUtilities.h"
 
-void UAGLDialogueService::Initialize(const FString& InServiceUrl, const FString& InApiKey, float InTimeout)
+void UAGLDialogueService::Initialize(const FString& InServiceUrl, const FString& InApiKey, float InTimeout, UAGLConnectionPool* InConnectionPool)
 {
     ServiceUrl = InServiceUrl;
     ApiKey = InApiKey;
     Timeout = InTimeout;
+    ConnectionPool = InConnectionPool;
 
     UE_LOG(LogTemp, Log, TEXT("AGLDialogueService initialized with URL: %s"), *ServiceUrl);
 }
 
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UAGLDialogueService::CreateHttpRequest()
+{
+    return ConnectionPool ? ConnectionPool->AcquireRequest(ServiceUrl) : FHttpModule::Get().CreateRequest();
+}
+
+void UAGLDialogueService::ReleaseHttpRequest(FHttpRequestPtr Request)
+{
+    if (ConnectionPool && Request.IsValid())
+    {
+        ConnectionPool->ReleaseRequest(ServiceUrl, Request.ToSharedRef());
+    }
+}
+
+bool UAGLDialogueService::LoadTemplatePack(const FString& PackFilePath, bool bInUseLocalTemplates)
+{
+    bUseLocalTemplates = bInUseLocalTemplates;
+    return TemplateLibrary.LoadPack(PackFilePath);
+}
+
+void UAGLDialogueService::ConfigureResponseCache(bool bInUseCache, float InTTLSeconds, int32 InMaxEntries)
+{
+    bUseResponseCache = bInUseCache;
+    ResponseCache.Configure(InMaxEntries, InTTLSeconds);
+}
+
+void UAGLDialogueService::ConfigureRaceMode(bool bInUseRaceMode, float InUpgradeWindowSeconds)
+{
+    bUseDialogueRace = bInUseRaceMode;
+    RaceUpgradeWindowSeconds = FMath::Max(0.0f, InUpgradeWindowSeconds);
+}
+
+void UAGLDialogueService::SetRealtimeTransport(UAGLRealtimeTransport* InTransport)
+{
+    RealtimeTransport = InTransport;
+}
+
+void UAGLDialogueService::SetBinaryEncoding(bool bInUseBinaryEncoding)
+{
+    bUseBinaryEncoding = bInUseBinaryEncoding;
+}
+
+void UAGLDialogueService::SetRequestScheduler(UAGLRequestScheduler* InScheduler)
+{
+    RequestScheduler = InScheduler;
+}
+
+void UAGLDialogueService::SetOfflineJournal(UAGLOfflineJournal* InJournal)
+{
+    OfflineJournal = InJournal;
+}
+
+void UAGLDialogueService::SetCompression(bool bInUseCompression, bool bInCompressRequestBodies, int32 InMinRequestBytes)
+{
+    bUseCompression = bInUseCompression;
+    bCompressRequestBodies = bInCompressRequestBodies;
+    CompressionMinRequestBytes = FMath::Max(0, InMinRequestBytes);
+}
+
+void UAGLDialogueService::SetCallbackDispatcher(UAGLCallbackDispatcher* InDispatcher)
+{
+    CallbackDispatcher = InDispatcher;
+}
+
 void UAGLDialogueService::GenerateDialogue(const FAGLDialogueRequest& Request, FOnDialogueGenerationComplete OnComplete)
 {
-    // Create HTTP request
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+    // Repeat requests within a session resolve from the in-process cache
+    // without paying the round trip the backend cache still requires
+    const uint32 CacheKey = FAGLDialogueCache::ComputeKey(Request);
+    if (bUseResponseCache && !Request.bForceLLM)
+    {
+        FAGLDialogueResponse CachedResponse;
+        if (ResponseCache.TryGet(CacheKey, CachedResponse))
+        {
+            UE_LOG(LogTemp, Log, TEXT("AGLDialogueService: Served dialogue from response cache"));
+            FAGLMetrics::Get().Record(EAGLMetricService::Dialogue, CachedResponse, /*PayloadBytes*/ 0);
+            OnComplete.ExecuteIfBound(true, CachedResponse);
+            return;
+        }
+    }
+
+    // Serve the 90% template case from the memory-mapped pack; the cloud
+    // becomes the escalation path for forced-LLM and unmatched requests
+    if (bUseLocalTemplates && !Request.bForceLLM && TemplateLibrary.IsLoaded())
+    {
+        FString TemplateDialogue;
+        if (TemplateLibrary.TryGetTemplate(Request.Persona, Request.Emotion, Request.EventType, Request.Language, TemplateDialogue))
+        {
+            FAGLDialogueResponse LocalResponse;
+            LocalResponse.Dialogue = MoveTemp(TemplateDialogue);
+            LocalResponse.Method = TEXT("template");
+            LocalResponse.Cost = 0.0f;
+            LocalResponse.bCacheHit = false;
+            LocalResponse.LatencyMs = 0;
+
+            UE_LOG(LogTemp, Log, TEXT("AGLDialogueService: Served dialogue from local template pack"));
+            FAGLMetrics::Get().Record(EAGLMetricService::Dialogue, LocalResponse, /*PayloadBytes*/ 0);
+            OnComplete.ExecuteIfBound(true, LocalResponse);
+
+            // Race mode: the template already answered within the frame;
+            // escalate to the LLM in parallel and upgrade the line if the
+            // richer, memory-aware response lands while the window is open
+            if (bUseDialogueRace && RaceUpgradeWindowSeconds > 0.0f)
+            {
+                BeginRaceUpgrade(Request, OnComplete, CacheKey);
+            }
+            return;
+        }
+    }
+
+    // Coalesce byte-identical in-flight requests: the first caller sends,
+    // later callers join and share the single response
+    uint32 SchedulerKey = 0;
+    if (RequestScheduler)
+    {
+        SchedulerKey = UAGLRequestScheduler::MakeKey(TEXT("dialogue"), SerializeRequest(Request));
+        if (RequestScheduler->JoinOrBeginDialogue(SchedulerKey, OnComplete))
+        {
+            return;
+        }
+    }
+
+    // Multiplex over the persistent WebSocket when connected; a dropped
+    // or timed-out request retries once over HTTP
+    if (RealtimeTransport && RealtimeTransport->IsConnected())
+    {
+        FString JsonPayload = SerializeRequest(Request);
+        TWeakObjectPtr<UAGLDialogueService> WeakThis(this);
+        const bool bSent = RealtimeTransport->SendRequest(TEXT("dialogue"), TEXT("/generate"), JsonPayload,
+            FOnRealtimeReply::CreateLambda([WeakThis, Request, OnComplete, CacheKey, SchedulerKey](bool bSuccess, const FString& Payload)
+            {
+                if (!WeakThis.IsValid())
+                {
+                    return;
+                }
+
+                if (bSuccess)
+                {
+                    WeakThis->DispatchDialogueResponse(Payload, OnComplete, CacheKey, SchedulerKey);
+                }
+                else
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("AGLDialogueService: Realtime request failed, retrying over HTTP"));
+                    WeakThis->GenerateDialogueOverHttp(Request, OnComplete, CacheKey, SchedulerKey);
+                }
+            }));
+
+        if (bSent)
+        {
+            return;
+        }
+    }
+
+    GenerateDialogueOverHttp(Request, OnComplete, CacheKey, SchedulerKey);
+}
+
+void UAGLDialogueService::BeginRaceUpgrade(const FAGLDialogueRequest& Request, const FOnDialogueGenerationComplete& OnComplete, uint32 CacheKey)
+{
+    const uint32 RaceId = NextRaceId++;
+    if (NextRaceId == 0)
+    {
+        NextRaceId = 1;
+    }
+    PendingRaceDeadlines.Add(RaceId, FPlatformTime::Seconds() + RaceUpgradeWindowSeconds);
+
+    // Force the LLM so the escalation cannot come back as the same
+    // template line the player is already reading
+    FAGLDialogueRequest RaceRequest = Request;
+    RaceRequest.bForceLLM = true;
+
+    // The escalation skips the scheduler: coalescing would fan a single
+    // upgrade out to callers whose windows opened at different times.
+    // The original cache key is kept on purpose, so repeat requests
+    // serve the upgraded line from the cache.
+    GenerateDialogueOverHttp(RaceRequest, OnComplete, CacheKey, /*SchedulerKey*/ 0, RaceId);
+}
+
+void UAGLDialogueService::GenerateDialogueOverHttp(const FAGLDialogueRequest& Request, FOnDialogueGenerationComplete OnComplete, uint32 CacheKey, uint32 SchedulerKey, uint32 RaceId)
+{
+    // Per-request state lives in a pooled context so the completion
+    // handler only captures an index instead of a fresh lambda closure
+    FAGLRequestContext& Context = RequestContextPool.Acquire();
+    Context.DialogueRequest = Request;
+    Context.OnDialogue = OnComplete;
+    Context.CacheKey = CacheKey;
+    Context.SchedulerKey = SchedulerKey;
+    Context.RaceId = RaceId;
+
+    // Create HTTP request (pooled keep-alive connection when available)
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest();
 
     HttpRequest->SetURL(ServiceUrl + TEXT("/generate"));
     HttpRequest->SetVerb(TEXT("POST"));
-    HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
     HttpRequest->SetHeader(TEXT("X-API-Key"), ApiKey);
     HttpRequest->SetTimeout(Timeout);
+    if (bUseCompression)
+    {
+        HttpRequest->SetHeader(TEXT("Accept-Encoding"), FAGLCompression::ContentEncoding);
+    }
 
-    // Serialize request to JSON
-    FString JsonPayload = SerializeRequest(Request);
-    HttpRequest->SetContentAsString(JsonPayload);
+    // Serialize request into the context's reused payload buffers:
+    // MessagePack in binary mode, JSON otherwise
+    if (bUseBinaryEncoding)
+    {
+        FAGLMessagePack::EncodeDialogueRequest(Request, Context.BinaryPayload);
+        HttpRequest->SetHeader(TEXT("Content-Type"), FAGLMessagePack::ContentType);
+        HttpRequest->SetHeader(TEXT("Accept"), FAGLMessagePack::ContentType);
+    }
+    else
+    {
+        Context.StringPayload = SerializeRequest(Request);
+        HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    }
+    Context.ApplyRequestBody(HttpRequest, bUseBinaryEncoding, bCompressRequestBodies, CompressionMinRequestBytes);
 
     // Bind response handler
     HttpRequest->OnProcessRequestComplete().BindLambda(
-        [this, OnComplete](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+        [this, ContextIndex = Context.PoolIndex](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
         {
-            HandleDialogueResponse(Request, Response, bWasSuccessful, OnComplete);
+            FAGLRequestContext& Context = RequestContextPool.Get(ContextIndex);
+            const FOnDialogueGenerationComplete Callback = Context.OnDialogue;
+            const uint32 CacheKey = Context.CacheKey;
+            const uint32 SchedulerKey = Context.SchedulerKey;
+            const uint32 RaceId = Context.RaceId;
+
+            // Transport failure: journal the request for replay once
+            // connectivity returns
+            if ((!bWasSuccessful || !Response.IsValid()) && OfflineJournal)
+            {
+                OfflineJournal->RecordDialogueRequest(Context.DialogueRequest);
+            }
+
+            RequestContextPool.Release(Context);
+
+            HandleDialogueResponse(Request, Response, bWasSuccessful, Callback, CacheKey, SchedulerKey, RaceId);
         }
     );
 
@@ -48,163 +275,391 @@ void UAGLDialogueService::HandleDialogueResponse(
     FHttpRequestPtr Request,
     FHttpResponsePtr Response,
     bool bWasSuccessful,
-    FOnDialogueGenerationComplete Callback)
+    FOnDialogueGenerationComplete Callback,
+    uint32 CacheKey,
+    uint32 SchedulerKey,
+    uint32 RaceId)
 {
+    ReleaseHttpRequest(Request);
+
     if (!bWasSuccessful || !Response.IsValid())
     {
         UE_LOG(LogTemp, Error, TEXT("AGLDialogueService: Request failed"));
+        FAGLMetrics::Get().RecordFailure(EAGLMetricService::Dialogue);
         FAGLDialogueResponse EmptyResponse;
-        Callback.ExecuteIfBound(false, EmptyResponse);
+        FinishDialogueRequest(false, EmptyResponse, Callback, SchedulerKey, RaceId);
         return;
     }
 
     if (Response->GetResponseCode() != 200)
     {
         UE_LOG(LogTemp, Error, TEXT("AGLDialogueService: Server returned error %d"), Response->GetResponseCode());
+        FAGLMetrics::Get().RecordFailure(EAGLMetricService::Dialogue);
         FAGLDialogueResponse EmptyResponse;
-        Callback.ExecuteIfBound(false, EmptyResponse);
+        FinishDialogueRequest(false, EmptyResponse, Callback, SchedulerKey, RaceId);
         return;
     }
 
-    // Parse response
-    FString ResponseContent = Response->GetContentAsString();
-    FAGLDialogueResponse DialogueResponse = DeserializeResponse(ResponseContent);
-
-    UE_LOG(LogTemp, Log, TEXT("AGLDialogueService: Received dialogue: %s (Method: %s)"),
-        *DialogueResponse.Dialogue,
-        *DialogueResponse.Method);
+    // Gzip responses carry raw bytes to the background task, which
+    // inflates them before parsing
+    const bool bGzipped = Response->GetHeader(TEXT("Content-Encoding")).Contains(TEXT("gzip"));
 
-    Callback.ExecuteIfBound(true, DialogueResponse);
+    if (bUseBinaryEncoding && Response->GetContentType().Contains(TEXT("msgpack")))
+    {
+        DispatchDialogueResponseBinary(Response->GetContent(), Callback, CacheKey, SchedulerKey, bGzipped, RaceId);
+    }
+    else if (bGzipped)
+    {
+        DispatchDialogueResponseCompressed(Response->GetContent(), Callback, CacheKey, SchedulerKey, RaceId);
+    }
+    else
+    {
+        DispatchDialogueResponse(Response->GetContentAsString(), Callback, CacheKey, SchedulerKey, RaceId);
+    }
 }
 
-FString UAGLDialogueService::EventTypeToString(EAGLEventType EventType)
+void UAGLDialogueService::FinishDialogueRequest(bool bSuccess, const FAGLDialogueResponse& Response, const FOnDialogueGenerationComplete& Callback, uint32 SchedulerKey, uint32 RaceId)
 {
-    switch (EventType)
+    // Dialogue drives the active conversation UI, so it takes the
+    // priority bypass: any queued dialogue drains first for ordering,
+    // then this response runs without waiting on the budget
+    if (CallbackDispatcher)
     {
-        case EAGLEventType::Victory: return TEXT("player.victory");
-        case EAGLEventType::Defeat: return TEXT("player.defeat");
-        case EAGLEventType::Kill: return TEXT("player.kill");
-        case EAGLEventType::Death: return TEXT("player.death");
-        case EAGLEventType::Achievement: return TEXT("player.achievement");
-        case EAGLEventType::LevelUp: return TEXT("player.levelup");
-        case EAGLEventType::Loot: return TEXT("player.loot");
-        case EAGLEventType::SessionStart: return TEXT("player.sessionstart");
-        case EAGLEventType::SessionEnd: return TEXT("player.sessionend");
-        default: return TEXT("unknown");
+        TWeakObjectPtr<UAGLDialogueService> WeakThis(this);
+        CallbackDispatcher->Dispatch(EAGLCallbackLane::Dialogue,
+            [WeakThis, bSuccess, Response, Callback, SchedulerKey, RaceId]()
+            {
+                if (WeakThis.IsValid())
+                {
+                    WeakThis->ExecuteDialogueCallback(bSuccess, Response, Callback, SchedulerKey, RaceId);
+                }
+                else if (RaceId == 0)
+                {
+                    Callback.ExecuteIfBound(bSuccess, Response);
+                }
+            },
+            /*bBypassBudget*/ true);
+        return;
     }
+
+    ExecuteDialogueCallback(bSuccess, Response, Callback, SchedulerKey, RaceId);
 }
 
-FString UAGLDialogueService::EmotionTypeToString(EAGLEmotionType EmotionType)
+void UAGLDialogueService::ExecuteDialogueCallback(bool bSuccess, const FAGLDialogueResponse& Response, const FOnDialogueGenerationComplete& Callback, uint32 SchedulerKey, uint32 RaceId)
 {
-    switch (EmotionType)
+    // A race upgrade only lands while its window is open: a late LLM
+    // line would replace dialogue the player has already read and moved
+    // past. The response was still cached upstream, so the next
+    // identical request serves the richer line instantly.
+    if (RaceId != 0)
+    {
+        double Deadline = 0.0;
+        const bool bWindowKnown = PendingRaceDeadlines.RemoveAndCopyValue(RaceId, Deadline);
+
+        // A failed escalation is dropped silently; the player already
+        // has the template line
+        if (!bSuccess || !bWindowKnown)
+        {
+            return;
+        }
+
+        if (FPlatformTime::Seconds() > Deadline)
+        {
+            RaceUpgradesExpired++;
+            UE_LOG(LogTemp, Log, TEXT("AGLDialogueService: Dropped race upgrade, window expired"));
+            return;
+        }
+
+        RaceUpgradesDelivered++;
+    }
+
+    // A scheduled request fans out to every caller that joined it; the
+    // scheduler holds the leader's delegate too
+    if (RequestScheduler && SchedulerKey != 0)
     {
-        case EAGLEmotionType::Happy: return TEXT("happy");
-        case EAGLEmotionType::Excited: return TEXT("excited");
-        case EAGLEmotionType::Amazed: return TEXT("amazed");
-        case EAGLEmotionType::Proud: return TEXT("proud");
-        case EAGLEmotionType::Satisfied: return TEXT("satisfied");
-        case EAGLEmotionType::Cheerful: return TEXT("cheerful");
-        case EAGLEmotionType::Grateful: return TEXT("grateful");
-        case EAGLEmotionType::Sad: return TEXT("sad");
-        case EAGLEmotionType::Disappointed: return TEXT("disappointed");
-        case EAGLEmotionType::Frustrated: return TEXT("frustrated");
-        case EAGLEmotionType::Angry: return TEXT("angry");
-        case EAGLEmotionType::Worried: return TEXT("worried");
-        case EAGLEmotionType::Tired: return TEXT("tired");
-        case EAGLEmotionType::Neutral: return TEXT("neutral");
-        default: return TEXT("neutral");
+        RequestScheduler->CompleteDialogue(SchedulerKey, bSuccess, Response);
+        return;
     }
+
+    Callback.ExecuteIfBound(bSuccess, Response);
+}
+
+void UAGLDialogueService::DispatchDialogueResponse(FString ResponseContent, FOnDialogueGenerationComplete Callback, uint32 CacheKey, uint32 SchedulerKey, uint32 RaceId)
+{
+    // Parse on a background task and marshal only the delegate execution
+    // back to the game thread, so large payloads never hitch a frame
+    TWeakObjectPtr<UAGLDialogueService> WeakThis(this);
+    Async(EAsyncExecution::TaskGraph,
+        [WeakThis, ResponseContent = MoveTemp(ResponseContent), Callback, CacheKey, SchedulerKey, RaceId]()
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+
+            FAGLDialogueResponse DialogueResponse = WeakThis->DeserializeResponse(ResponseContent);
+            FAGLMetrics::Get().Record(EAGLMetricService::Dialogue, DialogueResponse, ResponseContent.Len());
+
+            AsyncTask(ENamedThreads::GameThread,
+                [WeakThis, Callback, CacheKey, SchedulerKey, RaceId, DialogueResponse = MoveTemp(DialogueResponse)]()
+                {
+                    UE_LOG(LogTemp, Log, TEXT("AGLDialogueService: Received dialogue: %s (Method: %s)"),
+                        *DialogueResponse.Dialogue,
+                        *DialogueResponse.Method);
+
+                    // Store for repeat requests within the session (cache is
+                    // only touched on the game thread)
+                    if (WeakThis.IsValid() && WeakThis->bUseResponseCache)
+                    {
+                        WeakThis->ResponseCache.Put(CacheKey, DialogueResponse);
+                    }
+
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->FinishDialogueRequest(true, DialogueResponse, Callback, SchedulerKey, RaceId);
+                    }
+                    else if (RaceId == 0)
+                    {
+                        Callback.ExecuteIfBound(true, DialogueResponse);
+                    }
+                });
+        });
+}
+
+void UAGLDialogueService::DispatchDialogueResponseCompressed(TArray<uint8> ResponseBytes, FOnDialogueGenerationComplete Callback, uint32 CacheKey, uint32 SchedulerKey, uint32 RaceId)
+{
+    // Inflate on the background task, then parse like the plain JSON path
+    TWeakObjectPtr<UAGLDialogueService> WeakThis(this);
+    Async(EAsyncExecution::TaskGraph,
+        [WeakThis, ResponseBytes = MoveTemp(ResponseBytes), Callback, CacheKey, SchedulerKey, RaceId]()
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+
+            TArray<uint8> Inflated;
+            if (!FAGLCompression::Decompress(ResponseBytes, Inflated))
+            {
+                FAGLMetrics::Get().RecordFailure(EAGLMetricService::Dialogue);
+                AsyncTask(ENamedThreads::GameThread,
+                    [WeakThis, Callback, SchedulerKey, RaceId]()
+                    {
+                        UE_LOG(LogTemp, Error, TEXT("AGLDialogueService: Failed to inflate gzip response"));
+                        FAGLDialogueResponse EmptyResponse;
+                        if (WeakThis.IsValid())
+                        {
+                            WeakThis->FinishDialogueRequest(false, EmptyResponse, Callback, SchedulerKey, RaceId);
+                        }
+                        else if (RaceId == 0)
+                        {
+                            Callback.ExecuteIfBound(false, EmptyResponse);
+                        }
+                    });
+                return;
+            }
+
+            WeakThis->CompressedBytesReceived.Add(ResponseBytes.Num());
+            WeakThis->UncompressedBytesReceived.Add(Inflated.Num());
+
+            FAGLDialogueResponse DialogueResponse = WeakThis->DeserializeResponse(FAGLCompression::BytesToString(Inflated));
+            FAGLMetrics::Get().Record(EAGLMetricService::Dialogue, DialogueResponse, ResponseBytes.Num());
+
+            AsyncTask(ENamedThreads::GameThread,
+                [WeakThis, Callback, CacheKey, SchedulerKey, RaceId, DialogueResponse = MoveTemp(DialogueResponse)]()
+                {
+                    // Store for repeat requests within the session (cache is
+                    // only touched on the game thread)
+                    if (WeakThis.IsValid() && WeakThis->bUseResponseCache)
+                    {
+                        WeakThis->ResponseCache.Put(CacheKey, DialogueResponse);
+                    }
+
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->FinishDialogueRequest(true, DialogueResponse, Callback, SchedulerKey, RaceId);
+                    }
+                    else if (RaceId == 0)
+                    {
+                        Callback.ExecuteIfBound(true, DialogueResponse);
+                    }
+                });
+        });
+}
+
+void UAGLDialogueService::DispatchDialogueResponseBinary(TArray<uint8> ResponseBytes, FOnDialogueGenerationComplete Callback, uint32 CacheKey, uint32 SchedulerKey, bool bGzipped, uint32 RaceId)
+{
+    // Same threading as the JSON path; typed decode fills the struct
+    // directly without an FJsonObject tree
+    TWeakObjectPtr<UAGLDialogueService> WeakThis(this);
+    Async(EAsyncExecution::TaskGraph,
+        [WeakThis, ResponseBytes = MoveTemp(ResponseBytes), Callback, CacheKey, SchedulerKey, bGzipped, RaceId]() mutable
+        {
+            const int32 WireBytes = ResponseBytes.Num();
+
+            if (bGzipped)
+            {
+                TArray<uint8> Inflated;
+                if (FAGLCompression::Decompress(ResponseBytes, Inflated))
+                {
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->CompressedBytesReceived.Add(ResponseBytes.Num());
+                        WeakThis->UncompressedBytesReceived.Add(Inflated.Num());
+                    }
+                    ResponseBytes = MoveTemp(Inflated);
+                }
+                else
+                {
+                    // Decode of the compressed stream will fail below and
+                    // take the normal failure path
+                    UE_LOG(LogTemp, Error, TEXT("AGLDialogueService: Failed to inflate gzip response"));
+                }
+            }
+
+            FAGLDialogueResponse DialogueResponse;
+            const bool bDecoded = FAGLMessagePack::DecodeDialogueResponse(ResponseBytes, DialogueResponse);
+            if (bDecoded)
+            {
+                FAGLMetrics::Get().Record(EAGLMetricService::Dialogue, DialogueResponse, WireBytes);
+            }
+            else
+            {
+                FAGLMetrics::Get().RecordFailure(EAGLMetricService::Dialogue);
+            }
+
+            AsyncTask(ENamedThreads::GameThread,
+                [WeakThis, Callback, CacheKey, SchedulerKey, RaceId, bDecoded, DialogueResponse = MoveTemp(DialogueResponse)]()
+                {
+                    if (!bDecoded)
+                    {
+                        UE_LOG(LogTemp, Error, TEXT("AGLDialogueService: Failed to decode MessagePack response"));
+                        if (WeakThis.IsValid())
+                        {
+                            WeakThis->FinishDialogueRequest(false, DialogueResponse, Callback, SchedulerKey, RaceId);
+                        }
+                        else if (RaceId == 0)
+                        {
+                            Callback.ExecuteIfBound(false, DialogueResponse);
+                        }
+                        return;
+                    }
+
+                    // Store for repeat requests within the session (cache is
+                    // only touched on the game thread)
+                    if (WeakThis.IsValid() && WeakThis->bUseResponseCache)
+                    {
+                        WeakThis->ResponseCache.Put(CacheKey, DialogueResponse);
+                    }
+
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->FinishDialogueRequest(true, DialogueResponse, Callback, SchedulerKey, RaceId);
+                    }
+                    else if (RaceId == 0)
+                    {
+                        Callback.ExecuteIfBound(true, DialogueResponse);
+                    }
+                });
+        });
+}
+
+FString UAGLDialogueService::EventTypeToString(EAGLEventType EventType)
+{
+    return FAGLWireNames::EventTypeToString(EventType);
+}
+
+FString UAGLDialogueService::EmotionTypeToString(EAGLEmotionType EmotionType)
+{
+    return FAGLWireNames::EmotionTypeToString(EmotionType);
 }
 
 FString UAGLDialogueService::PersonaToString(EAGLPersona Persona)
 {
-    switch (Persona)
-    {
-        case EAGLPersona::Cheerful: return TEXT("cheerful");
-        case EAGLPersona::Cool: return TEXT("cool");
-        case EAGLPersona::Cute: return TEXT("cute");
-        default: return TEXT("cheerful");
-    }
+    return FAGLWireNames::PersonaToString(Persona);
 }
 
 FString UAGLDialogueService::SerializeRequest(const FAGLDialogueRequest& Request)
 {
-    TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+    // Fixed-shape payload: write directly into a stack builder instead of
+    // allocating an FJsonObject tree
+    TStringBuilder<512> Builder;
+    FAGLJsonWriter Writer(Builder);
 
-    JsonObject->SetStringField(TEXT("event_type"), EventTypeToString(Request.EventType));
-    JsonObject->SetStringField(TEXT("emotion"), EmotionTypeToString(Request.Emotion));
-    JsonObject->SetStringField(TEXT("persona"), PersonaToString(Request.Persona));
-    JsonObject->SetBoolField(TEXT("force_llm"), Request.bForceLLM);
+    Writer.BeginObject();
+    Writer.WriteString(TEXT("event_type"), EventTypeToString(Request.EventType));
+    Writer.WriteString(TEXT("emotion"), EmotionTypeToString(Request.Emotion));
+    Writer.WriteString(TEXT("persona"), PersonaToString(Request.Persona));
+    Writer.WriteBool(TEXT("force_llm"), Request.bForceLLM);
 
     // Add optional player_id
     if (!Request.PlayerId.IsEmpty())
     {
-        JsonObject->SetStringField(TEXT("player_id"), Request.PlayerId);
+        Writer.WriteString(TEXT("player_id"), Request.PlayerId);
     }
 
     // Add language field
     if (!Request.Language.IsEmpty())
     {
-        JsonObject->SetStringField(TEXT("language"), Request.Language);
+        Writer.WriteString(TEXT("language"), Request.Language);
     }
 
     // Add context object if not empty
     if (Request.Context.Num() > 0)
     {
-        TSharedPtr<FJsonObject> ContextObject = MakeShareable(new FJsonObject);
-        for (const auto& Pair : Request.Context)
-        {
-            ContextObject->SetStringField(Pair.Key, Pair.Value);
-        }
-        JsonObject->SetObjectField(TEXT("context"), ContextObject);
+        Writer.WriteMap(TEXT("context"), Request.Context);
     }
+    Writer.EndObject();
 
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
-
-    return OutputString;
+    return FString(Builder.ToString());
 }
 
 FAGLDialogueResponse UAGLDialogueService::DeserializeResponse(const FString& JsonString)
 {
     FAGLDialogueResponse Response;
 
-    TSharedPtr<FJsonObject> JsonObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+    // Fixed-shape payload: stream fields straight into the struct
+    // instead of materializing an FJsonObject tree. The arena lives on
+    // the stack because parses run concurrently on the task graph
+    FAGLJsonArena Arena;
+    FAGLJsonReader Reader(JsonString, Arena);
 
-    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    if (!Reader.EnterObject())
     {
         UE_LOG(LogTemp, Error, TEXT("Failed to parse dialogue response JSON"));
         return Response;
     }
 
-    JsonObject->TryGetStringField(TEXT("dialogue"), Response.Dialogue);
-    JsonObject->TryGetStringField(TEXT("method"), Response.Method);
-    JsonObject->TryGetNumberField(TEXT("cost"), Response.Cost);
-    JsonObject->TryGetNumberField(TEXT("latency_ms"), Response.LatencyMs);
-    JsonObject->TryGetBoolField(TEXT("used_special_case"), Response.bUsedSpecialCase);
-    JsonObject->TryGetBoolField(TEXT("cache_hit"), Response.bCacheHit);
-
-    // Parse memory_count
-    int32 MemoryCount;
-    if (JsonObject->TryGetNumberField(TEXT("memory_count"), MemoryCount))
-    {
-        Response.MemoryCount = MemoryCount;
-    }
-
-    // Parse special_case_reasons array
-    const TArray<TSharedPtr<FJsonValue>>* ReasonsArray;
-    if (JsonObject->TryGetArrayField(TEXT("special_case_reasons"), ReasonsArray))
+    FStringView Key;
+    while (Reader.NextField(Key))
     {
-        for (const TSharedPtr<FJsonValue>& ReasonValue : *ReasonsArray)
+        if (Key == TEXT("dialogue"))               { Reader.ReadString(Response.Dialogue); }
+        else if (Key == TEXT("method"))            { Reader.ReadString(Response.Method); }
+        else if (Key == TEXT("cost"))              { Reader.ReadNumber(Response.Cost); }
+        else if (Key == TEXT("latency_ms"))        { Reader.ReadNumber(Response.LatencyMs); }
+        else if (Key == TEXT("used_special_case")) { Reader.ReadBool(Response.bUsedSpecialCase); }
+        else if (Key == TEXT("cache_hit"))         { Reader.ReadBool(Response.bCacheHit); }
+        else if (Key == TEXT("memory_count"))      { Reader.ReadNumber(Response.MemoryCount); }
+        else if (Key == TEXT("special_case_reasons"))
         {
-            FString Reason;
-            if (ReasonValue->TryGetString(Reason))
+            if (Reader.EnterArray())
             {
-                Response.SpecialCaseReasons.Add(Reason);
+                while (Reader.NextElement())
+                {
+                    FString Reason;
+                    if (Reader.ReadString(Reason))
+                    {
+                        Response.SpecialCaseReasons.Add(MoveTemp(Reason));
+                    }
+                }
             }
         }
+        else { Reader.SkipValue(); }
+    }
+
+    if (Reader.HadError())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to parse dialogue response JSON"));
     }
 
     return Response;
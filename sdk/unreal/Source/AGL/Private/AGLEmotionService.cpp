@@ -1,40 +1,220 @@
 // Copyright AGL Team. All Rights Reserved.
 
 #include "AGLEmotionService.h"
+#include "AGLConnectionPool.h"
+#include "AGLLocalRuleEngine.h"
+#include "AGLRealtimeTransport.h"
+#include "AGLRequestScheduler.h"
+#include "AGLOfflineJournal.h"
+#include "AGLCallbackDispatcher.h"
+#include "AGLCompression.h"
+#include "AGLJsonReader.h"
+#include "AGLJsonWriter.h"
+#include "AGLMetrics.h"
+#include "AGLMessagePack.h"
+#include "AGLWireNames.h"
+#include "Async/Async.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Json.h"
 #include "JsonUtilities.h"
 
-void UAGLEmotionService::Initialize(const FString& InServiceUrl, const FString& InApiKey, float InTimeout)
+void UAGLEmotionService::Initialize(const FString& InServiceUrl, const FString& InApiKey, float InTimeout, UAGLConnectionPool* InConnectionPool)
 {
     ServiceUrl = InServiceUrl;
     ApiKey = InApiKey;
     Timeout = InTimeout;
+    ConnectionPool = InConnectionPool;
 
     UE_LOG(LogTemp, Log, TEXT("AGLEmotionService initialized with URL: %s"), *ServiceUrl);
 }
 
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UAGLEmotionService::CreateHttpRequest()
+{
+    return ConnectionPool ? ConnectionPool->AcquireRequest(ServiceUrl) : FHttpModule::Get().CreateRequest();
+}
+
+void UAGLEmotionService::ReleaseHttpRequest(FHttpRequestPtr Request)
+{
+    if (ConnectionPool && Request.IsValid())
+    {
+        ConnectionPool->ReleaseRequest(ServiceUrl, Request.ToSharedRef());
+    }
+}
+
+void UAGLEmotionService::ConfigureLocalRules(bool bInUseLocalRules, float InConfidenceThreshold)
+{
+    bUseLocalRules = bInUseLocalRules;
+    LocalRuleConfidenceThreshold = FMath::Clamp(InConfidenceThreshold, 0.0f, 1.0f);
+}
+
+void UAGLEmotionService::SetRealtimeTransport(UAGLRealtimeTransport* InTransport)
+{
+    RealtimeTransport = InTransport;
+}
+
+void UAGLEmotionService::SetBinaryEncoding(bool bInUseBinaryEncoding)
+{
+    bUseBinaryEncoding = bInUseBinaryEncoding;
+}
+
+void UAGLEmotionService::SetRequestScheduler(UAGLRequestScheduler* InScheduler)
+{
+    RequestScheduler = InScheduler;
+}
+
+void UAGLEmotionService::SetOfflineJournal(UAGLOfflineJournal* InJournal)
+{
+    OfflineJournal = InJournal;
+}
+
+void UAGLEmotionService::SetCompression(bool bInUseCompression, bool bInCompressRequestBodies, int32 InMinRequestBytes)
+{
+    bUseCompression = bInUseCompression;
+    bCompressRequestBodies = bInCompressRequestBodies;
+    CompressionMinRequestBytes = FMath::Max(0, InMinRequestBytes);
+}
+
+void UAGLEmotionService::SetCallbackDispatcher(UAGLCallbackDispatcher* InDispatcher)
+{
+    CallbackDispatcher = InDispatcher;
+}
+
 void UAGLEmotionService::AnalyzeEmotion(const FAGLEmotionRequest& Request, FOnEmotionAnalysisComplete OnComplete)
 {
-    // Create HTTP request
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+    // First pass: answer confident cases from the local rule engine
+    // synchronously, skipping the network round trip and the API call
+    if (bUseLocalRules && !Request.bForceML)
+    {
+        FAGLEmotionResponse LocalResponse = FAGLLocalRuleEngine::Classify(Request);
+        if (LocalResponse.Confidence >= LocalRuleConfidenceThreshold)
+        {
+            UE_LOG(LogTemp, Log, TEXT("AGLEmotionService: Local rule match (%s, confidence %.2f)"),
+                *LocalResponse.Reasoning, LocalResponse.Confidence);
+
+            FAGLMetrics::Get().Record(EAGLMetricService::Emotion, LocalResponse, /*PayloadBytes*/ 0);
+
+            // The local path stays synchronous; the bypass drains any
+            // queued emotion responses first so ordering holds
+            if (CallbackDispatcher)
+            {
+                CallbackDispatcher->Dispatch(EAGLCallbackLane::Emotion,
+                    [OnComplete, LocalResponse]()
+                    {
+                        OnComplete.ExecuteIfBound(true, LocalResponse);
+                    },
+                    /*bBypassBudget*/ true);
+            }
+            else
+            {
+                OnComplete.ExecuteIfBound(true, LocalResponse);
+            }
+            return;
+        }
+        // Low confidence: escalate to the cloud classifier
+    }
+
+    // Coalesce byte-identical in-flight requests: the first caller sends,
+    // later callers join and share the single response
+    uint32 SchedulerKey = 0;
+    if (RequestScheduler)
+    {
+        SchedulerKey = UAGLRequestScheduler::MakeKey(TEXT("emotion"), SerializeRequest(Request));
+        if (RequestScheduler->JoinOrBeginEmotion(SchedulerKey, OnComplete))
+        {
+            return;
+        }
+    }
+
+    // Multiplex over the persistent WebSocket when connected; a dropped
+    // or timed-out request retries once over HTTP
+    if (RealtimeTransport && RealtimeTransport->IsConnected())
+    {
+        FString JsonPayload = SerializeRequest(Request);
+        TWeakObjectPtr<UAGLEmotionService> WeakThis(this);
+        const bool bSent = RealtimeTransport->SendRequest(TEXT("emotion"), TEXT("/analyze"), JsonPayload,
+            FOnRealtimeReply::CreateLambda([WeakThis, Request, OnComplete, SchedulerKey](bool bSuccess, const FString& Payload)
+            {
+                if (!WeakThis.IsValid())
+                {
+                    return;
+                }
+
+                if (bSuccess)
+                {
+                    WeakThis->DispatchEmotionResponse(Payload, OnComplete, SchedulerKey);
+                }
+                else
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("AGLEmotionService: Realtime request failed, retrying over HTTP"));
+                    WeakThis->AnalyzeEmotionOverHttp(Request, OnComplete, SchedulerKey);
+                }
+            }));
+
+        if (bSent)
+        {
+            return;
+        }
+    }
+
+    AnalyzeEmotionOverHttp(Request, OnComplete, SchedulerKey);
+}
+
+void UAGLEmotionService::AnalyzeEmotionOverHttp(const FAGLEmotionRequest& Request, FOnEmotionAnalysisComplete OnComplete, uint32 SchedulerKey)
+{
+    // Per-request state lives in a pooled context so the completion
+    // handler only captures an index instead of a fresh lambda closure
+    FAGLRequestContext& Context = RequestContextPool.Acquire();
+    Context.EmotionRequest = Request;
+    Context.OnEmotion = OnComplete;
+    Context.SchedulerKey = SchedulerKey;
+
+    // Create HTTP request (pooled keep-alive connection when available)
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest();
 
     HttpRequest->SetURL(ServiceUrl + TEXT("/analyze"));
     HttpRequest->SetVerb(TEXT("POST"));
-    HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
     HttpRequest->SetHeader(TEXT("X-API-Key"), ApiKey);
     HttpRequest->SetTimeout(Timeout);
+    if (bUseCompression)
+    {
+        HttpRequest->SetHeader(TEXT("Accept-Encoding"), FAGLCompression::ContentEncoding);
+    }
 
-    // Serialize request to JSON
-    FString JsonPayload = SerializeRequest(Request);
-    HttpRequest->SetContentAsString(JsonPayload);
+    // Serialize request into the context's reused payload buffers:
+    // MessagePack in binary mode, JSON otherwise
+    if (bUseBinaryEncoding)
+    {
+        FAGLMessagePack::EncodeEmotionRequest(Request, Context.BinaryPayload);
+        HttpRequest->SetHeader(TEXT("Content-Type"), FAGLMessagePack::ContentType);
+        HttpRequest->SetHeader(TEXT("Accept"), FAGLMessagePack::ContentType);
+    }
+    else
+    {
+        Context.StringPayload = SerializeRequest(Request);
+        HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    }
+    Context.ApplyRequestBody(HttpRequest, bUseBinaryEncoding, bCompressRequestBodies, CompressionMinRequestBytes);
 
     // Bind response handler
     HttpRequest->OnProcessRequestComplete().BindLambda(
-        [this, OnComplete](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+        [this, ContextIndex = Context.PoolIndex](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
         {
-            HandleEmotionResponse(Request, Response, bWasSuccessful, OnComplete);
+            FAGLRequestContext& Context = RequestContextPool.Get(ContextIndex);
+            const FOnEmotionAnalysisComplete Callback = Context.OnEmotion;
+            const uint32 SchedulerKey = Context.SchedulerKey;
+
+            // Transport failure: journal the request for replay once
+            // connectivity returns (HTTP error codes mean the backend
+            // was reachable, so those are not journaled)
+            if ((!bWasSuccessful || !Response.IsValid()) && OfflineJournal)
+            {
+                OfflineJournal->RecordEmotionRequest(Context.EmotionRequest);
+            }
+
+            RequestContextPool.Release(Context);
+
+            HandleEmotionResponse(Request, Response, bWasSuccessful, Callback, SchedulerKey);
         }
     );
 
@@ -82,130 +262,310 @@ void UAGLEmotionService::HandleEmotionResponse(
     FHttpRequestPtr Request,
     FHttpResponsePtr Response,
     bool bWasSuccessful,
-    FOnEmotionAnalysisComplete Callback)
+    FOnEmotionAnalysisComplete Callback,
+    uint32 SchedulerKey)
 {
+    ReleaseHttpRequest(Request);
+
     if (!bWasSuccessful || !Response.IsValid())
     {
         UE_LOG(LogTemp, Error, TEXT("AGLEmotionService: Request failed"));
+        FAGLMetrics::Get().RecordFailure(EAGLMetricService::Emotion);
         FAGLEmotionResponse EmptyResponse;
-        Callback.ExecuteIfBound(false, EmptyResponse);
+        FinishEmotionRequest(false, EmptyResponse, Callback, SchedulerKey);
         return;
     }
 
     if (Response->GetResponseCode() != 200)
     {
         UE_LOG(LogTemp, Error, TEXT("AGLEmotionService: Server returned error %d"), Response->GetResponseCode());
+        FAGLMetrics::Get().RecordFailure(EAGLMetricService::Emotion);
         FAGLEmotionResponse EmptyResponse;
-        Callback.ExecuteIfBound(false, EmptyResponse);
+        FinishEmotionRequest(false, EmptyResponse, Callback, SchedulerKey);
         return;
     }
 
-    // Parse response
-    FString ResponseContent = Response->GetContentAsString();
-    FAGLEmotionResponse EmotionResponse = DeserializeResponse(ResponseContent);
+    // Gzip responses carry raw bytes to the background task, which
+    // inflates them before parsing
+    const bool bGzipped = Response->GetHeader(TEXT("Content-Encoding")).Contains(TEXT("gzip"));
 
-    UE_LOG(LogTemp, Log, TEXT("AGLEmotionService: Received emotion %s with intensity %.2f"),
-        *UEnum::GetValueAsString(EmotionResponse.Emotion),
-        EmotionResponse.Intensity);
+    if (bUseBinaryEncoding && Response->GetContentType().Contains(TEXT("msgpack")))
+    {
+        DispatchEmotionResponseBinary(Response->GetContent(), Callback, SchedulerKey, bGzipped);
+    }
+    else if (bGzipped)
+    {
+        DispatchEmotionResponseCompressed(Response->GetContent(), Callback, SchedulerKey);
+    }
+    else
+    {
+        DispatchEmotionResponse(Response->GetContentAsString(), Callback, SchedulerKey);
+    }
+}
+
+void UAGLEmotionService::FinishEmotionRequest(bool bSuccess, const FAGLEmotionResponse& Response, const FOnEmotionAnalysisComplete& Callback, uint32 SchedulerKey)
+{
+    // Queue under the frame budget when the dispatcher is attached; the
+    // scheduler fan-out runs inside the queued item so joined callers
+    // keep completion order
+    if (CallbackDispatcher)
+    {
+        TWeakObjectPtr<UAGLEmotionService> WeakThis(this);
+        CallbackDispatcher->Dispatch(EAGLCallbackLane::Emotion,
+            [WeakThis, bSuccess, Response, Callback, SchedulerKey]()
+            {
+                if (WeakThis.IsValid())
+                {
+                    WeakThis->ExecuteEmotionCallback(bSuccess, Response, Callback, SchedulerKey);
+                }
+                else
+                {
+                    Callback.ExecuteIfBound(bSuccess, Response);
+                }
+            });
+        return;
+    }
 
-    Callback.ExecuteIfBound(true, EmotionResponse);
+    ExecuteEmotionCallback(bSuccess, Response, Callback, SchedulerKey);
 }
 
-FString UAGLEmotionService::EventTypeToString(EAGLEventType EventType)
+void UAGLEmotionService::ExecuteEmotionCallback(bool bSuccess, const FAGLEmotionResponse& Response, const FOnEmotionAnalysisComplete& Callback, uint32 SchedulerKey)
 {
-    switch (EventType)
+    // A scheduled request fans out to every caller that joined it; the
+    // scheduler holds the leader's delegate too
+    if (RequestScheduler && SchedulerKey != 0)
     {
-        case EAGLEventType::Victory: return TEXT("player.victory");
-        case EAGLEventType::Defeat: return TEXT("player.defeat");
-        case EAGLEventType::Kill: return TEXT("player.kill");
-        case EAGLEventType::Death: return TEXT("player.death");
-        case EAGLEventType::Achievement: return TEXT("player.achievement");
-        case EAGLEventType::LevelUp: return TEXT("player.levelup");
-        case EAGLEventType::Loot: return TEXT("player.loot");
-        case EAGLEventType::SessionStart: return TEXT("player.sessionstart");
-        case EAGLEventType::SessionEnd: return TEXT("player.sessionend");
-        default: return TEXT("unknown");
+        RequestScheduler->CompleteEmotion(SchedulerKey, bSuccess, Response);
+        return;
     }
+
+    Callback.ExecuteIfBound(bSuccess, Response);
+}
+
+void UAGLEmotionService::DispatchEmotionResponse(FString ResponseContent, FOnEmotionAnalysisComplete Callback, uint32 SchedulerKey)
+{
+    // Parse on a background task and marshal only the delegate execution
+    // back to the game thread, so large payloads never hitch a frame
+    TWeakObjectPtr<UAGLEmotionService> WeakThis(this);
+    Async(EAsyncExecution::TaskGraph,
+        [WeakThis, ResponseContent = MoveTemp(ResponseContent), Callback, SchedulerKey]()
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+
+            FAGLEmotionResponse EmotionResponse = WeakThis->DeserializeResponse(ResponseContent);
+            FAGLMetrics::Get().Record(EAGLMetricService::Emotion, EmotionResponse, ResponseContent.Len());
+
+            AsyncTask(ENamedThreads::GameThread,
+                [WeakThis, Callback, SchedulerKey, EmotionResponse = MoveTemp(EmotionResponse)]()
+                {
+                    UE_LOG(LogTemp, Log, TEXT("AGLEmotionService: Received emotion %s with intensity %.2f"),
+                        *UEnum::GetValueAsString(EmotionResponse.Emotion),
+                        EmotionResponse.Intensity);
+
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->FinishEmotionRequest(true, EmotionResponse, Callback, SchedulerKey);
+                    }
+                    else
+                    {
+                        Callback.ExecuteIfBound(true, EmotionResponse);
+                    }
+                });
+        });
+}
+
+void UAGLEmotionService::DispatchEmotionResponseCompressed(TArray<uint8> ResponseBytes, FOnEmotionAnalysisComplete Callback, uint32 SchedulerKey)
+{
+    // Inflate on the background task, then parse like the plain JSON path
+    TWeakObjectPtr<UAGLEmotionService> WeakThis(this);
+    Async(EAsyncExecution::TaskGraph,
+        [WeakThis, ResponseBytes = MoveTemp(ResponseBytes), Callback, SchedulerKey]()
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+
+            TArray<uint8> Inflated;
+            if (!FAGLCompression::Decompress(ResponseBytes, Inflated))
+            {
+                FAGLMetrics::Get().RecordFailure(EAGLMetricService::Emotion);
+                AsyncTask(ENamedThreads::GameThread,
+                    [WeakThis, Callback, SchedulerKey]()
+                    {
+                        UE_LOG(LogTemp, Error, TEXT("AGLEmotionService: Failed to inflate gzip response"));
+                        FAGLEmotionResponse EmptyResponse;
+                        if (WeakThis.IsValid())
+                        {
+                            WeakThis->FinishEmotionRequest(false, EmptyResponse, Callback, SchedulerKey);
+                        }
+                        else
+                        {
+                            Callback.ExecuteIfBound(false, EmptyResponse);
+                        }
+                    });
+                return;
+            }
+
+            WeakThis->CompressedBytesReceived.Add(ResponseBytes.Num());
+            WeakThis->UncompressedBytesReceived.Add(Inflated.Num());
+
+            FAGLEmotionResponse EmotionResponse = WeakThis->DeserializeResponse(FAGLCompression::BytesToString(Inflated));
+            FAGLMetrics::Get().Record(EAGLMetricService::Emotion, EmotionResponse, ResponseBytes.Num());
+
+            AsyncTask(ENamedThreads::GameThread,
+                [WeakThis, Callback, SchedulerKey, EmotionResponse = MoveTemp(EmotionResponse)]()
+                {
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->FinishEmotionRequest(true, EmotionResponse, Callback, SchedulerKey);
+                    }
+                    else
+                    {
+                        Callback.ExecuteIfBound(true, EmotionResponse);
+                    }
+                });
+        });
+}
+
+void UAGLEmotionService::DispatchEmotionResponseBinary(TArray<uint8> ResponseBytes, FOnEmotionAnalysisComplete Callback, uint32 SchedulerKey, bool bGzipped)
+{
+    // Same threading as the JSON path; typed decode fills the struct
+    // directly without an FJsonObject tree
+    TWeakObjectPtr<UAGLEmotionService> WeakThis(this);
+    Async(EAsyncExecution::TaskGraph,
+        [WeakThis, ResponseBytes = MoveTemp(ResponseBytes), Callback, SchedulerKey, bGzipped]() mutable
+        {
+            const int32 WireBytes = ResponseBytes.Num();
+
+            if (bGzipped)
+            {
+                TArray<uint8> Inflated;
+                if (FAGLCompression::Decompress(ResponseBytes, Inflated))
+                {
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->CompressedBytesReceived.Add(ResponseBytes.Num());
+                        WeakThis->UncompressedBytesReceived.Add(Inflated.Num());
+                    }
+                    ResponseBytes = MoveTemp(Inflated);
+                }
+                else
+                {
+                    // Decode of the compressed stream will fail below and
+                    // take the normal failure path
+                    UE_LOG(LogTemp, Error, TEXT("AGLEmotionService: Failed to inflate gzip response"));
+                }
+            }
+
+            FAGLEmotionResponse EmotionResponse;
+            const bool bDecoded = FAGLMessagePack::DecodeEmotionResponse(ResponseBytes, EmotionResponse);
+            if (bDecoded)
+            {
+                FAGLMetrics::Get().Record(EAGLMetricService::Emotion, EmotionResponse, WireBytes);
+            }
+            else
+            {
+                FAGLMetrics::Get().RecordFailure(EAGLMetricService::Emotion);
+            }
+
+            AsyncTask(ENamedThreads::GameThread,
+                [WeakThis, Callback, SchedulerKey, bDecoded, EmotionResponse = MoveTemp(EmotionResponse)]()
+                {
+                    if (!bDecoded)
+                    {
+                        UE_LOG(LogTemp, Error, TEXT("AGLEmotionService: Failed to decode MessagePack response"));
+                    }
+
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->FinishEmotionRequest(bDecoded, EmotionResponse, Callback, SchedulerKey);
+                    }
+                    else
+                    {
+                        Callback.ExecuteIfBound(bDecoded, EmotionResponse);
+                    }
+                });
+        });
+}
+
+FString UAGLEmotionService::EventTypeToString(EAGLEventType EventType)
+{
+    return FAGLWireNames::EventTypeToString(EventType);
 }
 
 EAGLEmotionType UAGLEmotionService::StringToEmotionType(const FString& EmotionString)
 {
-    if (EmotionString == TEXT("happy")) return EAGLEmotionType::Happy;
-    if (EmotionString == TEXT("excited")) return EAGLEmotionType::Excited;
-    if (EmotionString == TEXT("amazed")) return EAGLEmotionType::Amazed;
-    if (EmotionString == TEXT("proud")) return EAGLEmotionType::Proud;
-    if (EmotionString == TEXT("satisfied")) return EAGLEmotionType::Satisfied;
-    if (EmotionString == TEXT("cheerful")) return EAGLEmotionType::Cheerful;
-    if (EmotionString == TEXT("grateful")) return EAGLEmotionType::Grateful;
-    if (EmotionString == TEXT("sad")) return EAGLEmotionType::Sad;
-    if (EmotionString == TEXT("disappointed")) return EAGLEmotionType::Disappointed;
-    if (EmotionString == TEXT("frustrated")) return EAGLEmotionType::Frustrated;
-    if (EmotionString == TEXT("angry")) return EAGLEmotionType::Angry;
-    if (EmotionString == TEXT("worried")) return EAGLEmotionType::Worried;
-    if (EmotionString == TEXT("tired")) return EAGLEmotionType::Tired;
-    return EAGLEmotionType::Neutral;
+    return FAGLWireNames::StringToEmotionType(EmotionString);
 }
 
 FString UAGLEmotionService::SerializeRequest(const FAGLEmotionRequest& Request)
 {
-    TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-
-    JsonObject->SetStringField(TEXT("type"), EventTypeToString(Request.EventType));
-    JsonObject->SetBoolField(TEXT("force_ml"), Request.bForceML);
+    // Fixed-shape payload: write directly into a stack builder instead of
+    // allocating an FJsonObject tree
+    TStringBuilder<512> Builder;
+    FAGLJsonWriter Writer(Builder);
 
-    // Add data object
-    TSharedPtr<FJsonObject> DataObject = MakeShareable(new FJsonObject);
-    for (const auto& Pair : Request.Data)
-    {
-        DataObject->SetStringField(Pair.Key, Pair.Value);
-    }
-    JsonObject->SetObjectField(TEXT("data"), DataObject);
+    Writer.BeginObject();
+    Writer.WriteString(TEXT("type"), EventTypeToString(Request.EventType));
+    Writer.WriteBool(TEXT("force_ml"), Request.bForceML);
+    Writer.WriteMap(TEXT("data"), Request.Data);
 
     // Add context object if not empty
     if (Request.Context.Num() > 0)
     {
-        TSharedPtr<FJsonObject> ContextObject = MakeShareable(new FJsonObject);
-        for (const auto& Pair : Request.Context)
-        {
-            ContextObject->SetStringField(Pair.Key, Pair.Value);
-        }
-        JsonObject->SetObjectField(TEXT("context"), ContextObject);
+        Writer.WriteMap(TEXT("context"), Request.Context);
     }
+    Writer.EndObject();
 
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
-
-    return OutputString;
+    return FString(Builder.ToString());
 }
 
 FAGLEmotionResponse UAGLEmotionService::DeserializeResponse(const FString& JsonString)
 {
     FAGLEmotionResponse Response;
 
-    TSharedPtr<FJsonObject> JsonObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+    // Fixed-shape payload: stream fields straight into the struct
+    // instead of materializing an FJsonObject tree. The arena lives on
+    // the stack because parses run concurrently on the task graph
+    FAGLJsonArena Arena;
+    FAGLJsonReader Reader(JsonString, Arena);
 
-    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    if (!Reader.EnterObject())
     {
         UE_LOG(LogTemp, Error, TEXT("Failed to parse emotion response JSON"));
         return Response;
     }
 
-    FString EmotionString;
-    if (JsonObject->TryGetStringField(TEXT("emotion"), EmotionString))
+    FStringView Key;
+    while (Reader.NextField(Key))
     {
-        Response.Emotion = StringToEmotionType(EmotionString);
+        if (Key == TEXT("emotion"))
+        {
+            FString EmotionString;
+            if (Reader.ReadString(EmotionString))
+            {
+                Response.Emotion = StringToEmotionType(EmotionString);
+            }
+        }
+        else if (Key == TEXT("intensity"))   { Reader.ReadNumber(Response.Intensity); }
+        else if (Key == TEXT("confidence"))  { Reader.ReadNumber(Response.Confidence); }
+        else if (Key == TEXT("cost"))        { Reader.ReadNumber(Response.Cost); }
+        else if (Key == TEXT("latency_ms"))  { Reader.ReadNumber(Response.LatencyMs); }
+        else if (Key == TEXT("action"))      { Reader.ReadString(Response.Action); }
+        else if (Key == TEXT("reasoning"))   { Reader.ReadString(Response.Reasoning); }
+        else if (Key == TEXT("method"))      { Reader.ReadString(Response.Method); }
+        else if (Key == TEXT("cache_hit"))   { Reader.ReadBool(Response.bCacheHit); }
+        else                                 { Reader.SkipValue(); }
     }
 
-    JsonObject->TryGetNumberField(TEXT("intensity"), Response.Intensity);
-    JsonObject->TryGetNumberField(TEXT("confidence"), Response.Confidence);
-    JsonObject->TryGetNumberField(TEXT("cost"), Response.Cost);
-    JsonObject->TryGetNumberField(TEXT("latency_ms"), Response.LatencyMs);
-    JsonObject->TryGetStringField(TEXT("action"), Response.Action);
-    JsonObject->TryGetStringField(TEXT("reasoning"), Response.Reasoning);
-    JsonObject->TryGetStringField(TEXT("method"), Response.Method);
-    JsonObject->TryGetBoolField(TEXT("cache_hit"), Response.bCacheHit);
+    if (Reader.HadError())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to parse emotion response JSON"));
+    }
 
     return Response;
 }
@@ -0,0 +1,215 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLEventBatcher.h"
+#include "AGLConnectionPool.h"
+#include "Async/Async.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Json.h"
+#include "JsonUtilities.h"
+
+void UAGLEventBatcher::Initialize(UAGLEmotionService* InEmotionService, int32 InBatchSize, float InFlushInterval)
+{
+    EmotionService = InEmotionService;
+    BatchSize = FMath::Max(1, InBatchSize);
+    FlushInterval = FMath::Max(0.01f, InFlushInterval);
+
+    FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UAGLEventBatcher::TickFlush),
+        FlushInterval
+    );
+
+    UE_LOG(LogTemp, Log, TEXT("AGLEventBatcher initialized (batch size=%d, flush interval=%.0fms)"),
+        BatchSize, FlushInterval * 1000.0f);
+}
+
+void UAGLEventBatcher::Shutdown()
+{
+    if (FlushTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+        FlushTickerHandle.Reset();
+    }
+
+    Flush();
+}
+
+void UAGLEventBatcher::EnqueueEmotionRequest(const FAGLEmotionRequest& Request, FOnEmotionAnalysisComplete OnComplete)
+{
+    TUniquePtr<FPendingEmotionEvent> Event = MakeUnique<FPendingEmotionEvent>();
+    Event->Request = Request;
+    Event->OnComplete = OnComplete;
+
+    PendingEvents.Enqueue(MoveTemp(Event));
+
+    if (PendingCount.Increment() >= BatchSize)
+    {
+        // Flush drains the Mpsc queue and touches the HTTP module and
+        // connection pool, all of which expect the game thread; threshold
+        // trips on other threads marshal over instead of flushing inline
+        if (IsInGameThread())
+        {
+            Flush();
+        }
+        else
+        {
+            TWeakObjectPtr<UAGLEventBatcher> WeakThis(this);
+            AsyncTask(ENamedThreads::GameThread, [WeakThis]()
+            {
+                if (WeakThis.IsValid())
+                {
+                    WeakThis->Flush();
+                }
+            });
+        }
+    }
+}
+
+void UAGLEventBatcher::Flush()
+{
+    if (!EmotionService || PendingCount.GetValue() == 0)
+    {
+        return;
+    }
+
+    // Drain the queue. Shared pointer keeps the batch alive until the
+    // HTTP completion handler fans the results back out.
+    TSharedPtr<TArray<TUniquePtr<FPendingEmotionEvent>>> Events = MakeShared<TArray<TUniquePtr<FPendingEmotionEvent>>>();
+    TUniquePtr<FPendingEmotionEvent> Event;
+    while (PendingEvents.Dequeue(Event))
+    {
+        PendingCount.Decrement();
+        Events->Add(MoveTemp(Event));
+    }
+
+    if (Events->Num() == 0)
+    {
+        return;
+    }
+
+    // Create HTTP request (pooled keep-alive connection when available)
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = EmotionService->CreateHttpRequest();
+
+    HttpRequest->SetURL(EmotionService->ServiceUrl + TEXT("/analyze/batch"));
+    HttpRequest->SetVerb(TEXT("POST"));
+    HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    HttpRequest->SetHeader(TEXT("X-API-Key"), EmotionService->ApiKey);
+    HttpRequest->SetTimeout(EmotionService->Timeout);
+    HttpRequest->SetContentAsString(SerializeBatch(*Events));
+
+    // Bind response handler
+    HttpRequest->OnProcessRequestComplete().BindLambda(
+        [this, Events](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+        {
+            HandleBatchResponse(Request, Response, bWasSuccessful, Events);
+        }
+    );
+
+    // Send request
+    HttpRequest->ProcessRequest();
+
+    UE_LOG(LogTemp, Log, TEXT("AGLEventBatcher: Flushed batch of %d emotion events"), Events->Num());
+}
+
+bool UAGLEventBatcher::TickFlush(float DeltaTime)
+{
+    Flush();
+    return true;
+}
+
+FString UAGLEventBatcher::SerializeBatch(const TArray<TUniquePtr<FPendingEmotionEvent>>& Events)
+{
+    TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+
+    TArray<TSharedPtr<FJsonValue>> EventArray;
+    EventArray.Reserve(Events.Num());
+
+    for (const TUniquePtr<FPendingEmotionEvent>& Event : Events)
+    {
+        // Each element uses the same shape as a single /analyze payload
+        FString EventJson = EmotionService->SerializeRequest(Event->Request);
+
+        TSharedPtr<FJsonObject> EventObject;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(EventJson);
+        if (FJsonSerializer::Deserialize(Reader, EventObject) && EventObject.IsValid())
+        {
+            EventArray.Add(MakeShareable(new FJsonValueObject(EventObject)));
+        }
+    }
+
+    JsonObject->SetArrayField(TEXT("events"), EventArray);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
+void UAGLEventBatcher::HandleBatchResponse(
+    FHttpRequestPtr Request,
+    FHttpResponsePtr Response,
+    bool bWasSuccessful,
+    TSharedPtr<TArray<TUniquePtr<FPendingEmotionEvent>>> Events)
+{
+    EmotionService->ReleaseHttpRequest(Request);
+
+    if (!bWasSuccessful || !Response.IsValid() || Response->GetResponseCode() != 200)
+    {
+        UE_LOG(LogTemp, Error, TEXT("AGLEventBatcher: Batch request failed"));
+        FAGLEmotionResponse EmptyResponse;
+        for (const TUniquePtr<FPendingEmotionEvent>& Event : *Events)
+        {
+            Event->OnComplete.ExecuteIfBound(false, EmptyResponse);
+        }
+        return;
+    }
+
+    // Parse response: results array ordered to match the submitted events
+    FString ResponseContent = Response->GetContentAsString();
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseContent);
+
+    const TArray<TSharedPtr<FJsonValue>>* ResultsArray = nullptr;
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid() ||
+        !JsonObject->TryGetArrayField(TEXT("results"), ResultsArray))
+    {
+        UE_LOG(LogTemp, Error, TEXT("AGLEventBatcher: Failed to parse batch response JSON"));
+        FAGLEmotionResponse EmptyResponse;
+        for (const TUniquePtr<FPendingEmotionEvent>& Event : *Events)
+        {
+            Event->OnComplete.ExecuteIfBound(false, EmptyResponse);
+        }
+        return;
+    }
+
+    // Fan results back out to the original delegates
+    for (int32 Index = 0; Index < Events->Num(); ++Index)
+    {
+        FAGLEmotionResponse EmotionResponse;
+        bool bHasResult = false;
+
+        if (ResultsArray->IsValidIndex(Index))
+        {
+            FString ResultJson;
+            const TSharedPtr<FJsonObject>* ResultObject;
+            if ((*ResultsArray)[Index]->TryGetObject(ResultObject) && ResultObject->IsValid())
+            {
+                TSharedRef<TJsonWriter<>> ResultWriter = TJsonWriterFactory<>::Create(&ResultJson);
+                FJsonSerializer::Serialize(ResultObject->ToSharedRef(), ResultWriter);
+                EmotionResponse = EmotionService->DeserializeResponse(ResultJson);
+                bHasResult = true;
+            }
+        }
+
+        (*Events)[Index]->OnComplete.ExecuteIfBound(bHasResult, EmotionResponse);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("AGLEventBatcher: Dispatched %d batch results"), Events->Num());
+}
+
+void UAGLEventBatcher::BeginDestroy()
+{
+    Shutdown();
+    Super::BeginDestroy();
+}
@@ -0,0 +1,378 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLJsonReader.h"
+
+FAGLJsonReader::FAGLJsonReader(FStringView InJson, FAGLJsonArena& InArena)
+    : Cursor(InJson.GetData())
+    , End(InJson.GetData() + InJson.Len())
+    , Arena(InArena)
+{
+}
+
+bool FAGLJsonReader::EnterObject()
+{
+    SkipWhitespace();
+    return Expect(TEXT('{'));
+}
+
+bool FAGLJsonReader::NextField(FStringView& OutKey)
+{
+    SkipWhitespace();
+    if (bError || Cursor >= End)
+    {
+        bError = true;
+        return false;
+    }
+
+    if (*Cursor == TEXT('}'))
+    {
+        ++Cursor;
+        return false;
+    }
+
+    // Lenient separator handling: the input comes from our own services
+    if (*Cursor == TEXT(','))
+    {
+        ++Cursor;
+        SkipWhitespace();
+    }
+
+    if (!ParseStringToken(OutKey))
+    {
+        return false;
+    }
+
+    SkipWhitespace();
+    return Expect(TEXT(':'));
+}
+
+bool FAGLJsonReader::EnterArray()
+{
+    SkipWhitespace();
+    return Expect(TEXT('['));
+}
+
+bool FAGLJsonReader::NextElement()
+{
+    SkipWhitespace();
+    if (bError || Cursor >= End)
+    {
+        bError = true;
+        return false;
+    }
+
+    if (*Cursor == TEXT(']'))
+    {
+        ++Cursor;
+        return false;
+    }
+
+    if (*Cursor == TEXT(','))
+    {
+        ++Cursor;
+        SkipWhitespace();
+    }
+
+    return true;
+}
+
+bool FAGLJsonReader::ReadString(FString& OutValue)
+{
+    SkipWhitespace();
+    if (Cursor < End && *Cursor == TEXT('n'))
+    {
+        // Null reads as "no value", matching TryGetStringField semantics
+        ConsumeKeyword(TEXT("null"));
+        return false;
+    }
+
+    FStringView View;
+    if (!ParseStringToken(View))
+    {
+        return false;
+    }
+
+    OutValue = FString(View);
+    return true;
+}
+
+bool FAGLJsonReader::ReadNumber(double& OutValue)
+{
+    return ParseNumberToken(OutValue);
+}
+
+bool FAGLJsonReader::ReadNumber(float& OutValue)
+{
+    double Value = 0.0;
+    if (!ParseNumberToken(Value))
+    {
+        return false;
+    }
+    OutValue = static_cast<float>(Value);
+    return true;
+}
+
+bool FAGLJsonReader::ReadNumber(int32& OutValue)
+{
+    double Value = 0.0;
+    if (!ParseNumberToken(Value))
+    {
+        return false;
+    }
+    OutValue = static_cast<int32>(Value);
+    return true;
+}
+
+bool FAGLJsonReader::ReadBool(bool& bOutValue)
+{
+    SkipWhitespace();
+    if (Cursor < End && *Cursor == TEXT('t'))
+    {
+        bOutValue = true;
+        return ConsumeKeyword(TEXT("true"));
+    }
+    if (Cursor < End && *Cursor == TEXT('f'))
+    {
+        bOutValue = false;
+        return ConsumeKeyword(TEXT("false"));
+    }
+
+    bError = true;
+    return false;
+}
+
+bool FAGLJsonReader::SkipValue()
+{
+    SkipWhitespace();
+    if (bError || Cursor >= End)
+    {
+        bError = true;
+        return false;
+    }
+
+    switch (*Cursor)
+    {
+        case TEXT('"'):
+        {
+            FStringView Ignored;
+            return ParseStringToken(Ignored);
+        }
+
+        case TEXT('{'):
+        case TEXT('['):
+        {
+            // Walk nested containers by depth, skipping strings whole so
+            // braces inside them do not count
+            int32 Depth = 0;
+            while (Cursor < End)
+            {
+                const TCHAR Char = *Cursor;
+                if (Char == TEXT('"'))
+                {
+                    FStringView Ignored;
+                    if (!ParseStringToken(Ignored))
+                    {
+                        return false;
+                    }
+                    continue;
+                }
+
+                ++Cursor;
+                if (Char == TEXT('{') || Char == TEXT('['))
+                {
+                    ++Depth;
+                }
+                else if (Char == TEXT('}') || Char == TEXT(']'))
+                {
+                    if (--Depth == 0)
+                    {
+                        return true;
+                    }
+                }
+            }
+            bError = true;
+            return false;
+        }
+
+        case TEXT('t'):
+            return ConsumeKeyword(TEXT("true"));
+
+        case TEXT('f'):
+            return ConsumeKeyword(TEXT("false"));
+
+        case TEXT('n'):
+            return ConsumeKeyword(TEXT("null"));
+
+        default:
+        {
+            double Ignored = 0.0;
+            return ParseNumberToken(Ignored);
+        }
+    }
+}
+
+void FAGLJsonReader::SkipWhitespace()
+{
+    while (Cursor < End && (*Cursor == TEXT(' ') || *Cursor == TEXT('\t') || *Cursor == TEXT('\n') || *Cursor == TEXT('\r')))
+    {
+        ++Cursor;
+    }
+}
+
+bool FAGLJsonReader::Expect(TCHAR Char)
+{
+    if (Cursor < End && *Cursor == Char)
+    {
+        ++Cursor;
+        return true;
+    }
+
+    bError = true;
+    return false;
+}
+
+bool FAGLJsonReader::ParseStringToken(FStringView& OutView)
+{
+    SkipWhitespace();
+    if (!Expect(TEXT('"')))
+    {
+        return false;
+    }
+
+    // Fast path: a string without escapes is a slice of the source
+    const TCHAR* Start = Cursor;
+    while (Cursor < End && *Cursor != TEXT('"') && *Cursor != TEXT('\\'))
+    {
+        ++Cursor;
+    }
+
+    if (Cursor < End && *Cursor == TEXT('"'))
+    {
+        OutView = FStringView(Start, UE_PTRDIFF_TO_INT32(Cursor - Start));
+        ++Cursor;
+        return true;
+    }
+
+    // Escapes present: decode into the arena scratch. Only one token is
+    // live at a time, so the scratch restarts for each decode
+    TArray<TCHAR, TInlineAllocator<256>>& Scratch = Arena.Scratch;
+    Scratch.Reset();
+    Scratch.Append(Start, UE_PTRDIFF_TO_INT32(Cursor - Start));
+
+    while (Cursor < End && *Cursor != TEXT('"'))
+    {
+        TCHAR Char = *Cursor++;
+        if (Char != TEXT('\\'))
+        {
+            Scratch.Add(Char);
+            continue;
+        }
+
+        if (Cursor >= End)
+        {
+            bError = true;
+            return false;
+        }
+
+        const TCHAR Escape = *Cursor++;
+        switch (Escape)
+        {
+            case TEXT('"'):  Scratch.Add(TEXT('"'));  break;
+            case TEXT('\\'): Scratch.Add(TEXT('\\')); break;
+            case TEXT('/'):  Scratch.Add(TEXT('/'));  break;
+            case TEXT('b'):  Scratch.Add(TEXT('\b')); break;
+            case TEXT('f'):  Scratch.Add(TEXT('\f')); break;
+            case TEXT('n'):  Scratch.Add(TEXT('\n')); break;
+            case TEXT('r'):  Scratch.Add(TEXT('\r')); break;
+            case TEXT('t'):  Scratch.Add(TEXT('\t')); break;
+
+            case TEXT('u'):
+            {
+                if (End - Cursor < 4)
+                {
+                    bError = true;
+                    return false;
+                }
+
+                // Surrogate pairs arrive as two \u escapes; appending each
+                // code unit reassembles them in UTF-16 storage
+                int32 CodeUnit = 0;
+                for (int32 Index = 0; Index < 4; ++Index)
+                {
+                    const TCHAR Hex = *Cursor++;
+                    CodeUnit <<= 4;
+                    if (Hex >= TEXT('0') && Hex <= TEXT('9')) { CodeUnit += Hex - TEXT('0'); }
+                    else if (Hex >= TEXT('a') && Hex <= TEXT('f')) { CodeUnit += 10 + Hex - TEXT('a'); }
+                    else if (Hex >= TEXT('A') && Hex <= TEXT('F')) { CodeUnit += 10 + Hex - TEXT('A'); }
+                    else
+                    {
+                        bError = true;
+                        return false;
+                    }
+                }
+                Scratch.Add(static_cast<TCHAR>(CodeUnit));
+                break;
+            }
+
+            default:
+                bError = true;
+                return false;
+        }
+    }
+
+    if (!Expect(TEXT('"')))
+    {
+        return false;
+    }
+
+    OutView = FStringView(Scratch.GetData(), Scratch.Num());
+    return true;
+}
+
+bool FAGLJsonReader::ParseNumberToken(double& OutValue)
+{
+    SkipWhitespace();
+
+    const TCHAR* Start = Cursor;
+    while (Cursor < End)
+    {
+        const TCHAR Char = *Cursor;
+        const bool bNumberChar = (Char >= TEXT('0') && Char <= TEXT('9'))
+            || Char == TEXT('-') || Char == TEXT('+') || Char == TEXT('.')
+            || Char == TEXT('e') || Char == TEXT('E');
+        if (!bNumberChar)
+        {
+            break;
+        }
+        ++Cursor;
+    }
+
+    if (Cursor == Start)
+    {
+        bError = true;
+        return false;
+    }
+
+    // Atod needs a terminator, so the token goes through the scratch
+    TArray<TCHAR, TInlineAllocator<256>>& Scratch = Arena.Scratch;
+    Scratch.Reset();
+    Scratch.Append(Start, UE_PTRDIFF_TO_INT32(Cursor - Start));
+    Scratch.Add(TEXT('\0'));
+
+    OutValue = FCString::Atod(Scratch.GetData());
+    return true;
+}
+
+bool FAGLJsonReader::ConsumeKeyword(const TCHAR* Keyword)
+{
+    SkipWhitespace();
+    const int32 Length = FCString::Strlen(Keyword);
+    if (End - Cursor >= Length && FCString::Strncmp(Cursor, Keyword, Length) == 0)
+    {
+        Cursor += Length;
+        return true;
+    }
+
+    bError = true;
+    return false;
+}
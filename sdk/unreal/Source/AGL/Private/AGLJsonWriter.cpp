@@ -0,0 +1,147 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLJsonWriter.h"
+
+void FAGLJsonWriter::BeginObject()
+{
+    WriteSeparator();
+    Builder.AppendChar(TEXT('{'));
+    CommaStack.Push(false);
+}
+
+void FAGLJsonWriter::BeginObject(const TCHAR* Key)
+{
+    WriteKey(Key);
+    Builder.AppendChar(TEXT('{'));
+    CommaStack.Push(false);
+}
+
+void FAGLJsonWriter::EndObject()
+{
+    Builder.AppendChar(TEXT('}'));
+    CommaStack.Pop();
+}
+
+void FAGLJsonWriter::BeginArray(const TCHAR* Key)
+{
+    WriteKey(Key);
+    Builder.AppendChar(TEXT('['));
+    CommaStack.Push(false);
+}
+
+void FAGLJsonWriter::EndArray()
+{
+    Builder.AppendChar(TEXT(']'));
+    CommaStack.Pop();
+}
+
+void FAGLJsonWriter::WriteString(const TCHAR* Key, const FString& Value)
+{
+    WriteKey(Key);
+    Builder.AppendChar(TEXT('"'));
+    AppendEscaped(Value);
+    Builder.AppendChar(TEXT('"'));
+}
+
+void FAGLJsonWriter::WriteArrayString(const FString& Value)
+{
+    WriteSeparator();
+    Builder.AppendChar(TEXT('"'));
+    AppendEscaped(Value);
+    Builder.AppendChar(TEXT('"'));
+}
+
+void FAGLJsonWriter::WriteBool(const TCHAR* Key, bool bValue)
+{
+    WriteKey(Key);
+    Builder.Append(bValue ? TEXT("true") : TEXT("false"));
+}
+
+void FAGLJsonWriter::WriteNumber(const TCHAR* Key, int32 Value)
+{
+    WriteKey(Key);
+    Builder.Appendf(TEXT("%d"), Value);
+}
+
+void FAGLJsonWriter::WriteNumber(const TCHAR* Key, float Value)
+{
+    WriteKey(Key);
+
+    // Match FJsonSerializer: whole floats print without a decimal tail
+    if (FMath::IsNearlyEqual(Value, FMath::RoundToFloat(Value)))
+    {
+        Builder.Appendf(TEXT("%d"), FMath::RoundToInt(Value));
+    }
+    else
+    {
+        Builder.Appendf(TEXT("%g"), Value);
+    }
+}
+
+void FAGLJsonWriter::WriteMap(const TCHAR* Key, const TMap<FString, FString>& Map)
+{
+    BeginObject(Key);
+    for (const auto& Pair : Map)
+    {
+        WriteString(*Pair.Key, Pair.Value);
+    }
+    EndObject();
+}
+
+void FAGLJsonWriter::WriteMap(const TCHAR* Key, const FAGLKeyValueStore& Store)
+{
+    BeginObject(Key);
+    for (const FAGLKeyValuePair& Pair : Store)
+    {
+        WriteString(*Pair.Key, Pair.Value);
+    }
+    EndObject();
+}
+
+void FAGLJsonWriter::WriteKey(const TCHAR* Key)
+{
+    WriteSeparator();
+    Builder.AppendChar(TEXT('"'));
+    AppendEscaped(Key);
+    Builder.AppendChar(TEXT('"'));
+    Builder.AppendChar(TEXT(':'));
+}
+
+void FAGLJsonWriter::WriteSeparator()
+{
+    if (CommaStack.Num() > 0)
+    {
+        if (CommaStack.Top())
+        {
+            Builder.AppendChar(TEXT(','));
+        }
+        CommaStack.Top() = true;
+    }
+}
+
+void FAGLJsonWriter::AppendEscaped(FStringView Value)
+{
+    for (const TCHAR Char : Value)
+    {
+        switch (Char)
+        {
+            case TEXT('"'):  Builder.Append(TEXT("\\\"")); break;
+            case TEXT('\\'): Builder.Append(TEXT("\\\\")); break;
+            case TEXT('\n'): Builder.Append(TEXT("\\n")); break;
+            case TEXT('\t'): Builder.Append(TEXT("\\t")); break;
+            case TEXT('\r'): Builder.Append(TEXT("\\r")); break;
+            case TEXT('\f'): Builder.Append(TEXT("\\f")); break;
+            case TEXT('\b'): Builder.Append(TEXT("\\b")); break;
+            default:
+                if (Char < TEXT('\x20'))
+                {
+                    Builder.Appendf(TEXT("\\u%04x"), Char);
+                }
+                else
+                {
+                    Builder.AppendChar(Char);
+                }
+                break;
+        }
+    }
+}
@@ -0,0 +1,126 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLKeyValueStore.h"
+
+void FAGLKeyValueStore::Add(const FString& Key, const FString& Value)
+{
+    // Linear scan: entry counts stay in the single digits, where the
+    // scan is cheaper than any hashing
+    for (FAGLKeyValuePair& Pair : Pairs)
+    {
+        if (Pair.Key.Equals(Key, ESearchCase::CaseSensitive))
+        {
+            Pair.Value = Value;
+            return;
+        }
+    }
+
+    Pairs.Add({ Key, Value });
+}
+
+void FAGLKeyValueStore::Add(const TCHAR* Key, const FString& Value)
+{
+    for (FAGLKeyValuePair& Pair : Pairs)
+    {
+        if (FCString::Strcmp(*Pair.Key, Key) == 0)
+        {
+            Pair.Value = Value;
+            return;
+        }
+    }
+
+    Pairs.Add({ Key, Value });
+}
+
+const FString* FAGLKeyValueStore::Find(const TCHAR* Key) const
+{
+    for (const FAGLKeyValuePair& Pair : Pairs)
+    {
+        if (FCString::Strcmp(*Pair.Key, Key) == 0)
+        {
+            return &Pair.Value;
+        }
+    }
+    return nullptr;
+}
+
+FString FAGLKeyValueStore::FindRef(const TCHAR* Key) const
+{
+    const FString* Value = Find(Key);
+    return Value ? *Value : FString();
+}
+
+uint32 FAGLKeyValueStore::ComputeHash() const
+{
+    // XOR the pair hashes so entries added in any insertion order hash
+    // identically. StrCrc32 is case-sensitive, matching the lookup rules,
+    // where GetTypeHash(FString) would fold case
+    uint32 Hash = 0;
+    for (const FAGLKeyValuePair& Pair : Pairs)
+    {
+        Hash ^= HashCombine(FCrc::StrCrc32(*Pair.Key), FCrc::StrCrc32(*Pair.Value));
+    }
+    return Hash;
+}
+
+bool FAGLKeyValueStore::operator==(const FAGLKeyValueStore& Other) const
+{
+    if (Pairs.Num() != Other.Pairs.Num())
+    {
+        return false;
+    }
+
+    // Add keeps keys unique, so matching every entry in one direction is
+    // enough once the counts agree
+    for (const FAGLKeyValuePair& Pair : Pairs)
+    {
+        const FString* OtherValue = Other.Find(Pair.Key);
+        if (!OtherValue || !OtherValue->Equals(Pair.Value, ESearchCase::CaseSensitive))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FAGLKeyValueStore::Identical(const FAGLKeyValueStore* Other, uint32 PortFlags) const
+{
+    return Other && *this == *Other;
+}
+
+FAGLKeyValueStore UAGLKeyValueLibrary::MakeKeyValueStore(const TMap<FString, FString>& Map)
+{
+    FAGLKeyValueStore Store;
+    Store.Pairs.Reserve(Map.Num());
+    for (const auto& Pair : Map)
+    {
+        Store.Add(Pair.Key, Pair.Value);
+    }
+    return Store;
+}
+
+TMap<FString, FString> UAGLKeyValueLibrary::KeyValueStoreToMap(const FAGLKeyValueStore& Store)
+{
+    TMap<FString, FString> Map;
+    Map.Reserve(Store.Num());
+    for (const FAGLKeyValuePair& Pair : Store)
+    {
+        Map.Add(Pair.Key, Pair.Value);
+    }
+    return Map;
+}
+
+void UAGLKeyValueLibrary::SetKeyValue(FAGLKeyValueStore& Store, const FString& Key, const FString& Value)
+{
+    Store.Add(Key, Value);
+}
+
+FString UAGLKeyValueLibrary::GetKeyValue(const FAGLKeyValueStore& Store, const FString& Key)
+{
+    return Store.FindRef(Key);
+}
+
+int32 UAGLKeyValueLibrary::GetKeyValueCount(const FAGLKeyValueStore& Store)
+{
+    return Store.Num();
+}
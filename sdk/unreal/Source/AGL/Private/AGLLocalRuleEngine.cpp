@@ -0,0 +1,126 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLLocalRuleEngine.h"
+
+// High-traffic subset of the emotion service's 36-variant rule engine;
+// variants below the confidence threshold escalate to the cloud anyway,
+// so only the rules that can answer locally are ported.
+// Rules are evaluated top to bottom per event type, so more specific
+// conditions (streaks, MVP, legendary) must come before the fallbacks.
+const FAGLLocalRuleEngine::FRule FAGLLocalRuleEngine::Rules[] =
+{
+    // Victory
+    { EAGLEventType::Victory, TEXT("winStreak"), ECondition::IntAtLeast, 5, nullptr, EAGLEmotionType::Amazed,    1.0f,  TEXT("cheer"),     0.95f, TEXT("Five-game win streak") },
+    { EAGLEventType::Victory, TEXT("winStreak"), ECondition::IntAtLeast, 3, nullptr, EAGLEmotionType::Excited,   0.9f,  TEXT("cheer"),     0.92f, TEXT("Win streak going") },
+    { EAGLEventType::Victory, TEXT("mvp"),       ECondition::BoolTrue,   0, nullptr, EAGLEmotionType::Proud,     0.95f, TEXT("celebrate"), 0.95f, TEXT("MVP performance") },
+    { EAGLEventType::Victory, nullptr,           ECondition::Always,     0, nullptr, EAGLEmotionType::Happy,     0.8f,  TEXT("celebrate"), 0.9f,  TEXT("Victory") },
+
+    // Defeat
+    { EAGLEventType::Defeat, TEXT("lossStreak"), ECondition::IntAtLeast, 5, nullptr, EAGLEmotionType::Frustrated,   0.9f, TEXT("comfort"),   0.92f, TEXT("Long loss streak") },
+    { EAGLEventType::Defeat, TEXT("lossStreak"), ECondition::IntAtLeast, 3, nullptr, EAGLEmotionType::Worried,      0.7f, TEXT("encourage"), 0.9f,  TEXT("Loss streak building") },
+    { EAGLEventType::Defeat, nullptr,            ECondition::Always,     0, nullptr, EAGLEmotionType::Disappointed, 0.6f, TEXT("comfort"),   0.88f, TEXT("Defeat") },
+
+    // Kill
+    { EAGLEventType::Kill, TEXT("isLegendary"), ECondition::BoolTrue,    0, nullptr, EAGLEmotionType::Amazed,  1.0f,  TEXT("amazed"), 0.95f, TEXT("Legendary kill") },
+    { EAGLEventType::Kill, TEXT("killCount"),   ECondition::IntAtLeast, 10, nullptr, EAGLEmotionType::Excited, 0.95f, TEXT("cheer"),  0.93f, TEXT("Killing spree") },
+    { EAGLEventType::Kill, TEXT("killCount"),   ECondition::IntAtLeast,  5, nullptr, EAGLEmotionType::Excited, 0.85f, TEXT("cheer"),  0.9f,  TEXT("Multi-kill run") },
+    { EAGLEventType::Kill, nullptr,             ECondition::Always,      0, nullptr, EAGLEmotionType::Happy,   0.6f,  TEXT("nod"),    0.88f, TEXT("Kill") },
+
+    // Death
+    { EAGLEventType::Death, TEXT("deathStreak"), ECondition::IntAtLeast, 3, nullptr, EAGLEmotionType::Worried, 0.8f, TEXT("comfort"),   0.9f,  TEXT("Repeated deaths") },
+    { EAGLEventType::Death, nullptr,             ECondition::Always,     0, nullptr, EAGLEmotionType::Sad,     0.5f, TEXT("encourage"), 0.88f, TEXT("Death") },
+
+    // Achievement
+    { EAGLEventType::Achievement, TEXT("rarity"), ECondition::StringEquals, 0, TEXT("legendary"), EAGLEmotionType::Amazed,    1.0f,  TEXT("amazed"),    0.95f, TEXT("Legendary achievement") },
+    { EAGLEventType::Achievement, TEXT("rarity"), ECondition::StringEquals, 0, TEXT("epic"),      EAGLEmotionType::Excited,   0.9f,  TEXT("celebrate"), 0.93f, TEXT("Epic achievement") },
+    { EAGLEventType::Achievement, nullptr,        ECondition::Always,       0, nullptr,           EAGLEmotionType::Proud,     0.75f, TEXT("applaud"),   0.9f,  TEXT("Achievement unlocked") },
+
+    // Level up
+    { EAGLEventType::LevelUp, TEXT("level"), ECondition::IntAtLeast, 50, nullptr, EAGLEmotionType::Amazed, 0.95f, TEXT("celebrate"), 0.92f, TEXT("Major level milestone") },
+    { EAGLEventType::LevelUp, nullptr,       ECondition::Always,      0, nullptr, EAGLEmotionType::Happy,  0.7f,  TEXT("applaud"),   0.9f,  TEXT("Level up") },
+
+    // Loot
+    { EAGLEventType::Loot, TEXT("rarity"), ECondition::StringEquals, 0, TEXT("legendary"), EAGLEmotionType::Amazed,    1.0f,  TEXT("amazed"), 0.95f, TEXT("Legendary loot") },
+    { EAGLEventType::Loot, TEXT("rarity"), ECondition::StringEquals, 0, TEXT("epic"),      EAGLEmotionType::Excited,   0.85f, TEXT("cheer"),  0.92f, TEXT("Epic loot") },
+    { EAGLEventType::Loot, nullptr,        ECondition::Always,       0, nullptr,           EAGLEmotionType::Satisfied, 0.6f,  TEXT("nod"),    0.88f, TEXT("Loot acquired") },
+
+    // Session boundaries
+    { EAGLEventType::SessionStart, nullptr, ECondition::Always, 0, nullptr, EAGLEmotionType::Cheerful, 0.7f, TEXT("greet"),   0.95f, TEXT("Session started") },
+    { EAGLEventType::SessionEnd,   nullptr, ECondition::Always, 0, nullptr, EAGLEmotionType::Grateful, 0.6f, TEXT("wave"),    0.95f, TEXT("Session ended") },
+};
+
+const int32 FAGLLocalRuleEngine::NumRules = UE_ARRAY_COUNT(FAGLLocalRuleEngine::Rules);
+
+FAGLEmotionResponse FAGLLocalRuleEngine::Classify(const FAGLEmotionRequest& Request)
+{
+    FAGLEmotionResponse Response;
+
+    for (int32 Index = 0; Index < NumRules; ++Index)
+    {
+        const FRule& Rule = Rules[Index];
+
+        if (Rule.EventType != Request.EventType)
+        {
+            continue;
+        }
+
+        if (!MatchesCondition(Rule, Request.Data))
+        {
+            continue;
+        }
+
+        Response.Emotion = Rule.Emotion;
+        Response.Intensity = Rule.Intensity;
+        Response.Action = Rule.Action;
+        Response.Confidence = Rule.Confidence;
+        Response.Reasoning = Rule.Reasoning;
+        Response.Method = TEXT("rule");
+        Response.Cost = 0.0f;
+        Response.bCacheHit = false;
+        Response.LatencyMs = 0;
+        return Response;
+    }
+
+    // No rule matched: neutral with low confidence so callers escalate
+    Response.Emotion = EAGLEmotionType::Neutral;
+    Response.Intensity = 0.3f;
+    Response.Action = TEXT("idle");
+    Response.Confidence = 0.3f;
+    Response.Reasoning = TEXT("No matching rule");
+    Response.Method = TEXT("rule");
+    return Response;
+}
+
+int32 FAGLLocalRuleEngine::GetRuleCount()
+{
+    return NumRules;
+}
+
+bool FAGLLocalRuleEngine::MatchesCondition(const FRule& Rule, const FAGLKeyValueStore& Data)
+{
+    if (Rule.Condition == ECondition::Always)
+    {
+        return true;
+    }
+
+    const FString* Value = Data.Find(Rule.Field);
+    if (!Value)
+    {
+        return false;
+    }
+
+    switch (Rule.Condition)
+    {
+        case ECondition::IntAtLeast:
+            return FCString::Atoi(**Value) >= Rule.IntThreshold;
+
+        case ECondition::BoolTrue:
+            return Value->Equals(TEXT("true"), ESearchCase::IgnoreCase);
+
+        case ECondition::StringEquals:
+            return Value->Equals(Rule.StringValue, ESearchCase::IgnoreCase);
+
+        default:
+            return false;
+    }
+}
@@ -1,41 +1,301 @@
 // Copyright AGL Team. All Rights Reserved.
 
 #include "AGLMemoryService.h"
+#include "AGLConnectionPool.h"
+#include "AGLMemoryWriteQueue.h"
+#include "AGLJsonReader.h"
+#include "AGLJsonWriter.h"
+#include "AGLMessagePack.h"
+#include "AGLMetrics.h"
+#include "AGLRealtimeTransport.h"
+#include "AGLRequestScheduler.h"
+#include "AGLOfflineJournal.h"
+#include "AGLCallbackDispatcher.h"
+#include "AGLCompression.h"
+#include "AGLWireNames.h"
+#include "Async/Async.h"
 #include "HttpModule.h"
 #include "Interfaces/IHttpResponse.h"
 #include "Json.h"
 #include "JsonUtilities.h"
 
-void UAGLMemoryService::Initialize(const FString& InServiceUrl, const FString& InApiKey, float InTimeout)
+// Memory responses carry no server-side latency field, so the metric
+// records the client-observed round trip instead
+static void RecordMemoryMetric(const TCHAR* Method, FHttpRequestPtr Request, FHttpResponsePtr Response)
+{
+    FAGLMetricRecord MetricRecord;
+    MetricRecord.Method = FName(Method);
+    MetricRecord.LatencyMs = Request.IsValid() ? FMath::RoundToInt(Request->GetElapsedTime() * 1000.0f) : 0;
+    MetricRecord.PayloadBytes = Response->GetContent().Num();
+    FAGLMetrics::Get().Record(EAGLMetricService::Memory, MetricRecord);
+}
+
+static bool ParseMemoryObject(FAGLJsonReader& Reader, FAGLMemory& OutMemory);
+
+void UAGLMemoryService::Initialize(const FString& InServiceUrl, const FString& InApiKey, float InTimeout, UAGLConnectionPool* InConnectionPool)
 {
     ServiceUrl = InServiceUrl;
     ApiKey = InApiKey;
     Timeout = InTimeout;
+    ConnectionPool = InConnectionPool;
 
     UE_LOG(LogTemp, Log, TEXT("AGLMemoryService initialized with URL: %s"), *ServiceUrl);
 }
 
+TSharedRef<IHttpRequest, ESPMode::ThreadSafe> UAGLMemoryService::CreateHttpRequest()
+{
+    return ConnectionPool ? ConnectionPool->AcquireRequest(ServiceUrl) : FHttpModule::Get().CreateRequest();
+}
+
+void UAGLMemoryService::ReleaseHttpRequest(FHttpRequestPtr Request)
+{
+    if (ConnectionPool && Request.IsValid())
+    {
+        ConnectionPool->ReleaseRequest(ServiceUrl, Request.ToSharedRef());
+    }
+}
+
+void UAGLMemoryService::SetRealtimeTransport(UAGLRealtimeTransport* InTransport)
+{
+    RealtimeTransport = InTransport;
+}
+
+void UAGLMemoryService::SetBinaryEncoding(bool bInUseBinaryEncoding)
+{
+    bUseBinaryEncoding = bInUseBinaryEncoding;
+}
+
+void UAGLMemoryService::SetRequestScheduler(UAGLRequestScheduler* InScheduler)
+{
+    RequestScheduler = InScheduler;
+}
+
+void UAGLMemoryService::SetWriteQueue(UAGLMemoryWriteQueue* InWriteQueue)
+{
+    WriteQueue = InWriteQueue;
+}
+
+void UAGLMemoryService::SetOfflineJournal(UAGLOfflineJournal* InJournal)
+{
+    OfflineJournal = InJournal;
+}
+
+void UAGLMemoryService::SetCompression(bool bInUseCompression, bool bInCompressRequestBodies, int32 InMinRequestBytes)
+{
+    bUseCompression = bInUseCompression;
+    bCompressRequestBodies = bInCompressRequestBodies;
+    CompressionMinRequestBytes = FMath::Max(0, InMinRequestBytes);
+}
+
+void UAGLMemoryService::SetCallbackDispatcher(UAGLCallbackDispatcher* InDispatcher)
+{
+    CallbackDispatcher = InDispatcher;
+}
+
+void UAGLMemoryService::FinishCreateMemory(bool bSuccess, const FAGLMemory& Memory, const FOnMemoryCreated& Callback)
+{
+    if (CallbackDispatcher)
+    {
+        CallbackDispatcher->Dispatch(EAGLCallbackLane::Memory,
+            [bSuccess, Memory, Callback]()
+            {
+                Callback.ExecuteIfBound(bSuccess, Memory);
+            });
+        return;
+    }
+
+    Callback.ExecuteIfBound(bSuccess, Memory);
+}
+
+void UAGLMemoryService::FinishSearchMemories(bool bSuccess, const TArray<FAGLMemorySearchResult>& Results, const FOnMemorySearchComplete& Callback)
+{
+    if (CallbackDispatcher)
+    {
+        CallbackDispatcher->Dispatch(EAGLCallbackLane::Memory,
+            [bSuccess, Results, Callback]()
+            {
+                Callback.ExecuteIfBound(bSuccess, Results);
+            });
+        return;
+    }
+
+    Callback.ExecuteIfBound(bSuccess, Results);
+}
+
+void UAGLMemoryService::FinishGetMemories(bool bSuccess, const TArray<FAGLMemory>& Memories, const FOnGetMemoriesComplete& Callback)
+{
+    if (CallbackDispatcher)
+    {
+        CallbackDispatcher->Dispatch(EAGLCallbackLane::Memory,
+            [bSuccess, Memories, Callback]()
+            {
+                Callback.ExecuteIfBound(bSuccess, Memories);
+            });
+        return;
+    }
+
+    Callback.ExecuteIfBound(bSuccess, Memories);
+}
+
+void UAGLMemoryService::ConfigureContextCache(bool bInUseCache, float InTTLSeconds, int32 InMemoriesPerEntry)
+{
+    bUseContextCache = bInUseCache;
+    ContextCache.Configure(InTTLSeconds, InMemoriesPerEntry);
+
+    if (!bUseContextCache)
+    {
+        ContextCache.Reset();
+    }
+}
+
+void UAGLMemoryService::PrefetchContext(const FString& PlayerId, const TArray<FString>& EventTypes)
+{
+    if (!bUseContextCache)
+    {
+        return;
+    }
+
+    // Binding the cache to the player drops any previous session's
+    // entries, so stale context can never leak across players
+    ContextCache.SetPlayer(PlayerId);
+
+    for (const FString& EventType : EventTypes)
+    {
+        RevalidateContextEntry(PlayerId, EventType);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("AGLMemoryService: Prefetching context for player %s (%d event types)"), *PlayerId, EventTypes.Num());
+}
+
+void UAGLMemoryService::RevalidateContextEntry(const FString& PlayerId, const FString& EventType)
+{
+    // An unbound callback makes this a pure cache fill; the dispatch
+    // path stores the result and the no-op delegate is skipped
+    FAGLGetContextRequest Request;
+    Request.CurrentEvent = EventType;
+    GetContextOverHttp(PlayerId, Request, FOnGetMemoriesComplete(), EventType);
+}
+
 void UAGLMemoryService::CreateMemory(const FString& PlayerId, const FAGLCreateMemoryRequest& Request, FOnMemoryCreated OnComplete)
 {
-    // Create HTTP request
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+    // Write-behind mode: accumulate locally and upload in bulk; the
+    // queue fires this delegate once the bulk response lands
+    if (WriteQueue)
+    {
+        WriteQueue->EnqueueMemory(PlayerId, Request, OnComplete);
+        return;
+    }
+
+    // Memory writes are background traffic: under burst load they queue
+    // behind user-facing emotion and dialogue requests and drain as the
+    // connection budget frees up
+    if (RequestScheduler)
+    {
+        TWeakObjectPtr<UAGLMemoryService> WeakThis(this);
+        RequestScheduler->SubmitBackground([WeakThis, PlayerId, Request, OnComplete]()
+        {
+            if (WeakThis.IsValid())
+            {
+                WeakThis->SendCreateMemory(PlayerId, Request, OnComplete);
+            }
+        });
+        return;
+    }
+
+    SendCreateMemory(PlayerId, Request, OnComplete);
+}
+
+void UAGLMemoryService::SendCreateMemory(const FString& PlayerId, const FAGLCreateMemoryRequest& Request, FOnMemoryCreated OnComplete)
+{
+    // Multiplex over the persistent WebSocket when connected; a dropped
+    // or timed-out request retries once over HTTP
+    if (RealtimeTransport && RealtimeTransport->IsConnected())
+    {
+        FString JsonPayload = SerializeCreateMemoryRequest(Request);
+        FString Route = FString::Printf(TEXT("/players/%s/memories"), *PlayerId);
+        TWeakObjectPtr<UAGLMemoryService> WeakThis(this);
+        const bool bSent = RealtimeTransport->SendRequest(TEXT("memory"), Route, JsonPayload,
+            FOnRealtimeReply::CreateLambda([WeakThis, PlayerId, Request, OnComplete](bool bSuccess, const FString& Payload)
+            {
+                if (!WeakThis.IsValid())
+                {
+                    return;
+                }
+
+                if (bSuccess)
+                {
+                    WeakThis->DispatchCreateMemoryResponse(Payload, OnComplete);
+                }
+                else
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("AGLMemoryService: Realtime create memory failed, retrying over HTTP"));
+                    WeakThis->CreateMemoryOverHttp(PlayerId, Request, OnComplete);
+                }
+            }));
+
+        if (bSent)
+        {
+            return;
+        }
+    }
+
+    CreateMemoryOverHttp(PlayerId, Request, OnComplete);
+}
+
+void UAGLMemoryService::CreateMemoryOverHttp(const FString& PlayerId, const FAGLCreateMemoryRequest& Request, FOnMemoryCreated OnComplete)
+{
+    // Per-request state lives in a pooled context so the completion
+    // handler only captures an index instead of a fresh lambda closure
+    FAGLRequestContext& Context = RequestContextPool.Acquire();
+    Context.PlayerId = PlayerId;
+    Context.MemoryRequest = Request;
+    Context.OnMemoryCreated = OnComplete;
+
+    // Create HTTP request (pooled keep-alive connection when available)
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest();
 
     FString URL = FString::Printf(TEXT("%s/players/%s/memories"), *ServiceUrl, *PlayerId);
     HttpRequest->SetURL(URL);
     HttpRequest->SetVerb(TEXT("POST"));
-    HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
     HttpRequest->SetHeader(TEXT("X-API-Key"), ApiKey);
     HttpRequest->SetTimeout(Timeout);
+    if (bUseCompression)
+    {
+        HttpRequest->SetHeader(TEXT("Accept-Encoding"), FAGLCompression::ContentEncoding);
+    }
 
-    // Serialize request to JSON
-    FString JsonPayload = SerializeCreateMemoryRequest(Request);
-    HttpRequest->SetContentAsString(JsonPayload);
+    // Serialize request into the context's reused payload buffers:
+    // MessagePack in binary mode, JSON otherwise
+    if (bUseBinaryEncoding)
+    {
+        FAGLMessagePack::EncodeCreateMemoryRequest(Request, Context.BinaryPayload);
+        HttpRequest->SetHeader(TEXT("Content-Type"), FAGLMessagePack::ContentType);
+        HttpRequest->SetHeader(TEXT("Accept"), FAGLMessagePack::ContentType);
+    }
+    else
+    {
+        Context.StringPayload = SerializeCreateMemoryRequest(Request);
+        HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    }
+    Context.ApplyRequestBody(HttpRequest, bUseBinaryEncoding, bCompressRequestBodies, CompressionMinRequestBytes);
 
     // Bind response handler
     HttpRequest->OnProcessRequestComplete().BindLambda(
-        [this, OnComplete](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+        [this, ContextIndex = Context.PoolIndex](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
         {
-            HandleCreateMemoryResponse(Request, Response, bWasSuccessful, OnComplete);
+            FAGLRequestContext& Context = RequestContextPool.Get(ContextIndex);
+            const FOnMemoryCreated Callback = Context.OnMemoryCreated;
+
+            // Transport failure: journal the memory for replay once
+            // connectivity returns, so the companion does not forget it
+            if ((!bWasSuccessful || !Response.IsValid()) && OfflineJournal)
+            {
+                OfflineJournal->RecordCreateMemoryRequest(Context.PlayerId, Context.MemoryRequest);
+            }
+
+            RequestContextPool.Release(Context);
+
+            HandleCreateMemoryResponse(Request, Response, bWasSuccessful, Callback);
         }
     );
 
@@ -47,25 +307,85 @@ void UAGLMemoryService::CreateMemory(const FString& PlayerId, const FAGLCreateMe
 
 void UAGLMemoryService::SearchMemories(const FString& PlayerId, const FAGLSearchMemoriesRequest& Request, FOnMemorySearchComplete OnComplete)
 {
-    // Create HTTP request
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+    // Multiplex over the persistent WebSocket when connected; a dropped
+    // or timed-out request retries once over HTTP
+    if (RealtimeTransport && RealtimeTransport->IsConnected())
+    {
+        FString JsonPayload = SerializeSearchRequest(Request);
+        FString Route = FString::Printf(TEXT("/players/%s/memories/search"), *PlayerId);
+        TWeakObjectPtr<UAGLMemoryService> WeakThis(this);
+        const bool bSent = RealtimeTransport->SendRequest(TEXT("memory"), Route, JsonPayload,
+            FOnRealtimeReply::CreateLambda([WeakThis, PlayerId, Request, OnComplete](bool bSuccess, const FString& Payload)
+            {
+                if (!WeakThis.IsValid())
+                {
+                    return;
+                }
+
+                if (bSuccess)
+                {
+                    WeakThis->DispatchSearchResultsResponse(Payload, OnComplete);
+                }
+                else
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("AGLMemoryService: Realtime search failed, retrying over HTTP"));
+                    WeakThis->SearchMemoriesOverHttp(PlayerId, Request, OnComplete);
+                }
+            }));
+
+        if (bSent)
+        {
+            return;
+        }
+    }
+
+    SearchMemoriesOverHttp(PlayerId, Request, OnComplete);
+}
+
+void UAGLMemoryService::SearchMemoriesOverHttp(const FString& PlayerId, const FAGLSearchMemoriesRequest& Request, FOnMemorySearchComplete OnComplete)
+{
+    // Per-request state lives in a pooled context so the completion
+    // handler only captures an index instead of a fresh lambda closure
+    FAGLRequestContext& Context = RequestContextPool.Acquire();
+    Context.OnMemorySearch = OnComplete;
+
+    // Create HTTP request (pooled keep-alive connection when available)
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest();
 
     FString URL = FString::Printf(TEXT("%s/players/%s/memories/search"), *ServiceUrl, *PlayerId);
     HttpRequest->SetURL(URL);
     HttpRequest->SetVerb(TEXT("POST"));
-    HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
     HttpRequest->SetHeader(TEXT("X-API-Key"), ApiKey);
     HttpRequest->SetTimeout(Timeout);
+    if (bUseCompression)
+    {
+        HttpRequest->SetHeader(TEXT("Accept-Encoding"), FAGLCompression::ContentEncoding);
+    }
 
-    // Serialize request to JSON
-    FString JsonPayload = SerializeSearchRequest(Request);
-    HttpRequest->SetContentAsString(JsonPayload);
+    // Serialize request into the context's reused payload buffers:
+    // MessagePack in binary mode, JSON otherwise
+    if (bUseBinaryEncoding)
+    {
+        FAGLMessagePack::EncodeSearchMemoriesRequest(Request, Context.BinaryPayload);
+        HttpRequest->SetHeader(TEXT("Content-Type"), FAGLMessagePack::ContentType);
+        HttpRequest->SetHeader(TEXT("Accept"), FAGLMessagePack::ContentType);
+    }
+    else
+    {
+        Context.StringPayload = SerializeSearchRequest(Request);
+        HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    }
+    Context.ApplyRequestBody(HttpRequest, bUseBinaryEncoding, bCompressRequestBodies, CompressionMinRequestBytes);
 
     // Bind response handler
     HttpRequest->OnProcessRequestComplete().BindLambda(
-        [this, OnComplete](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+        [this, ContextIndex = Context.PoolIndex](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
         {
-            HandleSearchMemoriesResponse(Request, Response, bWasSuccessful, OnComplete);
+            FAGLRequestContext& Context = RequestContextPool.Get(ContextIndex);
+            const FOnMemorySearchComplete Callback = Context.OnMemorySearch;
+            RequestContextPool.Release(Context);
+
+            HandleSearchMemoriesResponse(Request, Response, bWasSuccessful, Callback);
         }
     );
 
@@ -77,25 +397,122 @@ void UAGLMemoryService::SearchMemories(const FString& PlayerId, const FAGLSearch
 
 void UAGLMemoryService::GetContext(const FString& PlayerId, const FAGLGetContextRequest& Request, FOnGetMemoriesComplete OnComplete)
 {
-    // Create HTTP request
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+    // Serve from the session cache when warm: the dialogue that asked
+    // for this context gets it without the round trip, and a background
+    // refetch keeps the entry current for the next lookup
+    if (bUseContextCache)
+    {
+        TArray<FAGLMemory> CachedMemories;
+        if (ContextCache.TryGet(PlayerId, Request.CurrentEvent, CachedMemories))
+        {
+            FAGLMetricRecord MetricRecord;
+            MetricRecord.Method = FName(TEXT("get"));
+            MetricRecord.bCacheHit = true;
+            FAGLMetrics::Get().Record(EAGLMetricService::Memory, MetricRecord);
+
+            // The cache hit stays synchronous; the bypass drains any
+            // queued memory responses first so ordering holds
+            if (CallbackDispatcher)
+            {
+                CallbackDispatcher->Dispatch(EAGLCallbackLane::Memory,
+                    [OnComplete, CachedMemories]()
+                    {
+                        OnComplete.ExecuteIfBound(true, CachedMemories);
+                    },
+                    /*bBypassBudget*/ true);
+            }
+            else
+            {
+                OnComplete.ExecuteIfBound(true, CachedMemories);
+            }
+            RevalidateContextEntry(PlayerId, Request.CurrentEvent);
+            return;
+        }
+    }
+
+    // Multiplex over the persistent WebSocket when connected; a dropped
+    // or timed-out request retries once over HTTP
+    if (RealtimeTransport && RealtimeTransport->IsConnected())
+    {
+        FString JsonPayload = SerializeContextRequest(Request);
+        FString Route = FString::Printf(TEXT("/players/%s/memories/context"), *PlayerId);
+        TWeakObjectPtr<UAGLMemoryService> WeakThis(this);
+        const bool bSent = RealtimeTransport->SendRequest(TEXT("memory"), Route, JsonPayload,
+            FOnRealtimeReply::CreateLambda([WeakThis, PlayerId, Request, OnComplete](bool bSuccess, const FString& Payload)
+            {
+                if (!WeakThis.IsValid())
+                {
+                    return;
+                }
+
+                if (bSuccess)
+                {
+                    WeakThis->DispatchMemoriesResponse(Payload, OnComplete, Request.CurrentEvent, PlayerId);
+                }
+                else
+                {
+                    UE_LOG(LogTemp, Warning, TEXT("AGLMemoryService: Realtime context failed, retrying over HTTP"));
+                    WeakThis->GetContextOverHttp(PlayerId, Request, OnComplete, Request.CurrentEvent);
+                }
+            }));
+
+        if (bSent)
+        {
+            return;
+        }
+    }
+
+    GetContextOverHttp(PlayerId, Request, OnComplete, Request.CurrentEvent);
+}
+
+void UAGLMemoryService::GetContextOverHttp(const FString& PlayerId, const FAGLGetContextRequest& Request, FOnGetMemoriesComplete OnComplete, const FString& CacheEventType)
+{
+    // Per-request state lives in a pooled context so the completion
+    // handler only captures an index instead of a fresh lambda closure
+    FAGLRequestContext& Context = RequestContextPool.Acquire();
+    Context.PlayerId = PlayerId;
+    Context.CacheEventType = CacheEventType;
+    Context.OnGetMemories = OnComplete;
+
+    // Create HTTP request (pooled keep-alive connection when available)
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest();
 
     FString URL = FString::Printf(TEXT("%s/players/%s/memories/context"), *ServiceUrl, *PlayerId);
     HttpRequest->SetURL(URL);
     HttpRequest->SetVerb(TEXT("POST"));
-    HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
     HttpRequest->SetHeader(TEXT("X-API-Key"), ApiKey);
     HttpRequest->SetTimeout(Timeout);
+    if (bUseCompression)
+    {
+        HttpRequest->SetHeader(TEXT("Accept-Encoding"), FAGLCompression::ContentEncoding);
+    }
 
-    // Serialize request to JSON
-    FString JsonPayload = SerializeContextRequest(Request);
-    HttpRequest->SetContentAsString(JsonPayload);
+    // Serialize request into the context's reused payload buffers:
+    // MessagePack in binary mode, JSON otherwise
+    if (bUseBinaryEncoding)
+    {
+        FAGLMessagePack::EncodeGetContextRequest(Request, Context.BinaryPayload);
+        HttpRequest->SetHeader(TEXT("Content-Type"), FAGLMessagePack::ContentType);
+        HttpRequest->SetHeader(TEXT("Accept"), FAGLMessagePack::ContentType);
+    }
+    else
+    {
+        Context.StringPayload = SerializeContextRequest(Request);
+        HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    }
+    Context.ApplyRequestBody(HttpRequest, bUseBinaryEncoding, bCompressRequestBodies, CompressionMinRequestBytes);
 
     // Bind response handler
     HttpRequest->OnProcessRequestComplete().BindLambda(
-        [this, OnComplete](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+        [this, ContextIndex = Context.PoolIndex](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
         {
-            HandleGetMemoriesResponse(Request, Response, bWasSuccessful, OnComplete);
+            FAGLRequestContext& Context = RequestContextPool.Get(ContextIndex);
+            const FOnGetMemoriesComplete Callback = Context.OnGetMemories;
+            const FString CacheEventType = Context.CacheEventType;
+            const FString CachePlayerId = Context.PlayerId;
+            RequestContextPool.Release(Context);
+
+            HandleGetMemoriesResponse(Request, Response, bWasSuccessful, Callback, CacheEventType, CachePlayerId);
         }
     );
 
@@ -107,22 +524,39 @@ void UAGLMemoryService::GetContext(const FString& PlayerId, const FAGLGetContext
 
 void UAGLMemoryService::GetMemories(const FString& PlayerId, int32 Limit, int32 Offset, FOnGetMemoriesComplete OnComplete)
 {
-    // Create HTTP request
-    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+    // Per-request state lives in a pooled context so the completion
+    // handler only captures an index instead of a fresh lambda closure
+    FAGLRequestContext& Context = RequestContextPool.Acquire();
+    Context.OnGetMemories = OnComplete;
+
+    // Create HTTP request (pooled keep-alive connection when available)
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = CreateHttpRequest();
 
     FString URL = FString::Printf(TEXT("%s/players/%s/memories?limit=%d&offset=%d"),
         *ServiceUrl, *PlayerId, Limit, Offset);
     HttpRequest->SetURL(URL);
     HttpRequest->SetVerb(TEXT("GET"));
     HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    if (bUseBinaryEncoding)
+    {
+        HttpRequest->SetHeader(TEXT("Accept"), FAGLMessagePack::ContentType);
+    }
+    if (bUseCompression)
+    {
+        HttpRequest->SetHeader(TEXT("Accept-Encoding"), FAGLCompression::ContentEncoding);
+    }
     HttpRequest->SetHeader(TEXT("X-API-Key"), ApiKey);
     HttpRequest->SetTimeout(Timeout);
 
     // Bind response handler
     HttpRequest->OnProcessRequestComplete().BindLambda(
-        [this, OnComplete](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+        [this, ContextIndex = Context.PoolIndex](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
         {
-            HandleGetMemoriesResponse(Request, Response, bWasSuccessful, OnComplete);
+            FAGLRequestContext& Context = RequestContextPool.Get(ContextIndex);
+            const FOnGetMemoriesComplete Callback = Context.OnGetMemories;
+            RequestContextPool.Release(Context);
+
+            HandleGetMemoriesResponse(Request, Response, bWasSuccessful, Callback);
         }
     );
 
@@ -138,39 +572,219 @@ void UAGLMemoryService::HandleCreateMemoryResponse(
     bool bWasSuccessful,
     FOnMemoryCreated Callback)
 {
+    ReleaseHttpRequest(Request);
+
     if (!bWasSuccessful || !Response.IsValid())
     {
         UE_LOG(LogTemp, Error, TEXT("AGLMemoryService: Create memory request failed"));
+        FAGLMetrics::Get().RecordFailure(EAGLMetricService::Memory);
+        ReleaseSchedulerSlot();
         FAGLMemory EmptyMemory;
-        Callback.ExecuteIfBound(false, EmptyMemory);
+        FinishCreateMemory(false, EmptyMemory, Callback);
         return;
     }
 
     if (Response->GetResponseCode() != 200 && Response->GetResponseCode() != 201)
     {
         UE_LOG(LogTemp, Error, TEXT("AGLMemoryService: Server returned error %d"), Response->GetResponseCode());
+        FAGLMetrics::Get().RecordFailure(EAGLMetricService::Memory);
+        ReleaseSchedulerSlot();
         FAGLMemory EmptyMemory;
-        Callback.ExecuteIfBound(false, EmptyMemory);
+        FinishCreateMemory(false, EmptyMemory, Callback);
         return;
     }
 
-    // Parse response
-    FString ResponseContent = Response->GetContentAsString();
-    TSharedPtr<FJsonObject> JsonObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseContent);
+    RecordMemoryMetric(TEXT("create"), Request, Response);
+
+    const bool bGzipped = Response->GetHeader(TEXT("Content-Encoding")).Contains(TEXT("gzip"));
 
-    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    if (bUseBinaryEncoding && Response->GetContentType().Contains(TEXT("msgpack")))
     {
-        UE_LOG(LogTemp, Error, TEXT("Failed to parse create memory response JSON"));
-        FAGLMemory EmptyMemory;
-        Callback.ExecuteIfBound(false, EmptyMemory);
-        return;
+        DispatchCreateMemoryResponseBinary(Response->GetContent(), Callback, bGzipped);
+    }
+    else if (bGzipped)
+    {
+        DispatchCreateMemoryResponseCompressed(Response->GetContent(), Callback);
     }
+    else
+    {
+        DispatchCreateMemoryResponse(Response->GetContentAsString(), Callback);
+    }
+}
+
+void UAGLMemoryService::DispatchCreateMemoryResponseCompressed(TArray<uint8> ResponseBytes, FOnMemoryCreated Callback)
+{
+    // Inflate on the background task, then hand off to the plain JSON
+    // dispatcher so the parse path stays in one place
+    TWeakObjectPtr<UAGLMemoryService> WeakThis(this);
+    Async(EAsyncExecution::TaskGraph,
+        [WeakThis, ResponseBytes = MoveTemp(ResponseBytes), Callback]()
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+
+            TArray<uint8> Inflated;
+            if (!FAGLCompression::Decompress(ResponseBytes, Inflated))
+            {
+                UE_LOG(LogTemp, Error, TEXT("AGLMemoryService: Failed to inflate gzip memory response"));
+                AsyncTask(ENamedThreads::GameThread,
+                    [WeakThis, Callback]()
+                    {
+                        FAGLMemory EmptyMemory;
+                        if (WeakThis.IsValid())
+                        {
+                            WeakThis->ReleaseSchedulerSlot();
+                            WeakThis->FinishCreateMemory(false, EmptyMemory, Callback);
+                        }
+                        else
+                        {
+                            Callback.ExecuteIfBound(false, EmptyMemory);
+                        }
+                    });
+                return;
+            }
+
+            WeakThis->CompressedBytesReceived.Add(ResponseBytes.Num());
+            WeakThis->UncompressedBytesReceived.Add(Inflated.Num());
+
+            WeakThis->DispatchCreateMemoryResponse(FAGLCompression::BytesToString(Inflated), Callback);
+        });
+}
+
+void UAGLMemoryService::DispatchCreateMemoryResponseBinary(TArray<uint8> ResponseBytes, FOnMemoryCreated Callback, bool bGzipped)
+{
+    // Same threading as the JSON path; typed decode fills the struct
+    // directly without an FJsonObject tree
+    TWeakObjectPtr<UAGLMemoryService> WeakThis(this);
+    Async(EAsyncExecution::TaskGraph,
+        [WeakThis, ResponseBytes = MoveTemp(ResponseBytes), Callback, bGzipped]() mutable
+        {
+            if (bGzipped)
+            {
+                TArray<uint8> Inflated;
+                if (FAGLCompression::Decompress(ResponseBytes, Inflated))
+                {
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->CompressedBytesReceived.Add(ResponseBytes.Num());
+                        WeakThis->UncompressedBytesReceived.Add(Inflated.Num());
+                    }
+                    ResponseBytes = MoveTemp(Inflated);
+                }
+                else
+                {
+                    UE_LOG(LogTemp, Error, TEXT("AGLMemoryService: Failed to inflate gzip memory response"));
+                }
+            }
+
+            FAGLMemory Memory;
+            const bool bDecoded = FAGLMessagePack::DecodeMemory(ResponseBytes, Memory);
+
+            AsyncTask(ENamedThreads::GameThread,
+                [WeakThis, Callback, bDecoded, Memory = MoveTemp(Memory)]()
+                {
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->ReleaseSchedulerSlot();
+                    }
+
+                    if (!bDecoded)
+                    {
+                        UE_LOG(LogTemp, Error, TEXT("AGLMemoryService: Failed to decode MessagePack memory response"));
+                        if (WeakThis.IsValid())
+                        {
+                            WeakThis->FinishCreateMemory(false, Memory, Callback);
+                        }
+                        else
+                        {
+                            Callback.ExecuteIfBound(false, Memory);
+                        }
+                        return;
+                    }
+
+                    UE_LOG(LogTemp, Log, TEXT("AGLMemoryService: Memory created with ID %s"), *Memory.Id);
+                    if (WeakThis.IsValid())
+                    {
+                        if (WeakThis->bUseContextCache)
+                        {
+                            WeakThis->ContextCache.AddMemory(Memory.PlayerId, Memory);
+                        }
+                        WeakThis->FinishCreateMemory(true, Memory, Callback);
+                    }
+                    else
+                    {
+                        Callback.ExecuteIfBound(true, Memory);
+                    }
+                });
+        });
+}
 
-    FAGLMemory Memory = DeserializeMemory(JsonObject);
-    UE_LOG(LogTemp, Log, TEXT("AGLMemoryService: Memory created with ID %s"), *Memory.Id);
+void UAGLMemoryService::DispatchCreateMemoryResponse(FString ResponseContent, FOnMemoryCreated Callback)
+{
+    // Parse on a background task and marshal only the delegate execution
+    // back to the game thread
+    TWeakObjectPtr<UAGLMemoryService> WeakThis(this);
+    Async(EAsyncExecution::TaskGraph,
+        [WeakThis, ResponseContent = MoveTemp(ResponseContent), Callback]()
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+
+            // Stream the memory object straight into the typed struct
+            FAGLJsonArena Arena;
+            FAGLJsonReader Reader(ResponseContent, Arena);
+            FAGLMemory Memory;
+            const bool bParsed = ParseMemoryObject(Reader, Memory);
 
-    Callback.ExecuteIfBound(true, Memory);
+            AsyncTask(ENamedThreads::GameThread,
+                [WeakThis, Callback, bParsed, Memory = MoveTemp(Memory)]()
+                {
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->ReleaseSchedulerSlot();
+                    }
+
+                    if (!bParsed)
+                    {
+                        UE_LOG(LogTemp, Error, TEXT("Failed to parse create memory response JSON"));
+                        if (WeakThis.IsValid())
+                        {
+                            WeakThis->FinishCreateMemory(false, Memory, Callback);
+                        }
+                        else
+                        {
+                            Callback.ExecuteIfBound(false, Memory);
+                        }
+                        return;
+                    }
+
+                    UE_LOG(LogTemp, Log, TEXT("AGLMemoryService: Memory created with ID %s"), *Memory.Id);
+                    if (WeakThis.IsValid())
+                    {
+                        if (WeakThis->bUseContextCache)
+                        {
+                            WeakThis->ContextCache.AddMemory(Memory.PlayerId, Memory);
+                        }
+                        WeakThis->FinishCreateMemory(true, Memory, Callback);
+                    }
+                    else
+                    {
+                        Callback.ExecuteIfBound(true, Memory);
+                    }
+                });
+        });
+}
+
+void UAGLMemoryService::ReleaseSchedulerSlot()
+{
+    if (RequestScheduler)
+    {
+        RequestScheduler->NotifyRequestFinished();
+    }
 }
 
 void UAGLMemoryService::HandleSearchMemoriesResponse(
@@ -179,146 +793,466 @@ void UAGLMemoryService::HandleSearchMemoriesResponse(
     bool bWasSuccessful,
     FOnMemorySearchComplete Callback)
 {
+    ReleaseHttpRequest(Request);
+
     if (!bWasSuccessful || !Response.IsValid())
     {
         UE_LOG(LogTemp, Error, TEXT("AGLMemoryService: Search memories request failed"));
+        FAGLMetrics::Get().RecordFailure(EAGLMetricService::Memory);
         TArray<FAGLMemorySearchResult> EmptyResults;
-        Callback.ExecuteIfBound(false, EmptyResults);
+        FinishSearchMemories(false, EmptyResults, Callback);
         return;
     }
 
     if (Response->GetResponseCode() != 200)
     {
         UE_LOG(LogTemp, Error, TEXT("AGLMemoryService: Server returned error %d"), Response->GetResponseCode());
+        FAGLMetrics::Get().RecordFailure(EAGLMetricService::Memory);
         TArray<FAGLMemorySearchResult> EmptyResults;
-        Callback.ExecuteIfBound(false, EmptyResults);
+        FinishSearchMemories(false, EmptyResults, Callback);
         return;
     }
 
-    // Parse response
-    FString ResponseContent = Response->GetContentAsString();
-    TArray<FAGLMemorySearchResult> Results = DeserializeSearchResults(ResponseContent);
+    RecordMemoryMetric(TEXT("search"), Request, Response);
+
+    const bool bGzipped = Response->GetHeader(TEXT("Content-Encoding")).Contains(TEXT("gzip"));
+
+    if (bUseBinaryEncoding && Response->GetContentType().Contains(TEXT("msgpack")))
+    {
+        DispatchSearchResultsResponseBinary(Response->GetContent(), Callback, bGzipped);
+    }
+    else if (bGzipped)
+    {
+        DispatchSearchResultsResponseCompressed(Response->GetContent(), Callback);
+    }
+    else
+    {
+        DispatchSearchResultsResponse(Response->GetContentAsString(), Callback);
+    }
+}
+
+void UAGLMemoryService::DispatchSearchResultsResponseCompressed(TArray<uint8> ResponseBytes, FOnMemorySearchComplete Callback)
+{
+    // Inflate on the background task, then hand off to the plain JSON
+    // dispatcher so the parse path stays in one place
+    TWeakObjectPtr<UAGLMemoryService> WeakThis(this);
+    Async(EAsyncExecution::TaskGraph,
+        [WeakThis, ResponseBytes = MoveTemp(ResponseBytes), Callback]()
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+
+            TArray<uint8> Inflated;
+            if (!FAGLCompression::Decompress(ResponseBytes, Inflated))
+            {
+                UE_LOG(LogTemp, Error, TEXT("AGLMemoryService: Failed to inflate gzip search response"));
+                AsyncTask(ENamedThreads::GameThread,
+                    [WeakThis, Callback]()
+                    {
+                        TArray<FAGLMemorySearchResult> EmptyResults;
+                        if (WeakThis.IsValid())
+                        {
+                            WeakThis->FinishSearchMemories(false, EmptyResults, Callback);
+                        }
+                        else
+                        {
+                            Callback.ExecuteIfBound(false, EmptyResults);
+                        }
+                    });
+                return;
+            }
+
+            WeakThis->CompressedBytesReceived.Add(ResponseBytes.Num());
+            WeakThis->UncompressedBytesReceived.Add(Inflated.Num());
+
+            WeakThis->DispatchSearchResultsResponse(FAGLCompression::BytesToString(Inflated), Callback);
+        });
+}
+
+void UAGLMemoryService::DispatchSearchResultsResponseBinary(TArray<uint8> ResponseBytes, FOnMemorySearchComplete Callback, bool bGzipped)
+{
+    // Same threading as the JSON path; typed decode fills the structs
+    // directly without an FJsonObject tree
+    TWeakObjectPtr<UAGLMemoryService> WeakThis(this);
+    Async(EAsyncExecution::TaskGraph,
+        [WeakThis, ResponseBytes = MoveTemp(ResponseBytes), Callback, bGzipped]() mutable
+        {
+            if (bGzipped)
+            {
+                TArray<uint8> Inflated;
+                if (FAGLCompression::Decompress(ResponseBytes, Inflated))
+                {
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->CompressedBytesReceived.Add(ResponseBytes.Num());
+                        WeakThis->UncompressedBytesReceived.Add(Inflated.Num());
+                    }
+                    ResponseBytes = MoveTemp(Inflated);
+                }
+                else
+                {
+                    UE_LOG(LogTemp, Error, TEXT("AGLMemoryService: Failed to inflate gzip search response"));
+                }
+            }
+
+            TArray<FAGLMemorySearchResult> Results;
+            const bool bDecoded = FAGLMessagePack::DecodeSearchResultsResponse(ResponseBytes, Results);
+
+            AsyncTask(ENamedThreads::GameThread,
+                [WeakThis, Callback, bDecoded, Results = MoveTemp(Results)]()
+                {
+                    if (!bDecoded)
+                    {
+                        UE_LOG(LogTemp, Error, TEXT("AGLMemoryService: Failed to decode MessagePack search response"));
+                    }
+                    else
+                    {
+                        UE_LOG(LogTemp, Log, TEXT("AGLMemoryService: Found %d search results"), Results.Num());
+                    }
+
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->FinishSearchMemories(bDecoded, Results, Callback);
+                    }
+                    else
+                    {
+                        Callback.ExecuteIfBound(bDecoded, Results);
+                    }
+                });
+        });
+}
+
+void UAGLMemoryService::DispatchSearchResultsResponse(FString ResponseContent, FOnMemorySearchComplete Callback)
+{
+    // A 200-memory result is a visible frame hitch when parsed inline:
+    // deserialize on a background task, marshal the delegate back
+    TWeakObjectPtr<UAGLMemoryService> WeakThis(this);
+    Async(EAsyncExecution::TaskGraph,
+        [WeakThis, ResponseContent = MoveTemp(ResponseContent), Callback]()
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
 
-    UE_LOG(LogTemp, Log, TEXT("AGLMemoryService: Found %d search results"), Results.Num());
+            TArray<FAGLMemorySearchResult> Results = WeakThis->DeserializeSearchResults(ResponseContent);
 
-    Callback.ExecuteIfBound(true, Results);
+            AsyncTask(ENamedThreads::GameThread,
+                [WeakThis, Callback, Results = MoveTemp(Results)]()
+                {
+                    UE_LOG(LogTemp, Log, TEXT("AGLMemoryService: Found %d search results"), Results.Num());
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->FinishSearchMemories(true, Results, Callback);
+                    }
+                    else
+                    {
+                        Callback.ExecuteIfBound(true, Results);
+                    }
+                });
+        });
 }
 
 void UAGLMemoryService::HandleGetMemoriesResponse(
     FHttpRequestPtr Request,
     FHttpResponsePtr Response,
     bool bWasSuccessful,
-    FOnGetMemoriesComplete Callback)
+    FOnGetMemoriesComplete Callback,
+    FString CacheEventType,
+    FString CachePlayerId)
 {
+    ReleaseHttpRequest(Request);
+
     if (!bWasSuccessful || !Response.IsValid())
     {
         UE_LOG(LogTemp, Error, TEXT("AGLMemoryService: Get memories request failed"));
+        FAGLMetrics::Get().RecordFailure(EAGLMetricService::Memory);
         TArray<FAGLMemory> EmptyMemories;
-        Callback.ExecuteIfBound(false, EmptyMemories);
+        FinishGetMemories(false, EmptyMemories, Callback);
         return;
     }
 
     if (Response->GetResponseCode() != 200)
     {
         UE_LOG(LogTemp, Error, TEXT("AGLMemoryService: Server returned error %d"), Response->GetResponseCode());
+        FAGLMetrics::Get().RecordFailure(EAGLMetricService::Memory);
         TArray<FAGLMemory> EmptyMemories;
-        Callback.ExecuteIfBound(false, EmptyMemories);
+        FinishGetMemories(false, EmptyMemories, Callback);
         return;
     }
 
-    // Parse response
-    FString ResponseContent = Response->GetContentAsString();
-    TArray<FAGLMemory> Memories = DeserializeMemories(ResponseContent);
+    RecordMemoryMetric(TEXT("get"), Request, Response);
+
+    const bool bGzipped = Response->GetHeader(TEXT("Content-Encoding")).Contains(TEXT("gzip"));
+
+    if (bUseBinaryEncoding && Response->GetContentType().Contains(TEXT("msgpack")))
+    {
+        DispatchMemoriesResponseBinary(Response->GetContent(), Callback, MoveTemp(CacheEventType), MoveTemp(CachePlayerId), bGzipped);
+    }
+    else if (bGzipped)
+    {
+        DispatchMemoriesResponseCompressed(Response->GetContent(), Callback, MoveTemp(CacheEventType), MoveTemp(CachePlayerId));
+    }
+    else
+    {
+        DispatchMemoriesResponse(Response->GetContentAsString(), Callback, MoveTemp(CacheEventType), MoveTemp(CachePlayerId));
+    }
+}
+
+void UAGLMemoryService::DispatchMemoriesResponseCompressed(TArray<uint8> ResponseBytes, FOnGetMemoriesComplete Callback, FString CacheEventType, FString CachePlayerId)
+{
+    // Inflate on the background task, then hand off to the plain JSON
+    // dispatcher so the parse path stays in one place
+    TWeakObjectPtr<UAGLMemoryService> WeakThis(this);
+    Async(EAsyncExecution::TaskGraph,
+        [WeakThis, ResponseBytes = MoveTemp(ResponseBytes), Callback, CacheEventType = MoveTemp(CacheEventType), CachePlayerId = MoveTemp(CachePlayerId)]() mutable
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
+
+            TArray<uint8> Inflated;
+            if (!FAGLCompression::Decompress(ResponseBytes, Inflated))
+            {
+                UE_LOG(LogTemp, Error, TEXT("AGLMemoryService: Failed to inflate gzip memories response"));
+                AsyncTask(ENamedThreads::GameThread,
+                    [WeakThis, Callback]()
+                    {
+                        TArray<FAGLMemory> EmptyMemories;
+                        if (WeakThis.IsValid())
+                        {
+                            WeakThis->FinishGetMemories(false, EmptyMemories, Callback);
+                        }
+                        else
+                        {
+                            Callback.ExecuteIfBound(false, EmptyMemories);
+                        }
+                    });
+                return;
+            }
+
+            WeakThis->CompressedBytesReceived.Add(ResponseBytes.Num());
+            WeakThis->UncompressedBytesReceived.Add(Inflated.Num());
+
+            WeakThis->DispatchMemoriesResponse(FAGLCompression::BytesToString(Inflated), Callback, MoveTemp(CacheEventType), MoveTemp(CachePlayerId));
+        });
+}
+
+void UAGLMemoryService::DispatchMemoriesResponseBinary(TArray<uint8> ResponseBytes, FOnGetMemoriesComplete Callback, FString CacheEventType, FString CachePlayerId, bool bGzipped)
+{
+    // Same threading as the JSON path; typed decode fills the structs
+    // directly without an FJsonObject tree
+    TWeakObjectPtr<UAGLMemoryService> WeakThis(this);
+    Async(EAsyncExecution::TaskGraph,
+        [WeakThis, ResponseBytes = MoveTemp(ResponseBytes), Callback, CacheEventType = MoveTemp(CacheEventType), CachePlayerId = MoveTemp(CachePlayerId), bGzipped]() mutable
+        {
+            if (bGzipped)
+            {
+                TArray<uint8> Inflated;
+                if (FAGLCompression::Decompress(ResponseBytes, Inflated))
+                {
+                    if (WeakThis.IsValid())
+                    {
+                        WeakThis->CompressedBytesReceived.Add(ResponseBytes.Num());
+                        WeakThis->UncompressedBytesReceived.Add(Inflated.Num());
+                    }
+                    ResponseBytes = MoveTemp(Inflated);
+                }
+                else
+                {
+                    UE_LOG(LogTemp, Error, TEXT("AGLMemoryService: Failed to inflate gzip memories response"));
+                }
+            }
+
+            TArray<FAGLMemory> Memories;
+            const bool bDecoded = FAGLMessagePack::DecodeMemoriesResponse(ResponseBytes, Memories);
+
+            AsyncTask(ENamedThreads::GameThread,
+                [WeakThis, Callback, bDecoded, Memories = MoveTemp(Memories), CacheEventType = MoveTemp(CacheEventType), CachePlayerId = MoveTemp(CachePlayerId)]()
+                {
+                    if (!bDecoded)
+                    {
+                        UE_LOG(LogTemp, Error, TEXT("AGLMemoryService: Failed to decode MessagePack memories response"));
+                        if (WeakThis.IsValid())
+                        {
+                            WeakThis->FinishGetMemories(false, Memories, Callback);
+                        }
+                        else
+                        {
+                            Callback.ExecuteIfBound(false, Memories);
+                        }
+                        return;
+                    }
+
+                    UE_LOG(LogTemp, Log, TEXT("AGLMemoryService: Retrieved %d memories"), Memories.Num());
+                    if (WeakThis.IsValid())
+                    {
+                        if (WeakThis->bUseContextCache && !CacheEventType.IsEmpty())
+                        {
+                            WeakThis->ContextCache.Put(CachePlayerId, CacheEventType, Memories);
+                        }
+                        WeakThis->FinishGetMemories(true, Memories, Callback);
+                    }
+                    else
+                    {
+                        Callback.ExecuteIfBound(true, Memories);
+                    }
+                });
+        });
+}
+
+void UAGLMemoryService::DispatchMemoriesResponse(FString ResponseContent, FOnGetMemoriesComplete Callback, FString CacheEventType, FString CachePlayerId)
+{
+    // Deserialize on a background task, marshal the delegate back
+    TWeakObjectPtr<UAGLMemoryService> WeakThis(this);
+    Async(EAsyncExecution::TaskGraph,
+        [WeakThis, ResponseContent = MoveTemp(ResponseContent), Callback, CacheEventType = MoveTemp(CacheEventType), CachePlayerId = MoveTemp(CachePlayerId)]()
+        {
+            if (!WeakThis.IsValid())
+            {
+                return;
+            }
 
-    UE_LOG(LogTemp, Log, TEXT("AGLMemoryService: Retrieved %d memories"), Memories.Num());
+            TArray<FAGLMemory> Memories = WeakThis->DeserializeMemories(ResponseContent);
 
-    Callback.ExecuteIfBound(true, Memories);
+            AsyncTask(ENamedThreads::GameThread,
+                [WeakThis, Callback, Memories = MoveTemp(Memories), CacheEventType = MoveTemp(CacheEventType), CachePlayerId = MoveTemp(CachePlayerId)]()
+                {
+                    UE_LOG(LogTemp, Log, TEXT("AGLMemoryService: Retrieved %d memories"), Memories.Num());
+                    if (WeakThis.IsValid())
+                    {
+                        if (WeakThis->bUseContextCache && !CacheEventType.IsEmpty())
+                        {
+                            WeakThis->ContextCache.Put(CachePlayerId, CacheEventType, Memories);
+                        }
+                        WeakThis->FinishGetMemories(true, Memories, Callback);
+                    }
+                    else
+                    {
+                        Callback.ExecuteIfBound(true, Memories);
+                    }
+                });
+        });
 }
 
 FString UAGLMemoryService::MemoryTypeToString(EAGLMemoryType MemoryType)
 {
-    switch (MemoryType)
-    {
-        case EAGLMemoryType::Achievement: return TEXT("achievement");
-        case EAGLMemoryType::Milestone: return TEXT("milestone");
-        case EAGLMemoryType::FirstTime: return TEXT("first_time");
-        case EAGLMemoryType::Dramatic: return TEXT("dramatic");
-        case EAGLMemoryType::Conversation: return TEXT("conversation");
-        case EAGLMemoryType::Event: return TEXT("event");
-        case EAGLMemoryType::Observation: return TEXT("observation");
-        default: return TEXT("event");
-    }
+    return FAGLWireNames::MemoryTypeToString(MemoryType);
 }
 
 EAGLMemoryType UAGLMemoryService::StringToMemoryType(const FString& TypeString)
 {
-    if (TypeString == TEXT("achievement")) return EAGLMemoryType::Achievement;
-    if (TypeString == TEXT("milestone")) return EAGLMemoryType::Milestone;
-    if (TypeString == TEXT("first_time")) return EAGLMemoryType::FirstTime;
-    if (TypeString == TEXT("dramatic")) return EAGLMemoryType::Dramatic;
-    if (TypeString == TEXT("conversation")) return EAGLMemoryType::Conversation;
-    if (TypeString == TEXT("event")) return EAGLMemoryType::Event;
-    if (TypeString == TEXT("observation")) return EAGLMemoryType::Observation;
-    return EAGLMemoryType::Event;
+    return FAGLWireNames::StringToMemoryType(TypeString);
 }
 
 FString UAGLMemoryService::SerializeCreateMemoryRequest(const FAGLCreateMemoryRequest& Request)
 {
-    TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+    // Fixed-shape payload: write directly into a stack builder instead of
+    // allocating an FJsonObject tree
+    TStringBuilder<512> Builder;
+    FAGLJsonWriter Writer(Builder);
 
-    JsonObject->SetStringField(TEXT("type"), MemoryTypeToString(Request.Type));
-    JsonObject->SetStringField(TEXT("content"), Request.Content);
-    JsonObject->SetNumberField(TEXT("importance"), Request.Importance);
+    Writer.BeginObject();
+    Writer.WriteString(TEXT("type"), MemoryTypeToString(Request.Type));
+    Writer.WriteString(TEXT("content"), Request.Content);
+    Writer.WriteNumber(TEXT("importance"), Request.Importance);
 
     if (!Request.Emotion.IsEmpty())
     {
-        JsonObject->SetStringField(TEXT("emotion"), Request.Emotion);
+        Writer.WriteString(TEXT("emotion"), Request.Emotion);
     }
 
     // Add context object if not empty
     if (Request.Context.Num() > 0)
     {
-        TSharedPtr<FJsonObject> ContextObject = MakeShareable(new FJsonObject);
-        for (const auto& Pair : Request.Context)
-        {
-            ContextObject->SetStringField(Pair.Key, Pair.Value);
-        }
-        JsonObject->SetObjectField(TEXT("context"), ContextObject);
+        Writer.WriteMap(TEXT("context"), Request.Context);
     }
+    Writer.EndObject();
 
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
-
-    return OutputString;
+    return FString(Builder.ToString());
 }
 
 FString UAGLMemoryService::SerializeSearchRequest(const FAGLSearchMemoriesRequest& Request)
 {
-    TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
-
-    JsonObject->SetStringField(TEXT("query"), Request.Query);
-    JsonObject->SetNumberField(TEXT("limit"), Request.Limit);
+    TStringBuilder<256> Builder;
+    FAGLJsonWriter Writer(Builder);
 
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+    Writer.BeginObject();
+    Writer.WriteString(TEXT("query"), Request.Query);
+    Writer.WriteNumber(TEXT("limit"), Request.Limit);
+    Writer.EndObject();
 
-    return OutputString;
+    return FString(Builder.ToString());
 }
 
 FString UAGLMemoryService::SerializeContextRequest(const FAGLGetContextRequest& Request)
 {
-    TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+    TStringBuilder<256> Builder;
+    FAGLJsonWriter Writer(Builder);
+
+    Writer.BeginObject();
+    Writer.WriteString(TEXT("currentEvent"), Request.CurrentEvent);
+    Writer.WriteNumber(TEXT("limit"), Request.Limit);
+    Writer.EndObject();
+
+    return FString(Builder.ToString());
+}
 
-    JsonObject->SetStringField(TEXT("currentEvent"), Request.CurrentEvent);
-    JsonObject->SetNumberField(TEXT("limit"), Request.Limit);
+// Stream one memory object from the reader into the typed struct; the
+// reader is positioned on the opening brace
+static bool ParseMemoryObject(FAGLJsonReader& Reader, FAGLMemory& OutMemory)
+{
+    if (!Reader.EnterObject())
+    {
+        return false;
+    }
 
-    FString OutputString;
-    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+    FStringView Key;
+    while (Reader.NextField(Key))
+    {
+        if (Key == TEXT("id"))             { Reader.ReadString(OutMemory.Id); }
+        else if (Key == TEXT("playerId"))  { Reader.ReadString(OutMemory.PlayerId); }
+        else if (Key == TEXT("content"))   { Reader.ReadString(OutMemory.Content); }
+        else if (Key == TEXT("emotion"))   { Reader.ReadString(OutMemory.Emotion); }
+        else if (Key == TEXT("createdAt")) { Reader.ReadString(OutMemory.CreatedAt); }
+        else if (Key == TEXT("importance")){ Reader.ReadNumber(OutMemory.Importance); }
+        else if (Key == TEXT("type"))
+        {
+            FString TypeString;
+            if (Reader.ReadString(TypeString))
+            {
+                OutMemory.Type = FAGLWireNames::StringToMemoryType(TypeString);
+            }
+        }
+        else if (Key == TEXT("context"))
+        {
+            if (Reader.EnterObject())
+            {
+                FStringView ContextKey;
+                while (Reader.NextField(ContextKey))
+                {
+                    // The key view is consumed before the value read
+                    // can touch the arena scratch
+                    const FString ContextName(ContextKey.Len(), ContextKey.GetData());
+                    FString Value;
+                    if (Reader.ReadString(Value))
+                    {
+                        OutMemory.Context.Add(ContextName, MoveTemp(Value));
+                    }
+                    else if (Reader.HadError())
+                    {
+                        break;
+                    }
+                }
+            }
+        }
+        else { Reader.SkipValue(); }
+    }
 
-    return OutputString;
+    return !Reader.HadError();
 }
 
 FAGLMemory UAGLMemoryService::DeserializeMemory(const TSharedPtr<FJsonObject>& JsonObject)
@@ -369,38 +1303,63 @@ TArray<FAGLMemorySearchResult> UAGLMemoryService::DeserializeSearchResults(const
 {
     TArray<FAGLMemorySearchResult> Results;
 
-    TSharedPtr<FJsonObject> JsonObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+    // Stream the result array straight into the typed structs; the
+    // large search payloads are where the per-field DOM allocations of
+    // the old parse hurt the most
+    FAGLJsonArena Arena;
+    FAGLJsonReader Reader(JsonString, Arena);
 
-    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    if (!Reader.EnterObject())
     {
         UE_LOG(LogTemp, Error, TEXT("Failed to parse search results JSON"));
         return Results;
     }
 
-    const TArray<TSharedPtr<FJsonValue>>* ResultsArray;
-    if (JsonObject->TryGetArrayField(TEXT("results"), ResultsArray))
+    FStringView Key;
+    while (Reader.NextField(Key))
     {
-        for (const TSharedPtr<FJsonValue>& ResultValue : *ResultsArray)
+        if (Key == TEXT("results"))
         {
-            const TSharedPtr<FJsonObject>* ResultObject;
-            if (ResultValue->TryGetObject(ResultObject) && ResultObject->IsValid())
+            if (Reader.EnterArray())
             {
-                FAGLMemorySearchResult SearchResult;
-
-                // Parse similarity score
-                (*ResultObject)->TryGetNumberField(TEXT("similarityScore"), SearchResult.SimilarityScore);
-
-                // Parse memory object
-                const TSharedPtr<FJsonObject>* MemoryObject;
-                if ((*ResultObject)->TryGetObjectField(TEXT("memory"), MemoryObject))
+                while (Reader.NextElement())
                 {
-                    SearchResult.Memory = DeserializeMemory(*MemoryObject);
+                    FAGLMemorySearchResult SearchResult;
+                    if (!Reader.EnterObject())
+                    {
+                        break;
+                    }
+
+                    FStringView ResultKey;
+                    while (Reader.NextField(ResultKey))
+                    {
+                        if (ResultKey == TEXT("similarityScore"))
+                        {
+                            Reader.ReadNumber(SearchResult.SimilarityScore);
+                        }
+                        else if (ResultKey == TEXT("memory"))
+                        {
+                            ParseMemoryObject(Reader, SearchResult.Memory);
+                        }
+                        else
+                        {
+                            Reader.SkipValue();
+                        }
+                    }
+
+                    Results.Add(MoveTemp(SearchResult));
                 }
-
-                Results.Add(SearchResult);
             }
         }
+        else
+        {
+            Reader.SkipValue();
+        }
+    }
+
+    if (Reader.HadError())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to parse search results JSON"));
     }
 
     return Results;
@@ -410,27 +1369,43 @@ TArray<FAGLMemory> UAGLMemoryService::DeserializeMemories(const FString& JsonStr
 {
     TArray<FAGLMemory> Memories;
 
-    TSharedPtr<FJsonObject> JsonObject;
-    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+    // Stream the memories array straight into the typed structs
+    FAGLJsonArena Arena;
+    FAGLJsonReader Reader(JsonString, Arena);
 
-    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    if (!Reader.EnterObject())
     {
         UE_LOG(LogTemp, Error, TEXT("Failed to parse memories JSON"));
         return Memories;
     }
 
-    const TArray<TSharedPtr<FJsonValue>>* MemoriesArray;
-    if (JsonObject->TryGetArrayField(TEXT("memories"), MemoriesArray))
+    FStringView Key;
+    while (Reader.NextField(Key))
     {
-        for (const TSharedPtr<FJsonValue>& MemoryValue : *MemoriesArray)
+        if (Key == TEXT("memories"))
         {
-            const TSharedPtr<FJsonObject>* MemoryObject;
-            if (MemoryValue->TryGetObject(MemoryObject))
+            if (Reader.EnterArray())
             {
-                FAGLMemory Memory = DeserializeMemory(*MemoryObject);
-                Memories.Add(Memory);
+                while (Reader.NextElement())
+                {
+                    FAGLMemory Memory;
+                    if (!ParseMemoryObject(Reader, Memory))
+                    {
+                        break;
+                    }
+                    Memories.Add(MoveTemp(Memory));
+                }
             }
         }
+        else
+        {
+            Reader.SkipValue();
+        }
+    }
+
+    if (Reader.HadError())
+    {
+        UE_LOG(LogTemp, Error, TEXT("Failed to parse memories JSON"));
     }
 
     return Memories;
@@ -0,0 +1,286 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLMemoryWriteQueue.h"
+#include "AGLConnectionPool.h"
+#include "AGLRequestScheduler.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpResponse.h"
+#include "Json.h"
+#include "JsonUtilities.h"
+
+void UAGLMemoryWriteQueue::Initialize(UAGLMemoryService* InMemoryService, int32 InBatchSize, float InFlushInterval, int32 InMaxRetries)
+{
+    MemoryService = InMemoryService;
+    BatchSize = FMath::Max(1, InBatchSize);
+    FlushInterval = FMath::Max(0.1f, InFlushInterval);
+    MaxRetries = FMath::Max(1, InMaxRetries);
+
+    FlushTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UAGLMemoryWriteQueue::TickFlush),
+        FlushInterval
+    );
+
+    UE_LOG(LogTemp, Log, TEXT("AGLMemoryWriteQueue initialized (batch size=%d, flush interval=%.1fs, max retries=%d)"),
+        BatchSize, FlushInterval, MaxRetries);
+}
+
+void UAGLMemoryWriteQueue::Shutdown()
+{
+    if (FlushTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(FlushTickerHandle);
+        FlushTickerHandle.Reset();
+    }
+
+    // Ignore the backoff gate so a shutdown flush always gets one last try
+    NextFlushAllowedTime = 0.0;
+    Flush();
+}
+
+void UAGLMemoryWriteQueue::SetRequestScheduler(UAGLRequestScheduler* InScheduler)
+{
+    RequestScheduler = InScheduler;
+}
+
+void UAGLMemoryWriteQueue::EnqueueMemory(const FString& PlayerId, const FAGLCreateMemoryRequest& Request, FOnMemoryCreated OnComplete)
+{
+    FPendingMemoryWrite Item;
+    Item.PlayerId = PlayerId;
+    Item.Request = Request;
+    Item.OnComplete = OnComplete;
+    Pending.Add(MoveTemp(Item));
+
+    if (Pending.Num() >= BatchSize)
+    {
+        Flush();
+    }
+}
+
+void UAGLMemoryWriteQueue::Flush()
+{
+    if (!MemoryService || Pending.Num() == 0)
+    {
+        return;
+    }
+
+    // Respect the backoff gate after failed flushes; the ticker retries
+    // once the window passes
+    if (FPlatformTime::Seconds() < NextFlushAllowedTime)
+    {
+        return;
+    }
+
+    // Most important memories first, so they land even if the backend
+    // truncates and survive longest across retries
+    Pending.StableSort([](const FPendingMemoryWrite& A, const FPendingMemoryWrite& B)
+    {
+        return A.Request.Importance > B.Request.Importance;
+    });
+
+    // One bulk request per player; in practice a client serves one
+    TMap<FString, TSharedPtr<TArray<FPendingMemoryWrite>>> Batches;
+    for (FPendingMemoryWrite& Item : Pending)
+    {
+        TSharedPtr<TArray<FPendingMemoryWrite>>& Batch = Batches.FindOrAdd(Item.PlayerId);
+        if (!Batch.IsValid())
+        {
+            Batch = MakeShared<TArray<FPendingMemoryWrite>>();
+        }
+        Batch->Add(MoveTemp(Item));
+    }
+    Pending.Empty();
+
+    for (auto& Pair : Batches)
+    {
+        const FString PlayerId = Pair.Key;
+        TSharedPtr<TArray<FPendingMemoryWrite>> Items = Pair.Value;
+
+        // Bulk writes are background traffic: queue behind user-facing
+        // requests when the connection budget is saturated
+        if (RequestScheduler)
+        {
+            TWeakObjectPtr<UAGLMemoryWriteQueue> WeakThis(this);
+            RequestScheduler->SubmitBackground([WeakThis, PlayerId, Items]()
+            {
+                if (WeakThis.IsValid())
+                {
+                    WeakThis->SendBulkRequest(PlayerId, Items);
+                }
+            });
+        }
+        else
+        {
+            SendBulkRequest(PlayerId, Items);
+        }
+    }
+}
+
+bool UAGLMemoryWriteQueue::TickFlush(float DeltaTime)
+{
+    Flush();
+    return true;
+}
+
+void UAGLMemoryWriteQueue::SendBulkRequest(const FString& PlayerId, TSharedPtr<TArray<FPendingMemoryWrite>> Items)
+{
+    // Create HTTP request (pooled keep-alive connection when available)
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = MemoryService->CreateHttpRequest();
+
+    FString URL = FString::Printf(TEXT("%s/players/%s/memories/bulk"), *MemoryService->ServiceUrl, *PlayerId);
+    HttpRequest->SetURL(URL);
+    HttpRequest->SetVerb(TEXT("POST"));
+    HttpRequest->SetHeader(TEXT("Content-Type"), TEXT("application/json"));
+    HttpRequest->SetHeader(TEXT("X-API-Key"), MemoryService->ApiKey);
+    HttpRequest->SetTimeout(MemoryService->Timeout);
+    HttpRequest->SetContentAsString(SerializeBulkRequest(*Items));
+
+    // Bind response handler
+    HttpRequest->OnProcessRequestComplete().BindLambda(
+        [this, Items](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+        {
+            HandleBulkResponse(Request, Response, bWasSuccessful, Items);
+        }
+    );
+
+    // Send request
+    HttpRequest->ProcessRequest();
+
+    UE_LOG(LogTemp, Log, TEXT("AGLMemoryWriteQueue: Flushed %d memories for player %s"), Items->Num(), *PlayerId);
+}
+
+FString UAGLMemoryWriteQueue::SerializeBulkRequest(const TArray<FPendingMemoryWrite>& Items)
+{
+    TSharedPtr<FJsonObject> JsonObject = MakeShareable(new FJsonObject);
+
+    TArray<TSharedPtr<FJsonValue>> MemoryArray;
+    MemoryArray.Reserve(Items.Num());
+
+    for (const FPendingMemoryWrite& Item : Items)
+    {
+        // Each element uses the same shape as a single create payload
+        FString ItemJson = MemoryService->SerializeCreateMemoryRequest(Item.Request);
+
+        TSharedPtr<FJsonObject> ItemObject;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ItemJson);
+        if (FJsonSerializer::Deserialize(Reader, ItemObject) && ItemObject.IsValid())
+        {
+            MemoryArray.Add(MakeShareable(new FJsonValueObject(ItemObject)));
+        }
+    }
+
+    JsonObject->SetArrayField(TEXT("memories"), MemoryArray);
+
+    FString OutputString;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&OutputString);
+    FJsonSerializer::Serialize(JsonObject.ToSharedRef(), Writer);
+
+    return OutputString;
+}
+
+void UAGLMemoryWriteQueue::HandleBulkResponse(
+    FHttpRequestPtr Request,
+    FHttpResponsePtr Response,
+    bool bWasSuccessful,
+    TSharedPtr<TArray<FPendingMemoryWrite>> Items)
+{
+    MemoryService->ReleaseHttpRequest(Request);
+    ReleaseSchedulerSlot();
+
+    const bool bAccepted = bWasSuccessful && Response.IsValid() &&
+        (Response->GetResponseCode() == 200 || Response->GetResponseCode() == 201);
+    if (!bAccepted)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AGLMemoryWriteQueue: Bulk request failed, re-queueing %d memories"), Items->Num());
+        RequeueFailedItems(*Items);
+        return;
+    }
+
+    ConsecutiveFailures = 0;
+    NextFlushAllowedTime = 0.0;
+
+    // Parse response: memories array ordered to match the submitted items
+    FString ResponseContent = Response->GetContentAsString();
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(ResponseContent);
+
+    const TArray<TSharedPtr<FJsonValue>>* MemoriesArray = nullptr;
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid() ||
+        !JsonObject->TryGetArrayField(TEXT("memories"), MemoriesArray))
+    {
+        UE_LOG(LogTemp, Error, TEXT("AGLMemoryWriteQueue: Failed to parse bulk response JSON"));
+        FAGLMemory EmptyMemory;
+        for (const FPendingMemoryWrite& Item : *Items)
+        {
+            Item.OnComplete.ExecuteIfBound(false, EmptyMemory);
+        }
+        return;
+    }
+
+    // Fan results back out to the original delegates
+    for (int32 Index = 0; Index < Items->Num(); ++Index)
+    {
+        FAGLMemory Memory;
+        bool bHasResult = false;
+
+        if (MemoriesArray->IsValidIndex(Index))
+        {
+            const TSharedPtr<FJsonObject>* MemoryObject;
+            if ((*MemoriesArray)[Index]->TryGetObject(MemoryObject) && MemoryObject->IsValid())
+            {
+                Memory = MemoryService->DeserializeMemory(*MemoryObject);
+                bHasResult = true;
+
+                // Fold into the context cache like a single create would
+                if (MemoryService->bUseContextCache)
+                {
+                    MemoryService->ContextCache.AddMemory(Memory.PlayerId, Memory);
+                }
+            }
+        }
+
+        (*Items)[Index].OnComplete.ExecuteIfBound(bHasResult, Memory);
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("AGLMemoryWriteQueue: Dispatched %d bulk results"), Items->Num());
+}
+
+void UAGLMemoryWriteQueue::RequeueFailedItems(TArray<FPendingMemoryWrite>& Items)
+{
+    ++ConsecutiveFailures;
+
+    // Exponential backoff capped at a minute so a long outage does not
+    // hammer a recovering backend
+    const double BackoffSeconds = FMath::Min(FlushInterval * FMath::Pow(2.0f, ConsecutiveFailures), 60.0f);
+    NextFlushAllowedTime = FPlatformTime::Seconds() + BackoffSeconds;
+
+    FAGLMemory EmptyMemory;
+    for (FPendingMemoryWrite& Item : Items)
+    {
+        if (++Item.RetryCount >= MaxRetries)
+        {
+            UE_LOG(LogTemp, Error, TEXT("AGLMemoryWriteQueue: Dropping memory after %d failed flushes"), Item.RetryCount);
+            Item.OnComplete.ExecuteIfBound(false, EmptyMemory);
+        }
+        else
+        {
+            Pending.Add(MoveTemp(Item));
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("AGLMemoryWriteQueue: Next flush in %.1fs (%d consecutive failures)"),
+        BackoffSeconds, ConsecutiveFailures);
+}
+
+void UAGLMemoryWriteQueue::ReleaseSchedulerSlot()
+{
+    if (RequestScheduler)
+    {
+        RequestScheduler->NotifyRequestFinished();
+    }
+}
+
+void UAGLMemoryWriteQueue::BeginDestroy()
+{
+    Shutdown();
+    Super::BeginDestroy();
+}
@@ -0,0 +1,1119 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLMessagePack.h"
+#include "AGLWireNames.h"
+
+//////////////////////////////////////////////////////////////////////////
+// FAGLMessagePackWriter
+
+void FAGLMessagePackWriter::WriteMapHeader(int32 Count)
+{
+    if (Count <= 15)
+    {
+        Buffer.Add(0x80 | (uint8)Count);
+    }
+    else if (Count <= 65535)
+    {
+        Buffer.Add(0xde);
+        Buffer.Add((uint8)(Count >> 8));
+        Buffer.Add((uint8)Count);
+    }
+    else
+    {
+        Buffer.Add(0xdf);
+        Buffer.Add((uint8)(Count >> 24));
+        Buffer.Add((uint8)(Count >> 16));
+        Buffer.Add((uint8)(Count >> 8));
+        Buffer.Add((uint8)Count);
+    }
+}
+
+void FAGLMessagePackWriter::WriteArrayHeader(int32 Count)
+{
+    if (Count <= 15)
+    {
+        Buffer.Add(0x90 | (uint8)Count);
+    }
+    else if (Count <= 65535)
+    {
+        Buffer.Add(0xdc);
+        Buffer.Add((uint8)(Count >> 8));
+        Buffer.Add((uint8)Count);
+    }
+    else
+    {
+        Buffer.Add(0xdd);
+        Buffer.Add((uint8)(Count >> 24));
+        Buffer.Add((uint8)(Count >> 16));
+        Buffer.Add((uint8)(Count >> 8));
+        Buffer.Add((uint8)Count);
+    }
+}
+
+void FAGLMessagePackWriter::WriteString(const FString& Value)
+{
+    FTCHARToUTF8 Converted(*Value, Value.Len());
+    const int32 Length = Converted.Length();
+
+    if (Length <= 31)
+    {
+        Buffer.Add(0xa0 | (uint8)Length);
+    }
+    else if (Length <= 255)
+    {
+        Buffer.Add(0xd9);
+        Buffer.Add((uint8)Length);
+    }
+    else if (Length <= 65535)
+    {
+        Buffer.Add(0xda);
+        Buffer.Add((uint8)(Length >> 8));
+        Buffer.Add((uint8)Length);
+    }
+    else
+    {
+        // Memory content is arbitrary integrator text; str16 alone would
+        // silently wrap the length and corrupt the stream
+        Buffer.Add(0xdb);
+        Buffer.Add((uint8)(Length >> 24));
+        Buffer.Add((uint8)(Length >> 16));
+        Buffer.Add((uint8)(Length >> 8));
+        Buffer.Add((uint8)Length);
+    }
+
+    Buffer.Append(reinterpret_cast<const uint8*>(Converted.Get()), Length);
+}
+
+void FAGLMessagePackWriter::WriteBool(bool bValue)
+{
+    Buffer.Add(bValue ? 0xc3 : 0xc2);
+}
+
+void FAGLMessagePackWriter::WriteInt(int32 Value)
+{
+    if (Value >= 0 && Value <= 127)
+    {
+        Buffer.Add((uint8)Value);
+    }
+    else if (Value < 0 && Value >= -32)
+    {
+        Buffer.Add((uint8)Value);
+    }
+    else
+    {
+        Buffer.Add(0xd2);
+        Buffer.Add((uint8)(Value >> 24));
+        Buffer.Add((uint8)(Value >> 16));
+        Buffer.Add((uint8)(Value >> 8));
+        Buffer.Add((uint8)Value);
+    }
+}
+
+void FAGLMessagePackWriter::WriteFloat(float Value)
+{
+    uint32 Bits;
+    FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+
+    Buffer.Add(0xca);
+    Buffer.Add((uint8)(Bits >> 24));
+    Buffer.Add((uint8)(Bits >> 16));
+    Buffer.Add((uint8)(Bits >> 8));
+    Buffer.Add((uint8)Bits);
+}
+
+void FAGLMessagePackWriter::WriteStringMap(const TMap<FString, FString>& Map)
+{
+    WriteMapHeader(Map.Num());
+    for (const auto& Pair : Map)
+    {
+        WriteString(Pair.Key);
+        WriteString(Pair.Value);
+    }
+}
+
+void FAGLMessagePackWriter::WriteStringMap(const FAGLKeyValueStore& Store)
+{
+    WriteMapHeader(Store.Num());
+    for (const FAGLKeyValuePair& Pair : Store)
+    {
+        WriteString(Pair.Key);
+        WriteString(Pair.Value);
+    }
+}
+
+//////////////////////////////////////////////////////////////////////////
+// FAGLMessagePackReader
+
+bool FAGLMessagePackReader::ReadBigEndian(int32 NumBytes, uint32& OutValue)
+{
+    if (Remaining() < NumBytes)
+    {
+        return false;
+    }
+
+    OutValue = 0;
+    for (int32 Index = 0; Index < NumBytes; ++Index)
+    {
+        OutValue = (OutValue << 8) | Buffer[Offset++];
+    }
+    return true;
+}
+
+bool FAGLMessagePackReader::ReadMapHeader(int32& OutCount)
+{
+    if (Remaining() < 1)
+    {
+        return false;
+    }
+
+    const uint8 Marker = Buffer[Offset];
+    if ((Marker & 0xf0) == 0x80)
+    {
+        Offset++;
+        OutCount = Marker & 0x0f;
+        return true;
+    }
+    if (Marker == 0xde || Marker == 0xdf)
+    {
+        Offset++;
+        uint32 Count;
+        if (!ReadBigEndian(Marker == 0xde ? 2 : 4, Count))
+        {
+            return false;
+        }
+        OutCount = (int32)Count;
+        return true;
+    }
+    return false;
+}
+
+bool FAGLMessagePackReader::ReadArrayHeader(int32& OutCount)
+{
+    if (Remaining() < 1)
+    {
+        return false;
+    }
+
+    const uint8 Marker = Buffer[Offset];
+    if ((Marker & 0xf0) == 0x90)
+    {
+        Offset++;
+        OutCount = Marker & 0x0f;
+        return true;
+    }
+    if (Marker == 0xdc || Marker == 0xdd)
+    {
+        Offset++;
+        uint32 Count;
+        if (!ReadBigEndian(Marker == 0xdc ? 2 : 4, Count))
+        {
+            return false;
+        }
+        OutCount = (int32)Count;
+        return true;
+    }
+    return false;
+}
+
+bool FAGLMessagePackReader::ReadString(FString& OutValue)
+{
+    if (Remaining() < 1)
+    {
+        return false;
+    }
+
+    const uint8 Marker = Buffer[Offset];
+    uint32 Length;
+
+    if ((Marker & 0xe0) == 0xa0)
+    {
+        Offset++;
+        Length = Marker & 0x1f;
+    }
+    else if (Marker == 0xd9)
+    {
+        Offset++;
+        if (!ReadBigEndian(1, Length))
+        {
+            return false;
+        }
+    }
+    else if (Marker == 0xda)
+    {
+        Offset++;
+        if (!ReadBigEndian(2, Length))
+        {
+            return false;
+        }
+    }
+    else if (Marker == 0xdb)
+    {
+        Offset++;
+        if (!ReadBigEndian(4, Length))
+        {
+            return false;
+        }
+    }
+    else
+    {
+        return false;
+    }
+
+    if (Remaining() < (int32)Length)
+    {
+        return false;
+    }
+
+    FUTF8ToTCHAR Converted(reinterpret_cast<const ANSICHAR*>(Buffer.GetData() + Offset), Length);
+    OutValue = FString(Converted.Length(), Converted.Get());
+    Offset += Length;
+    return true;
+}
+
+bool FAGLMessagePackReader::ReadBool(bool& bOutValue)
+{
+    if (Remaining() < 1)
+    {
+        return false;
+    }
+
+    const uint8 Marker = Buffer[Offset];
+    if (Marker == 0xc2)
+    {
+        Offset++;
+        bOutValue = false;
+        return true;
+    }
+    if (Marker == 0xc3)
+    {
+        Offset++;
+        bOutValue = true;
+        return true;
+    }
+    return false;
+}
+
+bool FAGLMessagePackReader::ReadInt(int32& OutValue)
+{
+    if (Remaining() < 1)
+    {
+        return false;
+    }
+
+    const uint8 Marker = Buffer[Offset];
+
+    if (Marker <= 0x7f)
+    {
+        Offset++;
+        OutValue = Marker;
+        return true;
+    }
+    if (Marker >= 0xe0)
+    {
+        Offset++;
+        OutValue = (int8)Marker;
+        return true;
+    }
+
+    uint32 Raw;
+    switch (Marker)
+    {
+        case 0xcc: Offset++; if (!ReadBigEndian(1, Raw)) { return false; } OutValue = (int32)Raw; return true;
+        case 0xcd: Offset++; if (!ReadBigEndian(2, Raw)) { return false; } OutValue = (int32)Raw; return true;
+        case 0xce: Offset++; if (!ReadBigEndian(4, Raw)) { return false; } OutValue = (int32)Raw; return true;
+        case 0xd0: Offset++; if (!ReadBigEndian(1, Raw)) { return false; } OutValue = (int8)Raw; return true;
+        case 0xd1: Offset++; if (!ReadBigEndian(2, Raw)) { return false; } OutValue = (int16)Raw; return true;
+        case 0xd2: Offset++; if (!ReadBigEndian(4, Raw)) { return false; } OutValue = (int32)Raw; return true;
+        default: return false;
+    }
+}
+
+bool FAGLMessagePackReader::ReadFloat(float& OutValue)
+{
+    if (Remaining() < 1)
+    {
+        return false;
+    }
+
+    const uint8 Marker = Buffer[Offset];
+    if (Marker == 0xca)
+    {
+        Offset++;
+        uint32 Bits;
+        if (!ReadBigEndian(4, Bits))
+        {
+            return false;
+        }
+        FMemory::Memcpy(&OutValue, &Bits, sizeof(OutValue));
+        return true;
+    }
+    if (Marker == 0xcb)
+    {
+        Offset++;
+        uint32 High, Low;
+        if (!ReadBigEndian(4, High) || !ReadBigEndian(4, Low))
+        {
+            return false;
+        }
+        const uint64 Bits = ((uint64)High << 32) | Low;
+        double DoubleValue;
+        FMemory::Memcpy(&DoubleValue, &Bits, sizeof(DoubleValue));
+        OutValue = (float)DoubleValue;
+        return true;
+    }
+
+    // Backends may send whole numbers as integers
+    int32 IntValue;
+    if (ReadInt(IntValue))
+    {
+        OutValue = (float)IntValue;
+        return true;
+    }
+    return false;
+}
+
+bool FAGLMessagePackReader::ReadStringMap(TMap<FString, FString>& OutMap)
+{
+    int32 Count;
+    if (!ReadMapHeader(Count))
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        FString Key;
+        FString Value;
+        if (!ReadString(Key))
+        {
+            return false;
+        }
+        if (!ReadString(Value))
+        {
+            // Tolerate non-string values by skipping them
+            if (!SkipValue())
+            {
+                return false;
+            }
+            continue;
+        }
+        OutMap.Add(MoveTemp(Key), MoveTemp(Value));
+    }
+    return true;
+}
+
+bool FAGLMessagePackReader::ReadStringMap(FAGLKeyValueStore& OutStore)
+{
+    int32 Count;
+    if (!ReadMapHeader(Count))
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        FString Key;
+        FString Value;
+        if (!ReadString(Key))
+        {
+            return false;
+        }
+        if (!ReadString(Value))
+        {
+            // Tolerate non-string values by skipping them
+            if (!SkipValue())
+            {
+                return false;
+            }
+            continue;
+        }
+        OutStore.Add(Key, Value);
+    }
+    return true;
+}
+
+bool FAGLMessagePackReader::SkipValue()
+{
+    if (Remaining() < 1)
+    {
+        return false;
+    }
+
+    const uint8 Marker = Buffer[Offset];
+
+    // Fixed-width scalars
+    if (Marker <= 0x7f || Marker >= 0xe0 || Marker == 0xc0 || Marker == 0xc2 || Marker == 0xc3)
+    {
+        Offset++;
+        return true;
+    }
+
+    // Strings
+    if ((Marker & 0xe0) == 0xa0 || Marker == 0xd9 || Marker == 0xda || Marker == 0xdb)
+    {
+        FString Ignored;
+        return ReadString(Ignored);
+    }
+
+    // Maps and arrays: skip each element recursively
+    int32 Count;
+    if ((Marker & 0xf0) == 0x80 || Marker == 0xde || Marker == 0xdf)
+    {
+        if (!ReadMapHeader(Count))
+        {
+            return false;
+        }
+        for (int32 Index = 0; Index < Count * 2; ++Index)
+        {
+            if (!SkipValue())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+    if ((Marker & 0xf0) == 0x90 || Marker == 0xdc || Marker == 0xdd)
+    {
+        if (!ReadArrayHeader(Count))
+        {
+            return false;
+        }
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            if (!SkipValue())
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Remaining numeric markers
+    int32 IntValue;
+    if (ReadInt(IntValue))
+    {
+        return true;
+    }
+    float FloatValue;
+    return ReadFloat(FloatValue);
+}
+
+//////////////////////////////////////////////////////////////////////////
+// FAGLMessagePack
+
+const TCHAR* FAGLMessagePack::ContentType = TEXT("application/msgpack");
+
+void FAGLMessagePack::EncodeEmotionRequest(const FAGLEmotionRequest& Request, TArray<uint8>& OutBytes)
+{
+    FAGLMessagePackWriter Writer(OutBytes);
+    Writer.WriteMapHeader(4);
+    Writer.WriteString(TEXT("type"));
+    Writer.WriteString(FAGLWireNames::EventTypeToString(Request.EventType));
+    Writer.WriteString(TEXT("force_ml"));
+    Writer.WriteBool(Request.bForceML);
+    Writer.WriteString(TEXT("data"));
+    Writer.WriteStringMap(Request.Data);
+    Writer.WriteString(TEXT("context"));
+    Writer.WriteStringMap(Request.Context);
+}
+
+bool FAGLMessagePack::DecodeEmotionRequest(const TArray<uint8>& Bytes, FAGLEmotionRequest& OutRequest)
+{
+    FAGLMessagePackReader Reader(Bytes);
+    int32 FieldCount;
+    if (!Reader.ReadMapHeader(FieldCount))
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < FieldCount; ++Index)
+    {
+        FString Key;
+        if (!Reader.ReadString(Key))
+        {
+            return false;
+        }
+
+        if (Key == TEXT("type"))
+        {
+            FString Value;
+            if (!Reader.ReadString(Value)) { return false; }
+            OutRequest.EventType = FAGLWireNames::StringToEventType(Value);
+        }
+        else if (Key == TEXT("force_ml"))
+        {
+            if (!Reader.ReadBool(OutRequest.bForceML)) { return false; }
+        }
+        else if (Key == TEXT("data"))
+        {
+            if (!Reader.ReadStringMap(OutRequest.Data)) { return false; }
+        }
+        else if (Key == TEXT("context"))
+        {
+            if (!Reader.ReadStringMap(OutRequest.Context)) { return false; }
+        }
+        else if (!Reader.SkipValue())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FAGLMessagePack::EncodeEmotionResponse(const FAGLEmotionResponse& Response, TArray<uint8>& OutBytes)
+{
+    FAGLMessagePackWriter Writer(OutBytes);
+    Writer.WriteMapHeader(9);
+    Writer.WriteString(TEXT("emotion"));
+    Writer.WriteString(FAGLWireNames::EmotionTypeToString(Response.Emotion));
+    Writer.WriteString(TEXT("intensity"));
+    Writer.WriteFloat(Response.Intensity);
+    Writer.WriteString(TEXT("confidence"));
+    Writer.WriteFloat(Response.Confidence);
+    Writer.WriteString(TEXT("action"));
+    Writer.WriteString(Response.Action);
+    Writer.WriteString(TEXT("reasoning"));
+    Writer.WriteString(Response.Reasoning);
+    Writer.WriteString(TEXT("method"));
+    Writer.WriteString(Response.Method);
+    Writer.WriteString(TEXT("cost"));
+    Writer.WriteFloat(Response.Cost);
+    Writer.WriteString(TEXT("cache_hit"));
+    Writer.WriteBool(Response.bCacheHit);
+    Writer.WriteString(TEXT("latency_ms"));
+    Writer.WriteInt(Response.LatencyMs);
+}
+
+bool FAGLMessagePack::DecodeEmotionResponse(const TArray<uint8>& Bytes, FAGLEmotionResponse& OutResponse)
+{
+    FAGLMessagePackReader Reader(Bytes);
+    int32 FieldCount;
+    if (!Reader.ReadMapHeader(FieldCount))
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < FieldCount; ++Index)
+    {
+        FString Key;
+        if (!Reader.ReadString(Key))
+        {
+            return false;
+        }
+
+        if (Key == TEXT("emotion"))
+        {
+            FString Value;
+            if (!Reader.ReadString(Value)) { return false; }
+            OutResponse.Emotion = FAGLWireNames::StringToEmotionType(Value);
+        }
+        else if (Key == TEXT("intensity"))
+        {
+            if (!Reader.ReadFloat(OutResponse.Intensity)) { return false; }
+        }
+        else if (Key == TEXT("confidence"))
+        {
+            if (!Reader.ReadFloat(OutResponse.Confidence)) { return false; }
+        }
+        else if (Key == TEXT("action"))
+        {
+            if (!Reader.ReadString(OutResponse.Action)) { return false; }
+        }
+        else if (Key == TEXT("reasoning"))
+        {
+            if (!Reader.ReadString(OutResponse.Reasoning)) { return false; }
+        }
+        else if (Key == TEXT("method"))
+        {
+            if (!Reader.ReadString(OutResponse.Method)) { return false; }
+        }
+        else if (Key == TEXT("cost"))
+        {
+            if (!Reader.ReadFloat(OutResponse.Cost)) { return false; }
+        }
+        else if (Key == TEXT("cache_hit"))
+        {
+            if (!Reader.ReadBool(OutResponse.bCacheHit)) { return false; }
+        }
+        else if (Key == TEXT("latency_ms"))
+        {
+            if (!Reader.ReadInt(OutResponse.LatencyMs)) { return false; }
+        }
+        else if (!Reader.SkipValue())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FAGLMessagePack::EncodeDialogueRequest(const FAGLDialogueRequest& Request, TArray<uint8>& OutBytes)
+{
+    FAGLMessagePackWriter Writer(OutBytes);
+    Writer.WriteMapHeader(7);
+    Writer.WriteString(TEXT("event_type"));
+    Writer.WriteString(FAGLWireNames::EventTypeToString(Request.EventType));
+    Writer.WriteString(TEXT("emotion"));
+    Writer.WriteString(FAGLWireNames::EmotionTypeToString(Request.Emotion));
+    Writer.WriteString(TEXT("persona"));
+    Writer.WriteString(FAGLWireNames::PersonaToString(Request.Persona));
+    Writer.WriteString(TEXT("force_llm"));
+    Writer.WriteBool(Request.bForceLLM);
+    Writer.WriteString(TEXT("player_id"));
+    Writer.WriteString(Request.PlayerId);
+    Writer.WriteString(TEXT("language"));
+    Writer.WriteString(Request.Language);
+    Writer.WriteString(TEXT("context"));
+    Writer.WriteStringMap(Request.Context);
+}
+
+bool FAGLMessagePack::DecodeDialogueRequest(const TArray<uint8>& Bytes, FAGLDialogueRequest& OutRequest)
+{
+    FAGLMessagePackReader Reader(Bytes);
+    int32 FieldCount;
+    if (!Reader.ReadMapHeader(FieldCount))
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < FieldCount; ++Index)
+    {
+        FString Key;
+        if (!Reader.ReadString(Key))
+        {
+            return false;
+        }
+
+        if (Key == TEXT("event_type"))
+        {
+            FString Value;
+            if (!Reader.ReadString(Value)) { return false; }
+            OutRequest.EventType = FAGLWireNames::StringToEventType(Value);
+        }
+        else if (Key == TEXT("emotion"))
+        {
+            FString Value;
+            if (!Reader.ReadString(Value)) { return false; }
+            OutRequest.Emotion = FAGLWireNames::StringToEmotionType(Value);
+        }
+        else if (Key == TEXT("persona"))
+        {
+            FString Value;
+            if (!Reader.ReadString(Value)) { return false; }
+            OutRequest.Persona = FAGLWireNames::StringToPersona(Value);
+        }
+        else if (Key == TEXT("force_llm"))
+        {
+            if (!Reader.ReadBool(OutRequest.bForceLLM)) { return false; }
+        }
+        else if (Key == TEXT("player_id"))
+        {
+            if (!Reader.ReadString(OutRequest.PlayerId)) { return false; }
+        }
+        else if (Key == TEXT("language"))
+        {
+            if (!Reader.ReadString(OutRequest.Language)) { return false; }
+        }
+        else if (Key == TEXT("context"))
+        {
+            if (!Reader.ReadStringMap(OutRequest.Context)) { return false; }
+        }
+        else if (!Reader.SkipValue())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FAGLMessagePack::EncodeDialogueResponse(const FAGLDialogueResponse& Response, TArray<uint8>& OutBytes)
+{
+    FAGLMessagePackWriter Writer(OutBytes);
+    Writer.WriteMapHeader(8);
+    Writer.WriteString(TEXT("dialogue"));
+    Writer.WriteString(Response.Dialogue);
+    Writer.WriteString(TEXT("method"));
+    Writer.WriteString(Response.Method);
+    Writer.WriteString(TEXT("cost"));
+    Writer.WriteFloat(Response.Cost);
+    Writer.WriteString(TEXT("used_special_case"));
+    Writer.WriteBool(Response.bUsedSpecialCase);
+    Writer.WriteString(TEXT("special_case_reasons"));
+    Writer.WriteArrayHeader(Response.SpecialCaseReasons.Num());
+    for (const FString& Reason : Response.SpecialCaseReasons)
+    {
+        Writer.WriteString(Reason);
+    }
+    Writer.WriteString(TEXT("memory_count"));
+    Writer.WriteInt(Response.MemoryCount);
+    Writer.WriteString(TEXT("cache_hit"));
+    Writer.WriteBool(Response.bCacheHit);
+    Writer.WriteString(TEXT("latency_ms"));
+    Writer.WriteInt(Response.LatencyMs);
+}
+
+bool FAGLMessagePack::DecodeDialogueResponse(const TArray<uint8>& Bytes, FAGLDialogueResponse& OutResponse)
+{
+    FAGLMessagePackReader Reader(Bytes);
+    int32 FieldCount;
+    if (!Reader.ReadMapHeader(FieldCount))
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < FieldCount; ++Index)
+    {
+        FString Key;
+        if (!Reader.ReadString(Key))
+        {
+            return false;
+        }
+
+        if (Key == TEXT("dialogue"))
+        {
+            if (!Reader.ReadString(OutResponse.Dialogue)) { return false; }
+        }
+        else if (Key == TEXT("method"))
+        {
+            if (!Reader.ReadString(OutResponse.Method)) { return false; }
+        }
+        else if (Key == TEXT("cost"))
+        {
+            if (!Reader.ReadFloat(OutResponse.Cost)) { return false; }
+        }
+        else if (Key == TEXT("used_special_case"))
+        {
+            if (!Reader.ReadBool(OutResponse.bUsedSpecialCase)) { return false; }
+        }
+        else if (Key == TEXT("special_case_reasons"))
+        {
+            int32 ReasonCount;
+            if (!Reader.ReadArrayHeader(ReasonCount)) { return false; }
+            for (int32 ReasonIndex = 0; ReasonIndex < ReasonCount; ++ReasonIndex)
+            {
+                FString Reason;
+                if (!Reader.ReadString(Reason)) { return false; }
+                OutResponse.SpecialCaseReasons.Add(MoveTemp(Reason));
+            }
+        }
+        else if (Key == TEXT("memory_count"))
+        {
+            if (!Reader.ReadInt(OutResponse.MemoryCount)) { return false; }
+        }
+        else if (Key == TEXT("cache_hit"))
+        {
+            if (!Reader.ReadBool(OutResponse.bCacheHit)) { return false; }
+        }
+        else if (Key == TEXT("latency_ms"))
+        {
+            if (!Reader.ReadInt(OutResponse.LatencyMs)) { return false; }
+        }
+        else if (!Reader.SkipValue())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FAGLMessagePack::EncodeCreateMemoryRequest(const FAGLCreateMemoryRequest& Request, TArray<uint8>& OutBytes)
+{
+    FAGLMessagePackWriter Writer(OutBytes);
+    Writer.WriteMapHeader(5);
+    Writer.WriteString(TEXT("type"));
+    Writer.WriteString(FAGLWireNames::MemoryTypeToString(Request.Type));
+    Writer.WriteString(TEXT("content"));
+    Writer.WriteString(Request.Content);
+    Writer.WriteString(TEXT("emotion"));
+    Writer.WriteString(Request.Emotion);
+    Writer.WriteString(TEXT("importance"));
+    Writer.WriteInt(Request.Importance);
+    Writer.WriteString(TEXT("context"));
+    Writer.WriteStringMap(Request.Context);
+}
+
+bool FAGLMessagePack::DecodeCreateMemoryRequest(const TArray<uint8>& Bytes, FAGLCreateMemoryRequest& OutRequest)
+{
+    FAGLMessagePackReader Reader(Bytes);
+    int32 FieldCount;
+    if (!Reader.ReadMapHeader(FieldCount))
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < FieldCount; ++Index)
+    {
+        FString Key;
+        if (!Reader.ReadString(Key))
+        {
+            return false;
+        }
+
+        if (Key == TEXT("type"))
+        {
+            FString Value;
+            if (!Reader.ReadString(Value)) { return false; }
+            OutRequest.Type = FAGLWireNames::StringToMemoryType(Value);
+        }
+        else if (Key == TEXT("content"))
+        {
+            if (!Reader.ReadString(OutRequest.Content)) { return false; }
+        }
+        else if (Key == TEXT("emotion"))
+        {
+            if (!Reader.ReadString(OutRequest.Emotion)) { return false; }
+        }
+        else if (Key == TEXT("importance"))
+        {
+            if (!Reader.ReadInt(OutRequest.Importance)) { return false; }
+        }
+        else if (Key == TEXT("context"))
+        {
+            if (!Reader.ReadStringMap(OutRequest.Context)) { return false; }
+        }
+        else if (!Reader.SkipValue())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FAGLMessagePack::EncodeSearchMemoriesRequest(const FAGLSearchMemoriesRequest& Request, TArray<uint8>& OutBytes)
+{
+    FAGLMessagePackWriter Writer(OutBytes);
+    Writer.WriteMapHeader(2);
+    Writer.WriteString(TEXT("query"));
+    Writer.WriteString(Request.Query);
+    Writer.WriteString(TEXT("limit"));
+    Writer.WriteInt(Request.Limit);
+}
+
+void FAGLMessagePack::EncodeGetContextRequest(const FAGLGetContextRequest& Request, TArray<uint8>& OutBytes)
+{
+    FAGLMessagePackWriter Writer(OutBytes);
+    Writer.WriteMapHeader(2);
+    Writer.WriteString(TEXT("currentEvent"));
+    Writer.WriteString(Request.CurrentEvent);
+    Writer.WriteString(TEXT("limit"));
+    Writer.WriteInt(Request.Limit);
+}
+
+void FAGLMessagePack::WriteMemory(FAGLMessagePackWriter& Writer, const FAGLMemory& Memory)
+{
+    Writer.WriteMapHeader(8);
+    Writer.WriteString(TEXT("id"));
+    Writer.WriteString(Memory.Id);
+    Writer.WriteString(TEXT("playerId"));
+    Writer.WriteString(Memory.PlayerId);
+    Writer.WriteString(TEXT("type"));
+    Writer.WriteString(FAGLWireNames::MemoryTypeToString(Memory.Type));
+    Writer.WriteString(TEXT("content"));
+    Writer.WriteString(Memory.Content);
+    Writer.WriteString(TEXT("emotion"));
+    Writer.WriteString(Memory.Emotion);
+    Writer.WriteString(TEXT("importance"));
+    Writer.WriteInt(Memory.Importance);
+    Writer.WriteString(TEXT("context"));
+    Writer.WriteStringMap(Memory.Context);
+    Writer.WriteString(TEXT("createdAt"));
+    Writer.WriteString(Memory.CreatedAt);
+}
+
+bool FAGLMessagePack::ReadMemory(FAGLMessagePackReader& Reader, FAGLMemory& OutMemory)
+{
+    int32 FieldCount;
+    if (!Reader.ReadMapHeader(FieldCount))
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < FieldCount; ++Index)
+    {
+        FString Key;
+        if (!Reader.ReadString(Key))
+        {
+            return false;
+        }
+
+        if (Key == TEXT("id"))
+        {
+            if (!Reader.ReadString(OutMemory.Id)) { return false; }
+        }
+        else if (Key == TEXT("playerId"))
+        {
+            if (!Reader.ReadString(OutMemory.PlayerId)) { return false; }
+        }
+        else if (Key == TEXT("type"))
+        {
+            FString Value;
+            if (!Reader.ReadString(Value)) { return false; }
+            OutMemory.Type = FAGLWireNames::StringToMemoryType(Value);
+        }
+        else if (Key == TEXT("content"))
+        {
+            if (!Reader.ReadString(OutMemory.Content)) { return false; }
+        }
+        else if (Key == TEXT("emotion"))
+        {
+            if (!Reader.ReadString(OutMemory.Emotion)) { return false; }
+        }
+        else if (Key == TEXT("importance"))
+        {
+            if (!Reader.ReadInt(OutMemory.Importance)) { return false; }
+        }
+        else if (Key == TEXT("context"))
+        {
+            if (!Reader.ReadStringMap(OutMemory.Context)) { return false; }
+        }
+        else if (Key == TEXT("createdAt"))
+        {
+            if (!Reader.ReadString(OutMemory.CreatedAt)) { return false; }
+        }
+        else if (!Reader.SkipValue())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void FAGLMessagePack::EncodeMemory(const FAGLMemory& Memory, TArray<uint8>& OutBytes)
+{
+    FAGLMessagePackWriter Writer(OutBytes);
+    WriteMemory(Writer, Memory);
+}
+
+bool FAGLMessagePack::DecodeMemory(const TArray<uint8>& Bytes, FAGLMemory& OutMemory)
+{
+    FAGLMessagePackReader Reader(Bytes);
+    return ReadMemory(Reader, OutMemory);
+}
+
+void FAGLMessagePack::EncodeMemorySearchResult(const FAGLMemorySearchResult& Result, TArray<uint8>& OutBytes)
+{
+    FAGLMessagePackWriter Writer(OutBytes);
+    Writer.WriteMapHeader(2);
+    Writer.WriteString(TEXT("memory"));
+    WriteMemory(Writer, Result.Memory);
+    Writer.WriteString(TEXT("similarityScore"));
+    Writer.WriteFloat(Result.SimilarityScore);
+}
+
+bool FAGLMessagePack::ReadMemorySearchResult(FAGLMessagePackReader& Reader, FAGLMemorySearchResult& OutResult)
+{
+    int32 FieldCount;
+    if (!Reader.ReadMapHeader(FieldCount))
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < FieldCount; ++Index)
+    {
+        FString Key;
+        if (!Reader.ReadString(Key))
+        {
+            return false;
+        }
+
+        if (Key == TEXT("memory"))
+        {
+            if (!ReadMemory(Reader, OutResult.Memory)) { return false; }
+        }
+        else if (Key == TEXT("similarityScore"))
+        {
+            if (!Reader.ReadFloat(OutResult.SimilarityScore)) { return false; }
+        }
+        else if (!Reader.SkipValue())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FAGLMessagePack::DecodeSearchResultsResponse(const TArray<uint8>& Bytes, TArray<FAGLMemorySearchResult>& OutResults)
+{
+    FAGLMessagePackReader Reader(Bytes);
+    int32 FieldCount;
+    if (!Reader.ReadMapHeader(FieldCount))
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < FieldCount; ++Index)
+    {
+        FString Key;
+        if (!Reader.ReadString(Key))
+        {
+            return false;
+        }
+
+        if (Key == TEXT("results"))
+        {
+            int32 ResultCount;
+            if (!Reader.ReadArrayHeader(ResultCount))
+            {
+                return false;
+            }
+            OutResults.Reserve(ResultCount);
+            for (int32 ResultIndex = 0; ResultIndex < ResultCount; ++ResultIndex)
+            {
+                FAGLMemorySearchResult Result;
+                if (!ReadMemorySearchResult(Reader, Result))
+                {
+                    return false;
+                }
+                OutResults.Add(MoveTemp(Result));
+            }
+        }
+        else if (!Reader.SkipValue())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool FAGLMessagePack::DecodeMemoriesResponse(const TArray<uint8>& Bytes, TArray<FAGLMemory>& OutMemories)
+{
+    FAGLMessagePackReader Reader(Bytes);
+    int32 FieldCount;
+    if (!Reader.ReadMapHeader(FieldCount))
+    {
+        return false;
+    }
+
+    for (int32 Index = 0; Index < FieldCount; ++Index)
+    {
+        FString Key;
+        if (!Reader.ReadString(Key))
+        {
+            return false;
+        }
+
+        if (Key == TEXT("memories"))
+        {
+            int32 MemoryCount;
+            if (!Reader.ReadArrayHeader(MemoryCount))
+            {
+                return false;
+            }
+            OutMemories.Reserve(MemoryCount);
+            for (int32 MemoryIndex = 0; MemoryIndex < MemoryCount; ++MemoryIndex)
+            {
+                FAGLMemory Memory;
+                if (!ReadMemory(Reader, Memory))
+                {
+                    return false;
+                }
+                OutMemories.Add(MoveTemp(Memory));
+            }
+        }
+        else if (!Reader.SkipValue())
+        {
+            return false;
+        }
+    }
+    return true;
+}
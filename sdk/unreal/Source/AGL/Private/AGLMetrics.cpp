@@ -0,0 +1,151 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLMetrics.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+
+CSV_DEFINE_CATEGORY(AGL, true);
+
+DEFINE_STAT(STAT_AGL_Requests);
+DEFINE_STAT(STAT_AGL_Failures);
+DEFINE_STAT(STAT_AGL_CacheHits);
+DEFINE_STAT(STAT_AGL_EmotionLatencyMs);
+DEFINE_STAT(STAT_AGL_DialogueLatencyMs);
+DEFINE_STAT(STAT_AGL_MemoryLatencyMs);
+DEFINE_STAT(STAT_AGL_TotalCost);
+
+FAGLMetrics& FAGLMetrics::Get()
+{
+    static FAGLMetrics Instance;
+    return Instance;
+}
+
+void FAGLMetrics::Record(EAGLMetricService Service, const FAGLMetricRecord& InRecord)
+{
+    FServiceRing& Ring = Rings[static_cast<int32>(Service)];
+
+    // Reserve a slot with one atomic increment; the record write itself
+    // is unsynchronized, so a snapshot taken while the writer laps the
+    // ring can read a torn record. The aggregates tolerate that
+    const int32 Slot = (Ring.WriteCount.Increment() - 1) & (RingCapacity - 1);
+    Ring.Records[Slot] = InRecord;
+
+    Ring.CostMicroDollars.Add(FMath::RoundToInt(InRecord.Cost * 1000000.0f));
+
+    INC_DWORD_STAT(STAT_AGL_Requests);
+    if (InRecord.bCacheHit)
+    {
+        INC_DWORD_STAT(STAT_AGL_CacheHits);
+    }
+    INC_FLOAT_STAT_BY(STAT_AGL_TotalCost, InRecord.Cost);
+
+    switch (Service)
+    {
+        case EAGLMetricService::Emotion:
+            SET_DWORD_STAT(STAT_AGL_EmotionLatencyMs, InRecord.LatencyMs);
+            CSV_CUSTOM_STAT(AGL, EmotionLatencyMs, InRecord.LatencyMs, ECsvCustomStatOp::Set);
+            break;
+
+        case EAGLMetricService::Dialogue:
+            SET_DWORD_STAT(STAT_AGL_DialogueLatencyMs, InRecord.LatencyMs);
+            CSV_CUSTOM_STAT(AGL, DialogueLatencyMs, InRecord.LatencyMs, ECsvCustomStatOp::Set);
+            break;
+
+        case EAGLMetricService::Memory:
+            SET_DWORD_STAT(STAT_AGL_MemoryLatencyMs, InRecord.LatencyMs);
+            CSV_CUSTOM_STAT(AGL, MemoryLatencyMs, InRecord.LatencyMs, ECsvCustomStatOp::Set);
+            break;
+    }
+}
+
+void FAGLMetrics::Record(EAGLMetricService Service, const FAGLEmotionResponse& Response, int32 PayloadBytes)
+{
+    FAGLMetricRecord MetricRecord;
+    MetricRecord.Method = FName(*Response.Method);
+    MetricRecord.LatencyMs = Response.LatencyMs;
+    MetricRecord.PayloadBytes = PayloadBytes;
+    MetricRecord.Cost = Response.Cost;
+    MetricRecord.bCacheHit = Response.bCacheHit;
+    Record(Service, MetricRecord);
+}
+
+void FAGLMetrics::Record(EAGLMetricService Service, const FAGLDialogueResponse& Response, int32 PayloadBytes)
+{
+    FAGLMetricRecord MetricRecord;
+    MetricRecord.Method = FName(*Response.Method);
+    MetricRecord.LatencyMs = Response.LatencyMs;
+    MetricRecord.PayloadBytes = PayloadBytes;
+    MetricRecord.Cost = Response.Cost;
+    MetricRecord.bCacheHit = Response.bCacheHit;
+    Record(Service, MetricRecord);
+}
+
+void FAGLMetrics::RecordFailure(EAGLMetricService Service)
+{
+    Rings[static_cast<int32>(Service)].FailureCount.Increment();
+    INC_DWORD_STAT(STAT_AGL_Failures);
+}
+
+FAGLMetricsSnapshot FAGLMetrics::GetSnapshot(EAGLMetricService Service) const
+{
+    const FServiceRing& Ring = Rings[static_cast<int32>(Service)];
+
+    FAGLMetricsSnapshot Snapshot;
+    Snapshot.TotalRequests = Ring.WriteCount.GetValue();
+    Snapshot.TotalFailures = Ring.FailureCount.GetValue();
+    Snapshot.TotalCost = Ring.CostMicroDollars.GetValue() / 1000000.0f;
+
+    const int32 Count = FMath::Min(Snapshot.TotalRequests, RingCapacity);
+    Snapshot.SampleCount = Count;
+    if (Count == 0)
+    {
+        return Snapshot;
+    }
+
+    int64 LatencySum = 0;
+    int64 PayloadSum = 0;
+    int32 CacheHits = 0;
+    TArray<int32, TInlineAllocator<RingCapacity>> Latencies;
+    Latencies.Reserve(Count);
+
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const FAGLMetricRecord& Entry = Ring.Records[Index];
+        LatencySum += Entry.LatencyMs;
+        PayloadSum += Entry.PayloadBytes;
+        CacheHits += Entry.bCacheHit ? 1 : 0;
+        Latencies.Add(Entry.LatencyMs);
+    }
+
+    Latencies.Sort();
+
+    Snapshot.AverageLatencyMs = static_cast<int32>(LatencySum / Count);
+    Snapshot.AveragePayloadBytes = static_cast<int32>(PayloadSum / Count);
+    Snapshot.CacheHitRate = static_cast<float>(CacheHits) / Count;
+    Snapshot.P50LatencyMs = Latencies[(Count - 1) * 50 / 100];
+    Snapshot.P95LatencyMs = Latencies[(Count - 1) * 95 / 100];
+    Snapshot.P99LatencyMs = Latencies[(Count - 1) * 99 / 100];
+
+    return Snapshot;
+}
+
+void FAGLMetrics::Reset()
+{
+    for (FServiceRing& Ring : Rings)
+    {
+        // Zeroing WriteCount gates readers off the stale records, so the
+        // ring contents themselves do not need clearing
+        Ring.WriteCount.Reset();
+        Ring.FailureCount.Reset();
+        Ring.CostMicroDollars.Reset();
+    }
+}
+
+FAGLMetricsSnapshot UAGLMetricsLibrary::GetMetricsSnapshot(EAGLMetricService Service)
+{
+    return FAGLMetrics::Get().GetSnapshot(Service);
+}
+
+void UAGLMetricsLibrary::ResetMetrics()
+{
+    FAGLMetrics::Get().Reset();
+}
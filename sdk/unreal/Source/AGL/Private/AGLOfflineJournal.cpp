@@ -0,0 +1,233 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLOfflineJournal.h"
+#include "AGLEmotionService.h"
+#include "AGLDialogueService.h"
+#include "AGLMemoryService.h"
+#include "AGLMessagePack.h"
+#include "HAL/FileManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/Archive.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+void UAGLOfflineJournal::Initialize(UAGLEmotionService* InEmotionService, UAGLDialogueService* InDialogueService, UAGLMemoryService* InMemoryService, int32 InMaxBytes, float InReplayInterval)
+{
+    EmotionService = InEmotionService;
+    DialogueService = InDialogueService;
+    MemoryService = InMemoryService;
+    MaxBytes = FMath::Max(1024, InMaxBytes);
+    ReplayInterval = FMath::Max(1.0f, InReplayInterval);
+
+    LoadFromDisk();
+
+    ReplayTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &UAGLOfflineJournal::TickReplay),
+        ReplayInterval
+    );
+
+    UE_LOG(LogTemp, Log, TEXT("AGLOfflineJournal initialized (%d records carried over, budget=%dKB, replay interval=%.0fs)"),
+        Records.Num(), MaxBytes / 1024, ReplayInterval);
+}
+
+void UAGLOfflineJournal::Shutdown()
+{
+    if (ReplayTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(ReplayTickerHandle);
+        ReplayTickerHandle.Reset();
+
+        // Persist only when this instance was initialized: the class
+        // default object runs BeginDestroy too and must not overwrite
+        // the live journal with an empty file
+        SaveToDisk();
+    }
+}
+
+void UAGLOfflineJournal::RecordEmotionRequest(const FAGLEmotionRequest& Request)
+{
+    TArray<uint8> Payload;
+    FAGLMessagePack::EncodeEmotionRequest(Request, Payload);
+    Append(ERecordKind::Emotion, FString(), MoveTemp(Payload));
+}
+
+void UAGLOfflineJournal::RecordDialogueRequest(const FAGLDialogueRequest& Request)
+{
+    TArray<uint8> Payload;
+    FAGLMessagePack::EncodeDialogueRequest(Request, Payload);
+    Append(ERecordKind::Dialogue, FString(), MoveTemp(Payload));
+}
+
+void UAGLOfflineJournal::RecordCreateMemoryRequest(const FString& PlayerId, const FAGLCreateMemoryRequest& Request)
+{
+    TArray<uint8> Payload;
+    FAGLMessagePack::EncodeCreateMemoryRequest(Request, Payload);
+    Append(ERecordKind::CreateMemory, PlayerId, MoveTemp(Payload));
+}
+
+void UAGLOfflineJournal::Append(ERecordKind Kind, const FString& PlayerId, TArray<uint8>&& Payload)
+{
+    // Coalesce: an event that failed, was replayed, and failed again
+    // must not grow the journal. Linear scan is fine at this size.
+    for (const FJournalRecord& Existing : Records)
+    {
+        if (Existing.Kind == Kind && Existing.PlayerId == PlayerId && Existing.Payload == Payload)
+        {
+            return;
+        }
+    }
+
+    // Oldest-first eviction keeps the journal inside its byte budget on
+    // long offline sessions; the newest moments are the ones worth keeping
+    while (Records.Num() > 0 && TotalPayloadBytes + Payload.Num() > MaxBytes)
+    {
+        TotalPayloadBytes -= Records[0].Payload.Num();
+        Records.RemoveAt(0);
+        UE_LOG(LogTemp, Warning, TEXT("AGLOfflineJournal: Evicted oldest record (byte budget reached)"));
+    }
+
+    FJournalRecord Record;
+    Record.Kind = Kind;
+    Record.PlayerId = PlayerId;
+    TotalPayloadBytes += Payload.Num();
+    Record.Payload = MoveTemp(Payload);
+    Records.Add(MoveTemp(Record));
+
+    SaveToDisk();
+
+    UE_LOG(LogTemp, Log, TEXT("AGLOfflineJournal: Journaled request (%d records, %d bytes)"), Records.Num(), TotalPayloadBytes);
+}
+
+bool UAGLOfflineJournal::TickReplay(float DeltaTime)
+{
+    Replay();
+    return true;
+}
+
+void UAGLOfflineJournal::Replay()
+{
+    if (Records.Num() == 0)
+    {
+        return;
+    }
+
+    // Pop a bounded batch and push it back through the normal service
+    // paths in order. While still offline the sends fail at the
+    // transport again and re-journal themselves; once connectivity is
+    // back the journal drains a batch per tick without bursting.
+    const int32 Count = FMath::Min(ReplayBatchSize, Records.Num());
+    TArray<FJournalRecord> Batch;
+    Batch.Reserve(Count);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        TotalPayloadBytes -= Records[Index].Payload.Num();
+        Batch.Add(MoveTemp(Records[Index]));
+    }
+    Records.RemoveAt(0, Count);
+    SaveToDisk();
+
+    for (const FJournalRecord& Record : Batch)
+    {
+        switch (Record.Kind)
+        {
+            case ERecordKind::Emotion:
+            {
+                FAGLEmotionRequest Request;
+                if (EmotionService && FAGLMessagePack::DecodeEmotionRequest(Record.Payload, Request))
+                {
+                    EmotionService->AnalyzeEmotion(Request, FOnEmotionAnalysisComplete());
+                }
+                break;
+            }
+            case ERecordKind::Dialogue:
+            {
+                FAGLDialogueRequest Request;
+                if (DialogueService && FAGLMessagePack::DecodeDialogueRequest(Record.Payload, Request))
+                {
+                    DialogueService->GenerateDialogue(Request, FOnDialogueGenerationComplete());
+                }
+                break;
+            }
+            case ERecordKind::CreateMemory:
+            {
+                FAGLCreateMemoryRequest Request;
+                if (MemoryService && FAGLMessagePack::DecodeCreateMemoryRequest(Record.Payload, Request))
+                {
+                    MemoryService->CreateMemory(Record.PlayerId, Request, FOnMemoryCreated());
+                }
+                break;
+            }
+        }
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("AGLOfflineJournal: Replayed %d records (%d remaining)"), Batch.Num(), Records.Num());
+}
+
+void UAGLOfflineJournal::LoadFromDisk()
+{
+    TArray<uint8> FileBytes;
+    if (!FFileHelper::LoadFileToArray(FileBytes, *GetJournalFilePath()))
+    {
+        return;
+    }
+
+    FMemoryReader Reader(FileBytes);
+    int32 Count = 0;
+    Reader << Count;
+
+    for (int32 Index = 0; Index < Count && !Reader.IsError(); ++Index)
+    {
+        FJournalRecord Record;
+        uint8 Kind = 0;
+        Reader << Kind;
+        Reader << Record.PlayerId;
+        Reader << Record.Payload;
+
+        if (Reader.IsError())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("AGLOfflineJournal: Journal file truncated, keeping %d records"), Records.Num());
+            break;
+        }
+
+        Record.Kind = static_cast<ERecordKind>(Kind);
+        TotalPayloadBytes += Record.Payload.Num();
+        Records.Add(MoveTemp(Record));
+    }
+}
+
+void UAGLOfflineJournal::SaveToDisk()
+{
+    // The journal is bounded to a couple hundred kilobytes, so a full
+    // rewrite per mutation is cheaper than managing an append log with
+    // compaction
+    TArray<uint8> FileBytes;
+    FMemoryWriter Writer(FileBytes);
+
+    int32 Count = Records.Num();
+    Writer << Count;
+
+    for (FJournalRecord& Record : Records)
+    {
+        uint8 Kind = static_cast<uint8>(Record.Kind);
+        Writer << Kind;
+        Writer << Record.PlayerId;
+        Writer << Record.Payload;
+    }
+
+    if (!FFileHelper::SaveArrayToFile(FileBytes, *GetJournalFilePath()))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AGLOfflineJournal: Failed to persist journal"));
+    }
+}
+
+FString UAGLOfflineJournal::GetJournalFilePath()
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("AGL"), TEXT("OfflineJournal.bin"));
+}
+
+void UAGLOfflineJournal::BeginDestroy()
+{
+    Shutdown();
+    Super::BeginDestroy();
+}
@@ -0,0 +1,219 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLRealtimeTransport.h"
+#include "AGLJsonWriter.h"
+#include "IWebSocket.h"
+#include "WebSocketsModule.h"
+#include "Modules/ModuleManager.h"
+#include "Json.h"
+
+void UAGLRealtimeTransport::Initialize(const FString& InGatewayUrl, const FString& InApiKey, float InTimeout)
+{
+    GatewayUrl = InGatewayUrl;
+    ApiKey = InApiKey;
+    Timeout = InTimeout;
+
+    UE_LOG(LogTemp, Log, TEXT("AGLRealtimeTransport initialized with URL: %s"), *GatewayUrl);
+}
+
+void UAGLRealtimeTransport::Connect()
+{
+    if (Socket.IsValid() && Socket->IsConnected())
+    {
+        return;
+    }
+
+    FWebSocketsModule& WebSockets = FModuleManager::LoadModuleChecked<FWebSocketsModule>(TEXT("WebSockets"));
+
+    TMap<FString, FString> Headers;
+    Headers.Add(TEXT("X-API-Key"), ApiKey);
+
+    Socket = WebSockets.CreateWebSocket(GatewayUrl, FString(), Headers);
+
+    Socket->OnConnected().AddLambda([]()
+    {
+        UE_LOG(LogTemp, Log, TEXT("AGLRealtimeTransport: Connected"));
+    });
+
+    TWeakObjectPtr<UAGLRealtimeTransport> WeakThis(this);
+    Socket->OnConnectionError().AddLambda([WeakThis](const FString& Error)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AGLRealtimeTransport: Connection error: %s"), *Error);
+        if (WeakThis.IsValid())
+        {
+            WeakThis->FailAllPending();
+        }
+    });
+
+    Socket->OnClosed().AddLambda([WeakThis](int32 StatusCode, const FString& Reason, bool bWasClean)
+    {
+        UE_LOG(LogTemp, Log, TEXT("AGLRealtimeTransport: Closed (%d: %s)"), StatusCode, *Reason);
+        if (WeakThis.IsValid())
+        {
+            WeakThis->FailAllPending();
+        }
+    });
+
+    Socket->OnMessage().AddLambda([WeakThis](const FString& Message)
+    {
+        if (WeakThis.IsValid())
+        {
+            WeakThis->HandleMessage(Message);
+        }
+    });
+
+    Socket->Connect();
+
+    if (!TimeoutTickerHandle.IsValid())
+    {
+        TimeoutTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+            FTickerDelegate::CreateUObject(this, &UAGLRealtimeTransport::TickTimeouts), 1.0f);
+    }
+}
+
+void UAGLRealtimeTransport::Shutdown()
+{
+    if (TimeoutTickerHandle.IsValid())
+    {
+        FTSTicker::GetCoreTicker().RemoveTicker(TimeoutTickerHandle);
+        TimeoutTickerHandle.Reset();
+    }
+
+    FailAllPending();
+
+    if (Socket.IsValid())
+    {
+        if (Socket->IsConnected())
+        {
+            Socket->Close();
+        }
+        Socket.Reset();
+    }
+}
+
+bool UAGLRealtimeTransport::IsConnected() const
+{
+    return Socket.IsValid() && Socket->IsConnected();
+}
+
+bool UAGLRealtimeTransport::SendRequest(const FString& Service, const FString& Route, const FString& JsonPayload, FOnRealtimeReply OnReply)
+{
+    if (!IsConnected())
+    {
+        return false;
+    }
+
+    const int32 RequestId = NextRequestId++;
+
+    // Envelope around the pre-serialized payload; the payload is raw
+    // JSON so it is spliced in without re-escaping
+    TStringBuilder<512> Builder;
+    {
+        FAGLJsonWriter Writer(Builder);
+        Writer.BeginObject();
+        Writer.WriteNumber(TEXT("id"), RequestId);
+        Writer.WriteString(TEXT("service"), Service);
+        Writer.WriteString(TEXT("route"), Route);
+        // Writer closes the object after the raw payload is appended below
+        Builder.Append(TEXT(",\"payload\":"));
+        Builder.Append(*JsonPayload);
+        Writer.EndObject();
+    }
+
+    FPendingRequest Pending;
+    Pending.Reply = MoveTemp(OnReply);
+    Pending.SentAt = FPlatformTime::Seconds();
+    PendingRequests.Add(RequestId, MoveTemp(Pending));
+
+    Socket->Send(FString(Builder.ToString()));
+    return true;
+}
+
+void UAGLRealtimeTransport::HandleMessage(const FString& Message)
+{
+    TSharedPtr<FJsonObject> JsonObject;
+    TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Message);
+
+    if (!FJsonSerializer::Deserialize(Reader, JsonObject) || !JsonObject.IsValid())
+    {
+        UE_LOG(LogTemp, Error, TEXT("AGLRealtimeTransport: Failed to parse reply envelope"));
+        return;
+    }
+
+    int32 RequestId = 0;
+    if (!JsonObject->TryGetNumberField(TEXT("id"), RequestId))
+    {
+        // Unsolicited push messages are not handled by this transport
+        return;
+    }
+
+    FPendingRequest Pending;
+    if (!PendingRequests.RemoveAndCopyValue(RequestId, Pending))
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AGLRealtimeTransport: Reply for unknown request %d"), RequestId);
+        return;
+    }
+
+    int32 Status = 0;
+    JsonObject->TryGetNumberField(TEXT("status"), Status);
+
+    const TSharedPtr<FJsonObject>* PayloadObject;
+    if (Status != 200 || !JsonObject->TryGetObjectField(TEXT("payload"), PayloadObject))
+    {
+        UE_LOG(LogTemp, Error, TEXT("AGLRealtimeTransport: Request %d failed with status %d"), RequestId, Status);
+        Pending.Reply.ExecuteIfBound(false, FString());
+        return;
+    }
+
+    // Hand the payload back as a JSON string so services reuse their
+    // existing response deserializers
+    FString Payload;
+    TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> Writer =
+        TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Payload);
+    FJsonSerializer::Serialize(PayloadObject->ToSharedRef(), Writer);
+
+    Pending.Reply.ExecuteIfBound(true, Payload);
+}
+
+void UAGLRealtimeTransport::FailAllPending()
+{
+    TMap<int32, FPendingRequest> Dropped = MoveTemp(PendingRequests);
+    PendingRequests.Reset();
+
+    for (auto& Pair : Dropped)
+    {
+        Pair.Value.Reply.ExecuteIfBound(false, FString());
+    }
+}
+
+bool UAGLRealtimeTransport::TickTimeouts(float DeltaTime)
+{
+    const double Now = FPlatformTime::Seconds();
+
+    TArray<int32> TimedOut;
+    for (const auto& Pair : PendingRequests)
+    {
+        if (Now - Pair.Value.SentAt > Timeout)
+        {
+            TimedOut.Add(Pair.Key);
+        }
+    }
+
+    for (int32 RequestId : TimedOut)
+    {
+        FPendingRequest Pending;
+        if (PendingRequests.RemoveAndCopyValue(RequestId, Pending))
+        {
+            UE_LOG(LogTemp, Warning, TEXT("AGLRealtimeTransport: Request %d timed out"), RequestId);
+            Pending.Reply.ExecuteIfBound(false, FString());
+        }
+    }
+
+    return true;
+}
+
+void UAGLRealtimeTransport::BeginDestroy()
+{
+    Shutdown();
+    Super::BeginDestroy();
+}
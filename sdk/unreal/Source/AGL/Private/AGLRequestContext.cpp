@@ -0,0 +1,83 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLRequestContext.h"
+#include "AGLCompression.h"
+
+void FAGLRequestContext::ApplyRequestBody(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest, bool bBinaryPayload, bool bCompress, int32 MinCompressBytes)
+{
+    if (bBinaryPayload)
+    {
+        if (bCompress && BinaryPayload.Num() >= MinCompressBytes
+            && FAGLCompression::Compress(BinaryPayload, CompressionScratch))
+        {
+            HttpRequest->SetHeader(TEXT("Content-Encoding"), FAGLCompression::ContentEncoding);
+            HttpRequest->SetContent(CompressionScratch);
+        }
+        else
+        {
+            HttpRequest->SetContent(BinaryPayload);
+        }
+        return;
+    }
+
+    if (bCompress && StringPayload.Len() >= MinCompressBytes)
+    {
+        FAGLCompression::StringToBytes(StringPayload, BinaryPayload);
+        if (FAGLCompression::Compress(BinaryPayload, CompressionScratch))
+        {
+            HttpRequest->SetHeader(TEXT("Content-Encoding"), FAGLCompression::ContentEncoding);
+            HttpRequest->SetContent(CompressionScratch);
+            return;
+        }
+    }
+
+    HttpRequest->SetContentAsString(StringPayload);
+}
+
+void FAGLRequestContext::Reset()
+{
+    // Reset instead of Empty keeps the allocations for the next request
+    BinaryPayload.Reset();
+    StringPayload.Reset();
+    CompressionScratch.Reset();
+
+    SchedulerKey = 0;
+    CacheKey = 0;
+    RaceId = 0;
+    PlayerId.Reset();
+    CacheEventType.Reset();
+
+    EmotionRequest = FAGLEmotionRequest();
+    DialogueRequest = FAGLDialogueRequest();
+    MemoryRequest = FAGLCreateMemoryRequest();
+
+    OnEmotion.Unbind();
+    OnDialogue.Unbind();
+    OnMemoryCreated.Unbind();
+    OnMemorySearch.Unbind();
+    OnGetMemories.Unbind();
+}
+
+FAGLRequestContext& FAGLRequestContextPool::Acquire()
+{
+    if (FreeIndices.Num() > 0)
+    {
+        const int32 Index = FreeIndices.Pop(/*bAllowShrinking*/ false);
+        return *Contexts[Index];
+    }
+
+    const int32 Index = Contexts.Add(MakeUnique<FAGLRequestContext>());
+    Contexts[Index]->PoolIndex = Index;
+    return *Contexts[Index];
+}
+
+void FAGLRequestContextPool::Release(FAGLRequestContext& Context)
+{
+    Context.Reset();
+    FreeIndices.Add(Context.PoolIndex);
+}
+
+FAGLRequestContext& FAGLRequestContextPool::Get(int32 InPoolIndex)
+{
+    return *Contexts[InPoolIndex];
+}
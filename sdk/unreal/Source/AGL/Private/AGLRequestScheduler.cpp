@@ -0,0 +1,108 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLRequestScheduler.h"
+
+void UAGLRequestScheduler::Initialize(int32 InMaxConcurrentRequests)
+{
+    MaxConcurrentRequests = FMath::Max(1, InMaxConcurrentRequests);
+
+    UE_LOG(LogTemp, Log, TEXT("AGLRequestScheduler initialized (budget: %d concurrent requests)"), MaxConcurrentRequests);
+}
+
+uint32 UAGLRequestScheduler::MakeKey(const TCHAR* Service, const FString& Payload)
+{
+    const uint32 Hash = HashCombine(GetTypeHash(FStringView(Service)), GetTypeHash(Payload));
+
+    // Zero means "not scheduled" throughout the services; a payload that
+    // happens to hash to zero would bypass completion handling and leak
+    // its pending entry and connection budget slot, so remap it
+    return Hash != 0 ? Hash : 1;
+}
+
+bool UAGLRequestScheduler::JoinOrBeginEmotion(uint32 Key, FOnEmotionAnalysisComplete OnComplete)
+{
+    if (TArray<FOnEmotionAnalysisComplete>* Waiters = PendingEmotion.Find(Key))
+    {
+        Waiters->Add(OnComplete);
+        CoalescedRequests++;
+        UE_LOG(LogTemp, Log, TEXT("AGLRequestScheduler: Coalesced duplicate emotion request (%d waiting)"), Waiters->Num());
+        return true;
+    }
+
+    TArray<FOnEmotionAnalysisComplete>& Waiters = PendingEmotion.Add(Key);
+    Waiters.Add(OnComplete);
+    ActiveRequests++;
+    return false;
+}
+
+void UAGLRequestScheduler::CompleteEmotion(uint32 Key, bool bSuccess, const FAGLEmotionResponse& Response)
+{
+    TArray<FOnEmotionAnalysisComplete> Waiters;
+    if (PendingEmotion.RemoveAndCopyValue(Key, Waiters))
+    {
+        for (FOnEmotionAnalysisComplete& Waiter : Waiters)
+        {
+            Waiter.ExecuteIfBound(bSuccess, Response);
+        }
+        NotifyRequestFinished();
+    }
+}
+
+bool UAGLRequestScheduler::JoinOrBeginDialogue(uint32 Key, FOnDialogueGenerationComplete OnComplete)
+{
+    if (TArray<FOnDialogueGenerationComplete>* Waiters = PendingDialogue.Find(Key))
+    {
+        Waiters->Add(OnComplete);
+        CoalescedRequests++;
+        UE_LOG(LogTemp, Log, TEXT("AGLRequestScheduler: Coalesced duplicate dialogue request (%d waiting)"), Waiters->Num());
+        return true;
+    }
+
+    TArray<FOnDialogueGenerationComplete>& Waiters = PendingDialogue.Add(Key);
+    Waiters.Add(OnComplete);
+    ActiveRequests++;
+    return false;
+}
+
+void UAGLRequestScheduler::CompleteDialogue(uint32 Key, bool bSuccess, const FAGLDialogueResponse& Response)
+{
+    TArray<FOnDialogueGenerationComplete> Waiters;
+    if (PendingDialogue.RemoveAndCopyValue(Key, Waiters))
+    {
+        for (FOnDialogueGenerationComplete& Waiter : Waiters)
+        {
+            Waiter.ExecuteIfBound(bSuccess, Response);
+        }
+        NotifyRequestFinished();
+    }
+}
+
+void UAGLRequestScheduler::SubmitBackground(TUniqueFunction<void()> SendRequest)
+{
+    // Foreground traffic has already claimed its slots; only start a
+    // background send while the budget has room
+    if (ActiveRequests < MaxConcurrentRequests)
+    {
+        ActiveRequests++;
+        SendRequest();
+        return;
+    }
+
+    BackgroundQueue.Add(MoveTemp(SendRequest));
+    UE_LOG(LogTemp, Log, TEXT("AGLRequestScheduler: Queued background request (%d waiting, %d in flight)"),
+        BackgroundQueue.Num(), ActiveRequests);
+}
+
+void UAGLRequestScheduler::NotifyRequestFinished()
+{
+    ActiveRequests = FMath::Max(0, ActiveRequests - 1);
+
+    // Drain one queued background send per freed slot, preserving order
+    if (BackgroundQueue.Num() > 0 && ActiveRequests < MaxConcurrentRequests)
+    {
+        TUniqueFunction<void()> Next = MoveTemp(BackgroundQueue[0]);
+        BackgroundQueue.RemoveAt(0);
+        ActiveRequests++;
+        Next();
+    }
+}
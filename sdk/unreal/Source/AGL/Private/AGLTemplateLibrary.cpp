@@ -0,0 +1,224 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLTemplateLibrary.h"
+#include "HAL/PlatformFileManager.h"
+#include "Misc/FileHelper.h"
+
+namespace
+{
+    // Pack header: magic + version + entry count
+    constexpr int64 AGLTemplateHeaderSize = 12;
+
+    // Index record: 4 dimension bytes + offset + length
+    constexpr int64 AGLTemplateRecordSize = 12;
+
+    constexpr uint8 AGLTemplateMagic[4] = { 'A', 'G', 'L', 'T' };
+
+    // Supported language codes in pack id order
+    const TCHAR* AGLTemplateLanguages[] = { TEXT("zh"), TEXT("en"), TEXT("ja"), TEXT("ko") };
+}
+
+FAGLTemplateLibrary::~FAGLTemplateLibrary()
+{
+    Unload();
+}
+
+bool FAGLTemplateLibrary::LoadPack(const FString& PackFilePath)
+{
+    Unload();
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+    // Prefer a memory map: the pack stays in the page cache and costs no
+    // private heap, which matters for console memory budgets
+    MappedFile = PlatformFile.OpenMapped(*PackFilePath);
+    if (MappedFile)
+    {
+        MappedRegion = MappedFile->MapRegion(0, MappedFile->GetFileSize());
+        if (MappedRegion)
+        {
+            PackData = MappedRegion->GetMappedPtr();
+            PackSize = MappedRegion->GetMappedSize();
+        }
+    }
+
+    // Platforms without mapped-file support read the pack instead
+    if (!PackData)
+    {
+        if (!FFileHelper::LoadFileToArray(FallbackData, *PackFilePath))
+        {
+            UE_LOG(LogTemp, Error, TEXT("AGLTemplateLibrary: Failed to open template pack %s"), *PackFilePath);
+            Unload();
+            return false;
+        }
+
+        PackData = FallbackData.GetData();
+        PackSize = FallbackData.Num();
+    }
+
+    if (!BuildIndex(PackData, PackSize))
+    {
+        UE_LOG(LogTemp, Error, TEXT("AGLTemplateLibrary: Invalid template pack %s"), *PackFilePath);
+        Unload();
+        return false;
+    }
+
+    UE_LOG(LogTemp, Log, TEXT("AGLTemplateLibrary: Loaded %d templates from %s (%s)"),
+        Index.Num(), *PackFilePath, MappedRegion ? TEXT("memory-mapped") : TEXT("fallback read"));
+    return true;
+}
+
+void FAGLTemplateLibrary::Unload()
+{
+    Index.Empty();
+    PackData = nullptr;
+    PackSize = 0;
+    BlobOffset = 0;
+    FallbackData.Empty();
+
+    if (MappedRegion)
+    {
+        delete MappedRegion;
+        MappedRegion = nullptr;
+    }
+
+    if (MappedFile)
+    {
+        delete MappedFile;
+        MappedFile = nullptr;
+    }
+}
+
+bool FAGLTemplateLibrary::TryGetTemplate(EAGLPersona Persona, EAGLEmotionType Emotion, EAGLEventType EventType, const FString& Language, FString& OutDialogue) const
+{
+    if (!PackData)
+    {
+        return false;
+    }
+
+    const uint8 LanguageId = LanguageToId(Language);
+    if (LanguageId == 0xFF)
+    {
+        return false;
+    }
+
+    const FIndexedTemplate* Entry = Index.Find(MakeKey(Persona, Emotion, EventType, LanguageId));
+    if (!Entry)
+    {
+        return false;
+    }
+
+    const ANSICHAR* Text = reinterpret_cast<const ANSICHAR*>(PackData + BlobOffset + Entry->TextOffset);
+    FUTF8ToTCHAR Converted(Text, Entry->TextLength);
+    OutDialogue = FString(Converted.Length(), Converted.Get());
+    return true;
+}
+
+bool FAGLTemplateLibrary::CookPack(const TArray<FTemplateEntry>& Entries, const FString& PackFilePath)
+{
+    TArray<uint8> Pack;
+    TArray<uint8> Blob;
+
+    // Header
+    Pack.Append(AGLTemplateMagic, sizeof(AGLTemplateMagic));
+    const uint32 Version = PackVersion;
+    Pack.Append(reinterpret_cast<const uint8*>(&Version), sizeof(Version));
+    const uint32 Count = Entries.Num();
+    Pack.Append(reinterpret_cast<const uint8*>(&Count), sizeof(Count));
+
+    // Index records with text appended to the blob
+    for (const FTemplateEntry& Entry : Entries)
+    {
+        const uint8 LanguageId = LanguageToId(Entry.Language);
+        if (LanguageId == 0xFF)
+        {
+            UE_LOG(LogTemp, Error, TEXT("AGLTemplateLibrary: Unsupported language %s in pack"), *Entry.Language);
+            return false;
+        }
+
+        FTCHARToUTF8 Utf8Text(*Entry.Text);
+        const uint32 TextOffset = Blob.Num();
+        const uint32 TextLength = Utf8Text.Length();
+        Blob.Append(reinterpret_cast<const uint8*>(Utf8Text.Get()), TextLength);
+
+        Pack.Add(static_cast<uint8>(Entry.Persona));
+        Pack.Add(static_cast<uint8>(Entry.Emotion));
+        Pack.Add(static_cast<uint8>(Entry.EventType));
+        Pack.Add(LanguageId);
+        Pack.Append(reinterpret_cast<const uint8*>(&TextOffset), sizeof(TextOffset));
+        Pack.Append(reinterpret_cast<const uint8*>(&TextLength), sizeof(TextLength));
+    }
+
+    Pack.Append(Blob);
+
+    return FFileHelper::SaveArrayToFile(Pack, *PackFilePath);
+}
+
+uint32 FAGLTemplateLibrary::MakeKey(EAGLPersona Persona, EAGLEmotionType Emotion, EAGLEventType EventType, uint8 LanguageId)
+{
+    return (static_cast<uint32>(Persona) << 24)
+        | (static_cast<uint32>(Emotion) << 16)
+        | (static_cast<uint32>(EventType) << 8)
+        | LanguageId;
+}
+
+uint8 FAGLTemplateLibrary::LanguageToId(const FString& Language)
+{
+    for (uint8 Id = 0; Id < UE_ARRAY_COUNT(AGLTemplateLanguages); ++Id)
+    {
+        if (Language.Equals(AGLTemplateLanguages[Id], ESearchCase::IgnoreCase))
+        {
+            return Id;
+        }
+    }
+    return 0xFF;
+}
+
+bool FAGLTemplateLibrary::BuildIndex(const uint8* Data, int64 DataSize)
+{
+    if (DataSize < AGLTemplateHeaderSize || FMemory::Memcmp(Data, AGLTemplateMagic, sizeof(AGLTemplateMagic)) != 0)
+    {
+        return false;
+    }
+
+    uint32 Version = 0;
+    FMemory::Memcpy(&Version, Data + 4, sizeof(Version));
+    if (Version != PackVersion)
+    {
+        UE_LOG(LogTemp, Error, TEXT("AGLTemplateLibrary: Unsupported pack version %u"), Version);
+        return false;
+    }
+
+    uint32 Count = 0;
+    FMemory::Memcpy(&Count, Data + 8, sizeof(Count));
+
+    BlobOffset = AGLTemplateHeaderSize + static_cast<int64>(Count) * AGLTemplateRecordSize;
+    if (BlobOffset > DataSize)
+    {
+        return false;
+    }
+
+    Index.Reserve(Count);
+    for (uint32 RecordIndex = 0; RecordIndex < Count; ++RecordIndex)
+    {
+        const uint8* Record = Data + AGLTemplateHeaderSize + RecordIndex * AGLTemplateRecordSize;
+
+        FIndexedTemplate Entry;
+        FMemory::Memcpy(&Entry.TextOffset, Record + 4, sizeof(Entry.TextOffset));
+        FMemory::Memcpy(&Entry.TextLength, Record + 8, sizeof(Entry.TextLength));
+
+        // Reject records whose text runs past the end of the pack
+        if (BlobOffset + static_cast<int64>(Entry.TextOffset) + Entry.TextLength > DataSize)
+        {
+            return false;
+        }
+
+        const uint32 Key = (static_cast<uint32>(Record[0]) << 24)
+            | (static_cast<uint32>(Record[1]) << 16)
+            | (static_cast<uint32>(Record[2]) << 8)
+            | Record[3];
+        Index.Add(Key, Entry);
+    }
+
+    return true;
+}
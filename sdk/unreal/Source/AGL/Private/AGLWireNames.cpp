@@ -0,0 +1,135 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLWireNames.h"
+
+namespace
+{
+    // One ordered table per enum drives both directions, so the wire
+    // spelling for a value can never drift between serializers. Tables
+    // are indexed by the underlying enum value; the StringTo direction
+    // builds an FName index from the same table on first use (magic
+    // static, so the build is thread-safe for the TaskGraph decoders).
+
+    template <typename EnumType, int32 N>
+    const TCHAR* TableToString(const TCHAR* const (&Table)[N], EnumType Value, const TCHAR* Default)
+    {
+        const uint8 Index = static_cast<uint8>(Value);
+        return Index < N ? Table[Index] : Default;
+    }
+
+    template <typename EnumType, int32 N>
+    TMap<FName, EnumType> BuildIndex(const TCHAR* const (&Table)[N])
+    {
+        TMap<FName, EnumType> Index;
+        Index.Reserve(N);
+        for (int32 Value = 0; Value < N; ++Value)
+        {
+            Index.Add(FName(Table[Value]), static_cast<EnumType>(Value));
+        }
+        return Index;
+    }
+
+    template <typename EnumType>
+    EnumType IndexToEnum(const TMap<FName, EnumType>& Index, const FString& Name, EnumType Default)
+    {
+        // FNAME_Find never grows the name table, so malformed wire data
+        // cannot bloat it; strings the index has never seen miss cleanly
+        const FName Key(*Name, FNAME_Find);
+        if (Key.IsNone())
+        {
+            return Default;
+        }
+
+        const EnumType* Found = Index.Find(Key);
+        return Found ? *Found : Default;
+    }
+
+    const TCHAR* const GEventTypeNames[] = {
+        TEXT("player.victory"),
+        TEXT("player.defeat"),
+        TEXT("player.kill"),
+        TEXT("player.death"),
+        TEXT("player.achievement"),
+        TEXT("player.levelup"),
+        TEXT("player.loot"),
+        TEXT("player.sessionstart"),
+        TEXT("player.sessionend")
+    };
+
+    const TCHAR* const GEmotionTypeNames[] = {
+        TEXT("happy"),
+        TEXT("excited"),
+        TEXT("amazed"),
+        TEXT("proud"),
+        TEXT("satisfied"),
+        TEXT("cheerful"),
+        TEXT("grateful"),
+        TEXT("sad"),
+        TEXT("disappointed"),
+        TEXT("frustrated"),
+        TEXT("angry"),
+        TEXT("worried"),
+        TEXT("tired"),
+        TEXT("neutral")
+    };
+
+    const TCHAR* const GPersonaNames[] = {
+        TEXT("cheerful"),
+        TEXT("cool"),
+        TEXT("cute")
+    };
+
+    const TCHAR* const GMemoryTypeNames[] = {
+        TEXT("achievement"),
+        TEXT("milestone"),
+        TEXT("first_time"),
+        TEXT("dramatic"),
+        TEXT("conversation"),
+        TEXT("event"),
+        TEXT("observation")
+    };
+}
+
+const TCHAR* FAGLWireNames::EventTypeToString(EAGLEventType EventType)
+{
+    return TableToString(GEventTypeNames, EventType, TEXT("unknown"));
+}
+
+EAGLEventType FAGLWireNames::StringToEventType(const FString& EventString)
+{
+    static const TMap<FName, EAGLEventType> Index = BuildIndex<EAGLEventType>(GEventTypeNames);
+    return IndexToEnum(Index, EventString, EAGLEventType::Victory);
+}
+
+const TCHAR* FAGLWireNames::EmotionTypeToString(EAGLEmotionType EmotionType)
+{
+    return TableToString(GEmotionTypeNames, EmotionType, TEXT("neutral"));
+}
+
+EAGLEmotionType FAGLWireNames::StringToEmotionType(const FString& EmotionString)
+{
+    static const TMap<FName, EAGLEmotionType> Index = BuildIndex<EAGLEmotionType>(GEmotionTypeNames);
+    return IndexToEnum(Index, EmotionString, EAGLEmotionType::Neutral);
+}
+
+const TCHAR* FAGLWireNames::PersonaToString(EAGLPersona Persona)
+{
+    return TableToString(GPersonaNames, Persona, TEXT("cheerful"));
+}
+
+EAGLPersona FAGLWireNames::StringToPersona(const FString& PersonaString)
+{
+    static const TMap<FName, EAGLPersona> Index = BuildIndex<EAGLPersona>(GPersonaNames);
+    return IndexToEnum(Index, PersonaString, EAGLPersona::Cheerful);
+}
+
+const TCHAR* FAGLWireNames::MemoryTypeToString(EAGLMemoryType MemoryType)
+{
+    return TableToString(GMemoryTypeNames, MemoryType, TEXT("event"));
+}
+
+EAGLMemoryType FAGLWireNames::StringToMemoryType(const FString& TypeString)
+{
+    static const TMap<FName, EAGLMemoryType> Index = BuildIndex<EAGLMemoryType>(GMemoryTypeNames);
+    return IndexToEnum(Index, TypeString, EAGLMemoryType::Event);
+}
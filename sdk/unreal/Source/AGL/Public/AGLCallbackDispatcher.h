@@ -0,0 +1,106 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Containers/Ticker.h"
+#include "AGLCallbackDispatcher.generated.h"
+
+/** Which service's responses a queued callback belongs to */
+enum class EAGLCallbackLane : uint8
+{
+    Emotion = 0,
+    Dialogue = 1,
+    Memory = 2,
+    Count = 3
+};
+
+/**
+ * Tick-budgeted queue for completed-response callbacks
+ *
+ * When a batch of responses lands in the same frame — a reconnect
+ * replaying the offline journal, or a burst of emotion events — every
+ * ExecuteIfBound plus the Blueprint logic behind it used to run
+ * back-to-back inside HTTP completion processing and blow the frame
+ * budget. The dispatcher queues completed responses per service lane
+ * and drains them each tick under a configurable time budget, so a
+ * burst spreads across a few frames instead of hitching one.
+ *
+ * Lanes are FIFO, so callbacks for one service always run in completion
+ * order; draining round-robins across lanes so a busy service cannot
+ * starve the others. High-priority responses (active dialogue) bypass
+ * the budget: a bypass first drains its own lane, then runs inline, so
+ * ordering still holds. At least one item runs per tick even when a
+ * single callback overruns the budget, guaranteeing forward progress.
+ */
+UCLASS(BlueprintType)
+class AGL_API UAGLCallbackDispatcher : public UObject
+{
+    GENERATED_BODY()
+
+    // Friend test classes for testing protected members
+    friend class FAGLCallbackDispatcherBudgetTest;
+
+public:
+    /**
+     * Initialize the dispatcher and start the per-frame drain ticker
+     * @param InFrameBudgetMs Milliseconds of callback work per frame
+     */
+    void Initialize(float InFrameBudgetMs);
+
+    /** Stop the drain ticker, running any callbacks still queued */
+    void Shutdown();
+
+    //~ Begin UObject Interface
+    virtual void BeginDestroy() override;
+    //~ End UObject Interface
+
+    /**
+     * Queue a completed-response callback for budgeted execution
+     * @param Lane Service lane the callback belongs to
+     * @param Work The delegate execution, already bound to its payload
+     * @param bBypassBudget Drain the lane and run now instead of queueing
+     */
+    void Dispatch(EAGLCallbackLane Lane, TFunction<void()>&& Work, bool bBypassBudget = false);
+
+    /** Number of callbacks queued across all lanes */
+    UFUNCTION(BlueprintPure, Category = "AGL|Dispatcher")
+    int32 GetPendingCount() const;
+
+    /** Callbacks executed since initialization */
+    UFUNCTION(BlueprintPure, Category = "AGL|Dispatcher")
+    int64 GetDispatchedCount() const { return DispatchedCount; }
+
+protected:
+    /** One service's FIFO of queued callbacks (game thread only) */
+    struct FLane
+    {
+        /** Queued callback executions in completion order */
+        TArray<TFunction<void()>> Items;
+
+        /** Index of the next item to run; avoids RemoveAt(0) shuffles */
+        int32 Head = 0;
+    };
+
+    /** Drain queued callbacks under the frame budget */
+    bool TickDrain(float DeltaTime);
+
+    /** Run everything queued in one lane, ignoring the budget */
+    void DrainLane(FLane& Lane);
+
+    /** Per-service queues, indexed by EAGLCallbackLane */
+    FLane Lanes[static_cast<int32>(EAGLCallbackLane::Count)];
+
+    /** Milliseconds of callback work allowed per frame */
+    float FrameBudgetMs = 2.0f;
+
+    /** Round-robin cursor so one lane cannot starve the others */
+    int32 NextLane = 0;
+
+    /** Callbacks executed since initialization */
+    int64 DispatchedCount = 0;
+
+    /** Ticker handle for the per-frame drain */
+    FTSTicker::FDelegateHandle DrainTickerHandle;
+};
@@ -8,6 +8,13 @@
 #include "AGLEmotionService.h"
 #include "AGLDialogueService.h"
 #include "AGLMemoryService.h"
+#include "AGLConnectionPool.h"
+#include "AGLEventBatcher.h"
+#include "AGLRealtimeTransport.h"
+#include "AGLRequestScheduler.h"
+#include "AGLMemoryWriteQueue.h"
+#include "AGLOfflineJournal.h"
+#include "AGLCallbackDispatcher.h"
 #include "AGLClient.generated.h"
 
 /**
@@ -88,6 +95,62 @@ public:
     UFUNCTION(BlueprintPure, Category = "AGL")
     UAGLMemoryService* GetMemoryService() const { return MemoryService; }
 
+    /**
+     * Get the event batcher for coalesced emotion submission
+     * @return Event batcher instance
+     */
+    UFUNCTION(BlueprintPure, Category = "AGL")
+    UAGLEventBatcher* GetEventBatcher() const { return EventBatcher; }
+
+    /**
+     * Get the shared connection pool
+     * @return Connection pool instance
+     */
+    UFUNCTION(BlueprintPure, Category = "AGL")
+    UAGLConnectionPool* GetConnectionPool() const { return ConnectionPool; }
+
+    /**
+     * Get the realtime WebSocket transport
+     * @return Transport instance, or null when WebSocket mode is off
+     */
+    UFUNCTION(BlueprintPure, Category = "AGL")
+    UAGLRealtimeTransport* GetRealtimeTransport() const { return RealtimeTransport; }
+
+    /**
+     * Get the request scheduler that coalesces and prioritizes traffic
+     * @return Scheduler instance, or null when scheduling is off
+     */
+    UFUNCTION(BlueprintPure, Category = "AGL")
+    UAGLRequestScheduler* GetRequestScheduler() const { return RequestScheduler; }
+
+    /**
+     * Get the write-behind queue for bulk memory uploads
+     * @return Queue instance, or null when write-behind mode is off
+     */
+    UFUNCTION(BlueprintPure, Category = "AGL")
+    UAGLMemoryWriteQueue* GetMemoryWriteQueue() const { return MemoryWriteQueue; }
+
+    /**
+     * Get the offline journal that replays failed requests
+     * @return Journal instance, or null when journaling is off
+     */
+    UFUNCTION(BlueprintPure, Category = "AGL")
+    UAGLOfflineJournal* GetOfflineJournal() const { return OfflineJournal; }
+
+    /**
+     * Get the dispatcher that drains response callbacks under a frame budget
+     * @return Dispatcher instance, or null when budgeting is off
+     */
+    UFUNCTION(BlueprintPure, Category = "AGL")
+    UAGLCallbackDispatcher* GetCallbackDispatcher() const { return CallbackDispatcher; }
+
+    /**
+     * Flush batched traffic when the play session ends, so queued
+     * memories and events are not lost to process teardown
+     */
+    UFUNCTION(BlueprintCallable, Category = "AGL")
+    void NotifySessionEnd();
+
     /**
      * Get the current configuration
      * @return Configuration settings
@@ -127,6 +190,34 @@ protected:
     UPROPERTY()
     UAGLMemoryService* MemoryService;
 
+    /** Shared HTTP connection pool */
+    UPROPERTY()
+    UAGLConnectionPool* ConnectionPool;
+
+    /** Batcher that coalesces emotion requests into single round trips */
+    UPROPERTY()
+    UAGLEventBatcher* EventBatcher;
+
+    /** Persistent WebSocket transport (null when WebSocket mode is off) */
+    UPROPERTY()
+    UAGLRealtimeTransport* RealtimeTransport;
+
+    /** Request scheduler for dedup and prioritization (null when off) */
+    UPROPERTY()
+    UAGLRequestScheduler* RequestScheduler;
+
+    /** Write-behind queue for bulk memory uploads (null when off) */
+    UPROPERTY()
+    UAGLMemoryWriteQueue* MemoryWriteQueue;
+
+    /** Offline journal that replays failed requests (null when off) */
+    UPROPERTY()
+    UAGLOfflineJournal* OfflineJournal;
+
+    /** Tick-budgeted callback dispatcher (null when off) */
+    UPROPERTY()
+    UAGLCallbackDispatcher* CallbackDispatcher;
+
     /** Whether client is initialized */
     bool bInitialized = false;
 };
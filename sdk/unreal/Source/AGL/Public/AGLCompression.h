@@ -0,0 +1,54 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Gzip helpers for HTTP payload compression
+ *
+ * Memory-heavy responses (GetMemories, SearchMemories with 100+ results)
+ * run to hundreds of kilobytes of verbose JSON; gzip cuts that 5-10x,
+ * which matters most for mobile players on cellular links. Services
+ * advertise gzip via Accept-Encoding, inflate compressed responses on
+ * the background parse task, and gzip large request bodies.
+ *
+ * Built on the engine's FCompression gzip format; the expected inflated
+ * size comes from the gzip trailer, with a sanity cap so a corrupt
+ * length field cannot trigger a huge allocation.
+ */
+struct AGL_API FAGLCompression
+{
+    /** Wire name for the Content-Encoding / Accept-Encoding headers */
+    static const TCHAR* ContentEncoding;
+
+    /**
+     * Gzip a payload
+     * @param Plain Bytes to compress
+     * @param OutCompressed Receives the gzip stream; reuses capacity
+     * @return True on success; failure leaves OutCompressed undefined
+     */
+    static bool Compress(const TArray<uint8>& Plain, TArray<uint8>& OutCompressed);
+
+    /**
+     * Inflate a gzip stream
+     * @param Compressed Gzip bytes, including header and trailer
+     * @param OutPlain Receives the inflated bytes; reuses capacity
+     * @return True on success; malformed or truncated input fails
+     */
+    static bool Decompress(const TArray<uint8>& Compressed, TArray<uint8>& OutPlain);
+
+    /**
+     * Interpret inflated bytes as UTF-8 text
+     * @param Utf8Bytes Inflated response body
+     * @return Decoded string
+     */
+    static FString BytesToString(const TArray<uint8>& Utf8Bytes);
+
+    /**
+     * Encode text as UTF-8 bytes for compression
+     * @param Text Serialized request body
+     * @param OutUtf8Bytes Receives the encoded bytes; reuses capacity
+     */
+    static void StringToBytes(const FString& Text, TArray<uint8>& OutUtf8Bytes);
+};
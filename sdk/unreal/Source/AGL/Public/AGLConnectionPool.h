@@ -0,0 +1,96 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Containers/Ticker.h"
+#include "AGLTypes.h"
+#include "AGLConnectionPool.generated.h"
+
+/**
+ * Pooled HTTP connection manager shared by all AGL services
+ *
+ * Creating a fresh request per call pays the full TCP+TLS handshake on
+ * nearly every round trip. The pool keeps warm keep-alive connections per
+ * service URL: completed request objects are returned to the pool and
+ * reused, and startup warm-up primes one connection per configured
+ * service so the first real call does not pay the handshake either.
+ *
+ * The pool is owned by UAGLClient and handed to each service during
+ * Initialize. Pool size and idle eviction are configured via FAGLConfig.
+ */
+UCLASS()
+class AGL_API UAGLConnectionPool : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Initialize the pool
+     * @param InPoolSize Maximum idle connections kept per service URL
+     * @param InIdleTimeout Seconds before an idle connection is evicted
+     */
+    void Initialize(int32 InPoolSize, float InIdleTimeout);
+
+    /** Shut down the pool and release all idle connections */
+    void Shutdown();
+
+    //~ Begin UObject Interface
+    virtual void BeginDestroy() override;
+    //~ End UObject Interface
+
+    /**
+     * Acquire a request bound to a warm connection for the given service URL.
+     * Falls back to a fresh request when the pool is empty.
+     * @param ServiceUrl Base URL of the target service
+     * @return HTTP request ready for configuration
+     */
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> AcquireRequest(const FString& ServiceUrl);
+
+    /**
+     * Return a completed request's connection to the pool for reuse.
+     * @param ServiceUrl Base URL the request was acquired for
+     * @param Request The completed request
+     */
+    void ReleaseRequest(const FString& ServiceUrl, const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& Request);
+
+    /**
+     * Pre-establish a connection to a service so the first call is warm.
+     * @param ServiceUrl Base URL of the service to warm up
+     */
+    void WarmUp(const FString& ServiceUrl);
+
+    /** Number of idle pooled connections for a service URL */
+    int32 GetIdleCount(const FString& ServiceUrl) const;
+
+protected:
+    /** An idle connection waiting for reuse */
+    struct FPooledConnection
+    {
+        /** The reusable request object holding the keep-alive connection */
+        TSharedPtr<IHttpRequest, ESPMode::ThreadSafe> Request;
+
+        /** When the connection was last used (FPlatformTime::Seconds) */
+        double LastUsedTime = 0.0;
+    };
+
+    /** Evict connections idle longer than IdleTimeout */
+    bool TickEviction(float DeltaTime);
+
+    /** Idle connections keyed by service base URL */
+    TMap<FString, TArray<FPooledConnection>> IdleConnections;
+
+    /** Maximum idle connections kept per service URL */
+    int32 PoolSize = 4;
+
+    /** Seconds before an idle connection is evicted */
+    float IdleTimeout = 60.0f;
+
+    /** Ticker handle for idle eviction */
+    FTSTicker::FDelegateHandle EvictionTickerHandle;
+
+    /** Guards IdleConnections (HTTP completion can run off the game thread) */
+    mutable FCriticalSection PoolLock;
+};
@@ -0,0 +1,108 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AGLTypes.h"
+
+/**
+ * Per-session cache of memory context, keyed by event type
+ *
+ * GetContext sits on the critical path of every LLM-path dialogue: the
+ * memories are fetched right before generation, adding a full round trip
+ * (~150-300ms) to perceived dialogue latency. This cache lets the client
+ * prefetch context for the common event types when a session starts and
+ * serve later lookups locally, with the network used only to revalidate
+ * in the background.
+ *
+ * Entries belong to a single player; switching players clears the cache.
+ * Newly created memories are folded into every cached entry so the
+ * context stays current between revalidations without extra fetches.
+ * Hit/miss counters are exposed so integrators can verify the win.
+ */
+class AGL_API FAGLContextCache
+{
+public:
+    /**
+     * Configure expiry and per-entry size
+     * @param InTTLSeconds Seconds before an entry expires
+     * @param InMaxMemoriesPerEntry Memories kept per event type
+     */
+    void Configure(float InTTLSeconds, int32 InMaxMemoriesPerEntry);
+
+    /**
+     * Bind the cache to a player; entries from a previous player are
+     * dropped
+     * @param InPlayerId Player the cached context belongs to
+     */
+    void SetPlayer(const FString& InPlayerId);
+
+    /** Player the cached context belongs to */
+    const FString& GetPlayer() const { return PlayerId; }
+
+    /**
+     * Look up cached context for an event type
+     * @param ForPlayerId Player the lookup is for; mismatches miss
+     * @param EventType Event type string (e.g. "player.victory")
+     * @param OutMemories Receives the cached memories on a hit
+     * @return True on a fresh hit; expired entries count as misses
+     */
+    bool TryGet(const FString& ForPlayerId, const FString& EventType, TArray<FAGLMemory>& OutMemories);
+
+    /**
+     * Store fetched context, replacing any existing entry
+     * @param ForPlayerId Player the context was fetched for; stale
+     *        responses for a previous player are ignored
+     * @param EventType Event type string the context was fetched for
+     * @param Memories Fetched memories
+     */
+    void Put(const FString& ForPlayerId, const FString& EventType, const TArray<FAGLMemory>& Memories);
+
+    /**
+     * Fold a newly created memory into every cached entry so served
+     * context includes it before the next revalidation
+     * @param ForPlayerId Player the memory was created for
+     * @param Memory The created memory
+     */
+    void AddMemory(const FString& ForPlayerId, const FAGLMemory& Memory);
+
+    /** Remove all entries and reset counters */
+    void Reset();
+
+    /** Number of lookups answered from the cache */
+    int32 GetHitCount() const { return HitCount; }
+
+    /** Number of lookups that fell through to the network */
+    int32 GetMissCount() const { return MissCount; }
+
+    /** Current number of cached event types */
+    int32 GetEntryCount() const { return Entries.Num(); }
+
+private:
+    /** One event type's context with bookkeeping for TTL */
+    struct FCacheEntry
+    {
+        TArray<FAGLMemory> Memories;
+
+        /** When the entry was stored (FPlatformTime::Seconds) */
+        double InsertTime = 0.0;
+    };
+
+    /** Cached context keyed by event type string */
+    TMap<FString, FCacheEntry> Entries;
+
+    /** Player the cached context belongs to */
+    FString PlayerId;
+
+    /** Seconds before an entry expires */
+    float TTLSeconds = 300.0f;
+
+    /** Memories kept per event type */
+    int32 MaxMemoriesPerEntry = 5;
+
+    /** Lookups answered from the cache */
+    int32 HitCount = 0;
+
+    /** Lookups that fell through to the network */
+    int32 MissCount = 0;
+};
@@ -0,0 +1,95 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AGLTypes.h"
+
+/**
+ * In-process LRU cache for dialogue responses
+ *
+ * The backend already caches dialogues for an hour, but discovering a
+ * cache hit still cost a full round trip. Since roughly 60% of dialogue
+ * requests within a session are exact repeats, caching responses
+ * client-side eliminates those round trips and their API cost entirely.
+ *
+ * Entries are keyed by a hash of (EventType, Emotion, Persona, Language,
+ * Context), expire after a configurable TTL, and are evicted
+ * least-recently-used once the entry cap is reached. Hit/miss counters
+ * are exposed so integrators can verify the win.
+ */
+class AGL_API FAGLDialogueCache
+{
+public:
+    /**
+     * Configure capacity and expiry
+     * @param InMaxEntries Entry cap before LRU eviction
+     * @param InTTLSeconds Seconds before an entry expires
+     */
+    void Configure(int32 InMaxEntries, float InTTLSeconds);
+
+    /**
+     * Compute the cache key for a dialogue request.
+     * Context pairs are hashed order-independently so logically equal
+     * requests built in different orders share an entry.
+     */
+    static uint32 ComputeKey(const FAGLDialogueRequest& Request);
+
+    /**
+     * Look up a cached response
+     * @param Key Key from ComputeKey
+     * @param OutResponse Receives the cached response on a hit
+     * @return True on a fresh hit; expired entries count as misses
+     */
+    bool TryGet(uint32 Key, FAGLDialogueResponse& OutResponse);
+
+    /**
+     * Store a response, evicting the least-recently-used entry if full
+     * @param Key Key from ComputeKey
+     * @param Response Response to cache
+     */
+    void Put(uint32 Key, const FAGLDialogueResponse& Response);
+
+    /** Remove all entries and reset counters */
+    void Reset();
+
+    /** Number of lookups answered from the cache */
+    int32 GetHitCount() const { return HitCount; }
+
+    /** Number of lookups that fell through to the network */
+    int32 GetMissCount() const { return MissCount; }
+
+    /** Current number of cached entries */
+    int32 GetEntryCount() const { return Entries.Num(); }
+
+private:
+    /** One cached response with bookkeeping for TTL and LRU */
+    struct FCacheEntry
+    {
+        FAGLDialogueResponse Response;
+
+        /** When the entry was stored (FPlatformTime::Seconds) */
+        double InsertTime = 0.0;
+
+        /** When the entry was last read, for LRU eviction */
+        double LastAccessTime = 0.0;
+    };
+
+    /** Evict the least-recently-used entry */
+    void EvictOldest();
+
+    /** Cached responses keyed by request hash */
+    TMap<uint32, FCacheEntry> Entries;
+
+    /** Entry cap before LRU eviction */
+    int32 MaxEntries = 256;
+
+    /** Seconds before an entry expires (matches the backend's 1h default) */
+    float TTLSeconds = 3600.0f;
+
+    /** Lookups answered from the cache */
+    int32 HitCount = 0;
+
+    /** Lookups that fell through to the network */
+    int32 MissCount = 0;
+};
@@ -4,12 +4,19 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "HAL/ThreadSafeCounter64.h"
 #include "Interfaces/IHttpRequest.h"
 #include "AGLTypes.h"
+#include "AGLRequestContext.h"
+#include "AGLTemplateLibrary.h"
+#include "AGLDialogueCache.h"
 #include "AGLDialogueService.generated.h"
 
-/** Delegate for dialogue generation completion */
-DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnDialogueGenerationComplete, bool, bSuccess, const FAGLDialogueResponse&, Response);
+class UAGLConnectionPool;
+class UAGLRealtimeTransport;
+class UAGLRequestScheduler;
+class UAGLOfflineJournal;
+class UAGLCallbackDispatcher;
 
 /**
  * Service for generating dynamic NPC dialogue
@@ -35,6 +42,7 @@ class AGL_API UAGLDialogueService : public UObject
     friend class FAGLEnumConversionTest;
     friend class FAGLDialogueRequestSerializationTest;
     friend class FAGLDialogueResponseDeserializationTest;
+    friend class FAGLDialogueRaceWindowTest;
 
 public:
     /**
@@ -42,8 +50,9 @@ public:
      * @param InServiceUrl Service base URL
      * @param InApiKey API key for authentication
      * @param InTimeout Request timeout in seconds
+     * @param InConnectionPool Optional shared connection pool for keep-alive reuse
      */
-    void Initialize(const FString& InServiceUrl, const FString& InApiKey, float InTimeout);
+    void Initialize(const FString& InServiceUrl, const FString& InApiKey, float InTimeout, UAGLConnectionPool* InConnectionPool = nullptr);
 
     /**
      * Generate dialogue for a game event
@@ -53,6 +62,103 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AGL|Dialogue")
     void GenerateDialogue(const FAGLDialogueRequest& Request, FOnDialogueGenerationComplete OnComplete);
 
+    /**
+     * Load the offline dialogue template pack
+     * @param PackFilePath Path to the cooked .aglt pack
+     * @param bInUseLocalTemplates Serve matching requests locally
+     * @return True when the pack was loaded
+     */
+    bool LoadTemplatePack(const FString& PackFilePath, bool bInUseLocalTemplates = true);
+
+    /** Whether the offline template library is loaded */
+    bool HasTemplateLibrary() const { return TemplateLibrary.IsLoaded(); }
+
+    /**
+     * Configure the client-side response cache
+     * @param bInUseCache Serve repeat requests from the cache
+     * @param InTTLSeconds Seconds before a cached entry expires
+     * @param InMaxEntries Entry cap before LRU eviction
+     */
+    void ConfigureResponseCache(bool bInUseCache, float InTTLSeconds, int32 InMaxEntries);
+
+    /**
+     * Race local templates against the cloud: a template match is still
+     * delivered within the frame, but a forced-LLM escalation fires in
+     * parallel and the delegate is invoked a second time with the richer
+     * line if it arrives inside the window. Response.Method tells the
+     * two apart (template vs llm).
+     * @param bInUseRaceMode Escalate template matches to the LLM
+     * @param InUpgradeWindowSeconds Seconds a late LLM line may still upgrade
+     */
+    void ConfigureRaceMode(bool bInUseRaceMode, float InUpgradeWindowSeconds);
+
+    /**
+     * Attach the shared realtime transport; requests multiplex over the
+     * WebSocket when connected and fall back to HTTP otherwise
+     * @param InTransport Transport instance, or null to disable
+     */
+    void SetRealtimeTransport(UAGLRealtimeTransport* InTransport);
+
+    /**
+     * Switch HTTP payloads between JSON and MessagePack
+     * @param bInUseBinaryEncoding Send and accept application/msgpack
+     */
+    void SetBinaryEncoding(bool bInUseBinaryEncoding);
+
+    /**
+     * Attach the shared request scheduler; identical in-flight requests
+     * coalesce into one network call
+     * @param InScheduler Scheduler instance, or null to disable
+     */
+    void SetRequestScheduler(UAGLRequestScheduler* InScheduler);
+
+    /**
+     * Attach the offline journal; requests that fail at the transport
+     * level are captured and replayed when connectivity returns
+     * @param InJournal Journal instance, or null to disable
+     */
+    void SetOfflineJournal(UAGLOfflineJournal* InJournal);
+
+    /**
+     * Negotiate gzip on HTTP traffic
+     * @param bInUseCompression Advertise gzip and inflate responses
+     * @param bInCompressRequestBodies Also gzip outgoing request bodies;
+     *        requires inflation middleware on the service
+     * @param InMinRequestBytes Gzip request bodies at or above this size
+     */
+    void SetCompression(bool bInUseCompression, bool bInCompressRequestBodies, int32 InMinRequestBytes);
+
+    /**
+     * Attach the shared callback dispatcher; dialogue drives the active
+     * conversation, so its responses take the priority bypass
+     * @param InDispatcher Dispatcher instance, or null to run callbacks inline
+     */
+    void SetCallbackDispatcher(UAGLCallbackDispatcher* InDispatcher);
+
+    /** Wire bytes received as gzip responses */
+    UFUNCTION(BlueprintPure, Category = "AGL|Dialogue")
+    int64 GetCompressedBytesReceived() const { return CompressedBytesReceived.GetValue(); }
+
+    /** Inflated size of those gzip responses */
+    UFUNCTION(BlueprintPure, Category = "AGL|Dialogue")
+    int64 GetUncompressedBytesReceived() const { return UncompressedBytesReceived.GetValue(); }
+
+    /** Number of dialogue requests answered from the response cache */
+    UFUNCTION(BlueprintPure, Category = "AGL|Dialogue")
+    int32 GetCacheHitCount() const { return ResponseCache.GetHitCount(); }
+
+    /** Number of dialogue requests that went to the network */
+    UFUNCTION(BlueprintPure, Category = "AGL|Dialogue")
+    int32 GetCacheMissCount() const { return ResponseCache.GetMissCount(); }
+
+    /** Race upgrades delivered while their window was open */
+    UFUNCTION(BlueprintPure, Category = "AGL|Dialogue")
+    int32 GetRaceUpgradesDelivered() const { return RaceUpgradesDelivered; }
+
+    /** Race upgrades dropped because the window had closed */
+    UFUNCTION(BlueprintPure, Category = "AGL|Dialogue")
+    int32 GetRaceUpgradesExpired() const { return RaceUpgradesExpired; }
+
 protected:
     /** Service URL */
     FString ServiceUrl;
@@ -63,8 +169,106 @@ protected:
     /** Request timeout */
     float Timeout;
 
+    /** Shared connection pool (may be null when used standalone) */
+    UPROPERTY()
+    UAGLConnectionPool* ConnectionPool = nullptr;
+
+    /** Shared realtime transport (may be null when WebSocket mode is off) */
+    UPROPERTY()
+    UAGLRealtimeTransport* RealtimeTransport = nullptr;
+
+    /** Shared request scheduler (may be null when coalescing is off) */
+    UPROPERTY()
+    UAGLRequestScheduler* RequestScheduler = nullptr;
+
+    /** Offline journal for failed requests (may be null when disabled) */
+    UPROPERTY()
+    UAGLOfflineJournal* OfflineJournal = nullptr;
+
+    /** Shared callback dispatcher (may be null when budgeting is off) */
+    UPROPERTY()
+    UAGLCallbackDispatcher* CallbackDispatcher = nullptr;
+
+    /** Pool of reusable per-request contexts (game thread only) */
+    FAGLRequestContextPool RequestContextPool;
+
+    /** Memory-mapped offline template library */
+    FAGLTemplateLibrary TemplateLibrary;
+
+    /** Serve dialogue from the local template pack when possible */
+    bool bUseLocalTemplates = false;
+
+    /** Client-side LRU response cache */
+    FAGLDialogueCache ResponseCache;
+
+    /** Serve repeat requests from the response cache */
+    bool bUseResponseCache = false;
+
+    /** Escalate template matches to the LLM and upgrade within the window */
+    bool bUseDialogueRace = false;
+
+    /** Seconds a race upgrade may still land after the template answered */
+    float RaceUpgradeWindowSeconds = 3.0f;
+
+    /** Open upgrade windows by race id: absolute deadline in seconds */
+    TMap<uint32, double> PendingRaceDeadlines;
+
+    /** Next race id to hand out (0 means "not a race") */
+    uint32 NextRaceId = 1;
+
+    /** Race upgrades delivered while their window was open */
+    int32 RaceUpgradesDelivered = 0;
+
+    /** Race upgrades dropped because the window had closed */
+    int32 RaceUpgradesExpired = 0;
+
+    /** Encode HTTP payloads as MessagePack instead of JSON */
+    bool bUseBinaryEncoding = false;
+
+    /** Negotiate gzip on HTTP traffic */
+    bool bUseCompression = false;
+
+    /** Gzip outgoing request bodies (server must inflate them) */
+    bool bCompressRequestBodies = false;
+
+    /** Gzip request bodies at or above this size */
+    int32 CompressionMinRequestBytes = 4096;
+
+    /** Wire bytes received as gzip responses (task threads write this) */
+    FThreadSafeCounter64 CompressedBytesReceived;
+
+    /** Inflated size of those gzip responses */
+    FThreadSafeCounter64 UncompressedBytesReceived;
+
+    /** Acquire a configured HTTP request, pooled when a pool is available */
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateHttpRequest();
+
+    /** Return a completed request's connection to the pool */
+    void ReleaseHttpRequest(FHttpRequestPtr Request);
+
+    /** Open an upgrade window and fire the forced-LLM escalation */
+    void BeginRaceUpgrade(const FAGLDialogueRequest& Request, const FOnDialogueGenerationComplete& OnComplete, uint32 CacheKey);
+
+    /** Send the request over HTTP (direct path and WebSocket fallback) */
+    void GenerateDialogueOverHttp(const FAGLDialogueRequest& Request, FOnDialogueGenerationComplete OnComplete, uint32 CacheKey, uint32 SchedulerKey = 0, uint32 RaceId = 0);
+
     /** Handle HTTP response */
-    void HandleDialogueResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FOnDialogueGenerationComplete Callback);
+    void HandleDialogueResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FOnDialogueGenerationComplete Callback, uint32 CacheKey, uint32 SchedulerKey, uint32 RaceId = 0);
+
+    /** Parse a response payload off-thread and run the callback on the game thread */
+    void DispatchDialogueResponse(FString ResponseContent, FOnDialogueGenerationComplete Callback, uint32 CacheKey, uint32 SchedulerKey = 0, uint32 RaceId = 0);
+
+    /** Inflate and parse a gzip JSON response off-thread */
+    void DispatchDialogueResponseCompressed(TArray<uint8> ResponseBytes, FOnDialogueGenerationComplete Callback, uint32 CacheKey, uint32 SchedulerKey = 0, uint32 RaceId = 0);
+
+    /** Decode a MessagePack response off-thread and run the callback on the game thread */
+    void DispatchDialogueResponseBinary(TArray<uint8> ResponseBytes, FOnDialogueGenerationComplete Callback, uint32 CacheKey, uint32 SchedulerKey = 0, bool bGzipped = false, uint32 RaceId = 0);
+
+    /** Run the callback, fanning out through the scheduler when the request was coalesced */
+    void FinishDialogueRequest(bool bSuccess, const FAGLDialogueResponse& Response, const FOnDialogueGenerationComplete& Callback, uint32 SchedulerKey, uint32 RaceId = 0);
+
+    /** Execute the callback now, gating race upgrades on their window */
+    void ExecuteDialogueCallback(bool bSuccess, const FAGLDialogueResponse& Response, const FOnDialogueGenerationComplete& Callback, uint32 SchedulerKey, uint32 RaceId = 0);
 
     /** Convert event type enum to string */
     static FString EventTypeToString(EAGLEventType EventType);
@@ -4,12 +4,17 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "HAL/ThreadSafeCounter64.h"
 #include "Interfaces/IHttpRequest.h"
 #include "AGLTypes.h"
+#include "AGLRequestContext.h"
 #include "AGLEmotionService.generated.h"
 
-/** Delegate for emotion analysis completion */
-DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnEmotionAnalysisComplete, bool, bSuccess, const FAGLEmotionResponse&, Response);
+class UAGLConnectionPool;
+class UAGLRealtimeTransport;
+class UAGLRequestScheduler;
+class UAGLOfflineJournal;
+class UAGLCallbackDispatcher;
 
 /**
  * Service for analyzing player emotions based on game events
@@ -34,14 +39,18 @@ class AGL_API UAGLEmotionService : public UObject
     friend class FAGLEmotionRequestSerializationTest;
     friend class FAGLEmotionResponseDeserializationTest;
 
+    // Batcher reuses this service's transport and serialization
+    friend class UAGLEventBatcher;
+
 public:
     /**
      * Initialize the service
      * @param InServiceUrl Service base URL
      * @param InApiKey API key for authentication
      * @param InTimeout Request timeout in seconds
+     * @param InConnectionPool Optional shared connection pool for keep-alive reuse
      */
-    void Initialize(const FString& InServiceUrl, const FString& InApiKey, float InTimeout);
+    void Initialize(const FString& InServiceUrl, const FString& InApiKey, float InTimeout, UAGLConnectionPool* InConnectionPool = nullptr);
 
     /**
      * Analyze emotion for a game event
@@ -51,6 +60,64 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AGL|Emotion")
     void AnalyzeEmotion(const FAGLEmotionRequest& Request, FOnEmotionAnalysisComplete OnComplete);
 
+    /**
+     * Configure the local rule engine first pass
+     * @param bInUseLocalRules Run local rules before calling the cloud
+     * @param InConfidenceThreshold Minimum confidence to answer locally
+     */
+    void ConfigureLocalRules(bool bInUseLocalRules, float InConfidenceThreshold);
+
+    /**
+     * Attach the shared realtime transport; requests multiplex over the
+     * WebSocket when connected and fall back to HTTP otherwise
+     * @param InTransport Transport instance, or null to disable
+     */
+    void SetRealtimeTransport(UAGLRealtimeTransport* InTransport);
+
+    /**
+     * Switch HTTP payloads between JSON and MessagePack
+     * @param bInUseBinaryEncoding Send and accept application/msgpack
+     */
+    void SetBinaryEncoding(bool bInUseBinaryEncoding);
+
+    /**
+     * Attach the shared request scheduler; identical in-flight requests
+     * coalesce into one network call
+     * @param InScheduler Scheduler instance, or null to disable
+     */
+    void SetRequestScheduler(UAGLRequestScheduler* InScheduler);
+
+    /**
+     * Attach the offline journal; requests that fail at the transport
+     * level are captured and replayed when connectivity returns
+     * @param InJournal Journal instance, or null to disable
+     */
+    void SetOfflineJournal(UAGLOfflineJournal* InJournal);
+
+    /**
+     * Negotiate gzip on HTTP traffic
+     * @param bInUseCompression Advertise gzip and inflate responses
+     * @param bInCompressRequestBodies Also gzip outgoing request bodies;
+     *        requires inflation middleware on the service
+     * @param InMinRequestBytes Gzip request bodies at or above this size
+     */
+    void SetCompression(bool bInUseCompression, bool bInCompressRequestBodies, int32 InMinRequestBytes);
+
+    /**
+     * Attach the shared callback dispatcher; completed responses drain
+     * under a per-frame time budget instead of bursting in one frame
+     * @param InDispatcher Dispatcher instance, or null to run callbacks inline
+     */
+    void SetCallbackDispatcher(UAGLCallbackDispatcher* InDispatcher);
+
+    /** Wire bytes received as gzip responses */
+    UFUNCTION(BlueprintPure, Category = "AGL|Emotion")
+    int64 GetCompressedBytesReceived() const { return CompressedBytesReceived.GetValue(); }
+
+    /** Inflated size of those gzip responses */
+    UFUNCTION(BlueprintPure, Category = "AGL|Emotion")
+    int64 GetUncompressedBytesReceived() const { return UncompressedBytesReceived.GetValue(); }
+
     /**
      * Create a victory emotion request (helper)
      * @param bIsMVP Whether player was MVP
@@ -95,8 +162,79 @@ protected:
     /** Request timeout */
     float Timeout;
 
+    /** Shared connection pool (may be null when used standalone) */
+    UPROPERTY()
+    UAGLConnectionPool* ConnectionPool = nullptr;
+
+    /** Shared realtime transport (may be null when WebSocket mode is off) */
+    UPROPERTY()
+    UAGLRealtimeTransport* RealtimeTransport = nullptr;
+
+    /** Shared request scheduler (may be null when coalescing is off) */
+    UPROPERTY()
+    UAGLRequestScheduler* RequestScheduler = nullptr;
+
+    /** Offline journal for failed requests (may be null when disabled) */
+    UPROPERTY()
+    UAGLOfflineJournal* OfflineJournal = nullptr;
+
+    /** Shared callback dispatcher (may be null when budgeting is off) */
+    UPROPERTY()
+    UAGLCallbackDispatcher* CallbackDispatcher = nullptr;
+
+    /** Pool of reusable per-request contexts (game thread only) */
+    FAGLRequestContextPool RequestContextPool;
+
+    /** Run the local rule engine as a first pass */
+    bool bUseLocalRules = false;
+
+    /** Encode HTTP payloads as MessagePack instead of JSON */
+    bool bUseBinaryEncoding = false;
+
+    /** Negotiate gzip on HTTP traffic */
+    bool bUseCompression = false;
+
+    /** Gzip outgoing request bodies (server must inflate them) */
+    bool bCompressRequestBodies = false;
+
+    /** Gzip request bodies at or above this size */
+    int32 CompressionMinRequestBytes = 4096;
+
+    /** Wire bytes received as gzip responses (task threads write this) */
+    FThreadSafeCounter64 CompressedBytesReceived;
+
+    /** Inflated size of those gzip responses */
+    FThreadSafeCounter64 UncompressedBytesReceived;
+
+    /** Minimum local rule confidence; lower results escalate to the cloud */
+    float LocalRuleConfidenceThreshold = 0.85f;
+
+    /** Acquire a configured HTTP request, pooled when a pool is available */
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateHttpRequest();
+
+    /** Return a completed request's connection to the pool */
+    void ReleaseHttpRequest(FHttpRequestPtr Request);
+
+    /** Send the request over HTTP (direct path and WebSocket fallback) */
+    void AnalyzeEmotionOverHttp(const FAGLEmotionRequest& Request, FOnEmotionAnalysisComplete OnComplete, uint32 SchedulerKey = 0);
+
     /** Handle HTTP response */
-    void HandleEmotionResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FOnEmotionAnalysisComplete Callback);
+    void HandleEmotionResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FOnEmotionAnalysisComplete Callback, uint32 SchedulerKey);
+
+    /** Parse a response payload off-thread and run the callback on the game thread */
+    void DispatchEmotionResponse(FString ResponseContent, FOnEmotionAnalysisComplete Callback, uint32 SchedulerKey = 0);
+
+    /** Inflate and parse a gzip JSON response off-thread */
+    void DispatchEmotionResponseCompressed(TArray<uint8> ResponseBytes, FOnEmotionAnalysisComplete Callback, uint32 SchedulerKey = 0);
+
+    /** Decode a MessagePack response off-thread and run the callback on the game thread */
+    void DispatchEmotionResponseBinary(TArray<uint8> ResponseBytes, FOnEmotionAnalysisComplete Callback, uint32 SchedulerKey = 0, bool bGzipped = false);
+
+    /** Queue or run the callback, fanning out through the scheduler when the request was coalesced */
+    void FinishEmotionRequest(bool bSuccess, const FAGLEmotionResponse& Response, const FOnEmotionAnalysisComplete& Callback, uint32 SchedulerKey);
+
+    /** Execute the callback now, fanning out through the scheduler */
+    void ExecuteEmotionCallback(bool bSuccess, const FAGLEmotionResponse& Response, const FOnEmotionAnalysisComplete& Callback, uint32 SchedulerKey);
 
     /** Convert event type enum to string */
     static FString EventTypeToString(EAGLEventType EventType);
@@ -0,0 +1,106 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Containers/Queue.h"
+#include "Containers/Ticker.h"
+#include "AGLTypes.h"
+#include "AGLEmotionService.h"
+#include "AGLEventBatcher.generated.h"
+
+/**
+ * Batches emotion analysis requests into single HTTP round trips
+ *
+ * Raid/boss scenarios emit bursts of 20-50 emotion events per second.
+ * Sending each as its own POST wastes round trips and burns through
+ * per-API-key rate limits. The batcher accumulates requests in a
+ * lock-free queue, flushes when a size or time threshold is reached,
+ * serializes them as a single array payload to /analyze/batch, and fans
+ * the per-event results back out to the original delegates in order.
+ *
+ * Example usage:
+ *
+ *   UAGLEventBatcher* Batcher = Client->GetEventBatcher();
+ *   Batcher->EnqueueEmotionRequest(Request, OnComplete);
+ */
+UCLASS(BlueprintType)
+class AGL_API UAGLEventBatcher : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Initialize the batcher
+     * @param InEmotionService Emotion service used for transport and serialization
+     * @param InBatchSize Number of queued events that triggers a flush
+     * @param InFlushInterval Maximum seconds an event waits before a flush
+     */
+    void Initialize(UAGLEmotionService* InEmotionService, int32 InBatchSize, float InFlushInterval);
+
+    /** Stop the flush ticker and flush any remaining events */
+    void Shutdown();
+
+    //~ Begin UObject Interface
+    virtual void BeginDestroy() override;
+    //~ End UObject Interface
+
+    /**
+     * Queue an emotion request for batched submission.
+     * Safe to call from any thread: off-thread callers only enqueue, and
+     * threshold-triggered flushes marshal to the game thread. Delegates
+     * fire on the game thread.
+     * @param Request Emotion analysis request
+     * @param OnComplete Callback invoked with this event's result
+     */
+    UFUNCTION(BlueprintCallable, Category = "AGL|Emotion")
+    void EnqueueEmotionRequest(const FAGLEmotionRequest& Request, FOnEmotionAnalysisComplete OnComplete);
+
+    /** Immediately flush all queued events as one batch */
+    UFUNCTION(BlueprintCallable, Category = "AGL|Emotion")
+    void Flush();
+
+    /** Number of events waiting for the next flush */
+    int32 GetPendingCount() const { return PendingCount.GetValue(); }
+
+protected:
+    /** A queued event awaiting batch submission */
+    struct FPendingEmotionEvent
+    {
+        /** The original request */
+        FAGLEmotionRequest Request;
+
+        /** Delegate to fire with this event's result */
+        FOnEmotionAnalysisComplete OnComplete;
+    };
+
+    /** Flush on the timer threshold */
+    bool TickFlush(float DeltaTime);
+
+    /** Serialize a drained batch into a single array payload */
+    FString SerializeBatch(const TArray<TUniquePtr<FPendingEmotionEvent>>& Events);
+
+    /** Handle the batch response and fan results out to delegates */
+    void HandleBatchResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, TSharedPtr<TArray<TUniquePtr<FPendingEmotionEvent>>> Events);
+
+    /** Emotion service used for transport and per-event deserialization */
+    UPROPERTY()
+    UAGLEmotionService* EmotionService = nullptr;
+
+    /** Lock-free queue of pending events (multi-producer, single consumer) */
+    TQueue<TUniquePtr<FPendingEmotionEvent>, EQueueMode::Mpsc> PendingEvents;
+
+    /** Count of queued events (TQueue has no O(1) Num) */
+    FThreadSafeCounter PendingCount;
+
+    /** Queued event count that triggers a flush */
+    int32 BatchSize = 16;
+
+    /** Maximum seconds an event waits before a flush */
+    float FlushInterval = 0.1f;
+
+    /** Ticker handle for time-based flushing */
+    FTSTicker::FDelegateHandle FlushTickerHandle;
+};
@@ -0,0 +1,138 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StringView.h"
+
+/**
+ * Scratch storage for FAGLJsonReader
+ *
+ * Holds the transient state a parse needs — unescape and number token
+ * buffers — so reading a response performs no allocations once the
+ * scratch has grown to the largest string it has seen. Reset between
+ * responses to reuse the storage; the inline capacity covers typical
+ * response strings without ever touching the heap.
+ */
+class AGL_API FAGLJsonArena
+{
+public:
+    /** Drop all scratch contents, keeping the storage for reuse */
+    void Reset() { Scratch.Reset(); }
+
+private:
+    friend class FAGLJsonReader;
+
+    /** Reused decode buffer; one token is live at a time */
+    TArray<TCHAR, TInlineAllocator<256>> Scratch;
+};
+
+/**
+ * Single-pass streaming reader for the SDK's fixed-shape JSON responses
+ *
+ * The response handlers previously materialized a full FJsonObject DOM
+ * — one refcounted allocation per field — only to copy the values into
+ * a typed struct and throw the tree away. This reader walks the source
+ * string once and hands fields to the caller as it passes them, with
+ * all transient state in a caller-provided arena, so parsing a response
+ * allocates nothing beyond the strings stored in the target struct.
+ *
+ * The reader is a pull parser shaped around the known schemas: enter an
+ * object, loop NextField, read or skip each value. It is lenient about
+ * separators since the input comes from our own services; malformed
+ * structure sets the error flag and stops the walk.
+ *
+ * Example usage:
+ *
+ *   FAGLJsonArena Arena;
+ *   FAGLJsonReader Reader(JsonString, Arena);
+ *   FStringView Key;
+ *   if (Reader.EnterObject())
+ *   {
+ *       while (Reader.NextField(Key))
+ *       {
+ *           if (Key == TEXT("dialogue")) { Reader.ReadString(Response.Dialogue); }
+ *           else { Reader.SkipValue(); }
+ *       }
+ *   }
+ *
+ * A key view returned by NextField is only valid until the next reader
+ * call; compare it before reading the value.
+ */
+class AGL_API FAGLJsonReader
+{
+public:
+    FAGLJsonReader(FStringView InJson, FAGLJsonArena& InArena);
+
+    /** Consume the opening brace of an object */
+    bool EnterObject();
+
+    /**
+     * Advance to the next field in the current object
+     * @param OutKey The field name, valid until the next reader call
+     * @return True when positioned on a value; false at the closing brace
+     */
+    bool NextField(FStringView& OutKey);
+
+    /** Consume the opening bracket of an array */
+    bool EnterArray();
+
+    /**
+     * Advance to the next element in the current array
+     * @return True when positioned on a value; false at the closing bracket
+     */
+    bool NextElement();
+
+    /** Read a string value; false (without error) when the value is null */
+    bool ReadString(FString& OutValue);
+
+    /** Read a numeric value */
+    bool ReadNumber(double& OutValue);
+
+    /** Read a numeric value as float */
+    bool ReadNumber(float& OutValue);
+
+    /** Read a numeric value as int32 */
+    bool ReadNumber(int32& OutValue);
+
+    /** Read a boolean value */
+    bool ReadBool(bool& bOutValue);
+
+    /** Consume any value, including nested objects and arrays */
+    bool SkipValue();
+
+    /** Whether the walk hit malformed input */
+    bool HadError() const { return bError; }
+
+private:
+    /** Advance past whitespace */
+    void SkipWhitespace();
+
+    /** Consume an expected character, setting the error flag on mismatch */
+    bool Expect(TCHAR Char);
+
+    /**
+     * Parse a quoted string token
+     * @param OutView Slice of the source, or of the arena when unescaping
+     * @return False on malformed input
+     */
+    bool ParseStringToken(FStringView& OutView);
+
+    /** Parse a bare numeric token into the arena, null-terminated */
+    bool ParseNumberToken(double& OutValue);
+
+    /** Whether the next characters match a keyword like true or null */
+    bool ConsumeKeyword(const TCHAR* Keyword);
+
+    /** Read position */
+    const TCHAR* Cursor;
+
+    /** One past the last source character */
+    const TCHAR* End;
+
+    /** Caller-provided scratch for unescaping and number tokens */
+    FAGLJsonArena& Arena;
+
+    /** Set when the input does not match the expected structure */
+    bool bError = false;
+};
@@ -0,0 +1,91 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/StringFwd.h"
+#include "AGLKeyValueStore.h"
+
+/**
+ * Direct JSON writer for the SDK's fixed-shape request payloads
+ *
+ * The service serializers previously built a tree of shared-pointer
+ * FJsonObject nodes plus a TJsonWriter just to emit a tiny flat
+ * document — thousands of small heap allocations per minute at burst
+ * event rates. This writer appends straight into a caller-provided
+ * string builder (typically a stack TStringBuilder), so serializing a
+ * request performs no intermediate heap allocations at all.
+ *
+ * Output is condensed JSON with the same escaping rules as
+ * FJsonSerializer, so the wire format is unchanged.
+ *
+ * Example usage:
+ *
+ *   TStringBuilder<512> Builder;
+ *   FAGLJsonWriter Writer(Builder);
+ *   Writer.BeginObject();
+ *   Writer.WriteString(TEXT("type"), EventString);
+ *   Writer.WriteBool(TEXT("force_ml"), false);
+ *   Writer.EndObject();
+ *   FString Payload = Builder.ToString();
+ */
+class AGL_API FAGLJsonWriter
+{
+public:
+    explicit FAGLJsonWriter(FStringBuilderBase& InBuilder)
+        : Builder(InBuilder)
+    {
+    }
+
+    /** Open the root object or an anonymous object inside an array */
+    void BeginObject();
+
+    /** Open a nested object field */
+    void BeginObject(const TCHAR* Key);
+
+    /** Close the current object */
+    void EndObject();
+
+    /** Open an array field */
+    void BeginArray(const TCHAR* Key);
+
+    /** Close the current array */
+    void EndArray();
+
+    /** Write a string field with JSON escaping */
+    void WriteString(const TCHAR* Key, const FString& Value);
+
+    /** Write a bare string element inside an array */
+    void WriteArrayString(const FString& Value);
+
+    /** Write a boolean field */
+    void WriteBool(const TCHAR* Key, bool bValue);
+
+    /** Write an integer field */
+    void WriteNumber(const TCHAR* Key, int32 Value);
+
+    /** Write a float field */
+    void WriteNumber(const TCHAR* Key, float Value);
+
+    /** Write a string map as a nested object */
+    void WriteMap(const TCHAR* Key, const TMap<FString, FString>& Map);
+
+    /** Write a key-value store as a nested object */
+    void WriteMap(const TCHAR* Key, const FAGLKeyValueStore& Store);
+
+private:
+    /** Emit the separating comma and quoted key */
+    void WriteKey(const TCHAR* Key);
+
+    /** Emit the separating comma for a bare array element */
+    void WriteSeparator();
+
+    /** Append a string with FJsonSerializer-compatible escaping */
+    void AppendEscaped(FStringView Value);
+
+    /** Destination buffer owned by the caller */
+    FStringBuilderBase& Builder;
+
+    /** Whether the next field at each nesting depth needs a comma */
+    TArray<bool, TInlineAllocator<8>> CommaStack;
+};
@@ -0,0 +1,156 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "AGLKeyValueStore.generated.h"
+
+/** One key/value entry in an FAGLKeyValueStore */
+struct FAGLKeyValuePair
+{
+    /** Entry key; kept as FString so the exact spelling callers wrote
+        reaches the wire (FName folds case to the first-interned name) */
+    FString Key;
+
+    /** Entry value */
+    FString Value;
+};
+
+/**
+ * Flat key-value storage for request Data/Context payloads
+ *
+ * The request structs carried TMap<FString, FString> for payloads that
+ * typically hold two to five entries, paying a hash table allocation
+ * on every event — and copying all of it through delegate and Blueprint
+ * boundaries. This is a flat array with inline capacity for the common
+ * entry counts: building a typical request allocates nothing for the
+ * container, and lookup is a linear scan with a case-sensitive string
+ * compare, which beats hashing at these entry counts.
+ *
+ * The call surface mirrors the TMap subset the codebase uses: Add
+ * replaces an existing key, Find/FindRef look up by key, and range-for
+ * yields pairs with Key and Value members. Keys are case-sensitive,
+ * matching the TMap the store replaced. Blueprint reaches the store
+ * through UAGLKeyValueLibrary, since reflection cannot see the inline
+ * allocator.
+ */
+USTRUCT(BlueprintType)
+struct AGL_API FAGLKeyValueStore
+{
+    GENERATED_BODY()
+
+    /** Inline capacity covering the typical 2-5 entry payloads */
+    static constexpr int32 InlineCapacity = 8;
+
+    // Not a UPROPERTY: reflection cannot represent the inline allocator
+    TArray<FAGLKeyValuePair, TInlineAllocator<InlineCapacity>> Pairs;
+
+    /**
+     * Add an entry, replacing any existing value under the same key
+     * @param Key Entry key
+     * @param Value Entry value
+     */
+    void Add(const FString& Key, const FString& Value);
+
+    /** Add an entry from a literal key */
+    void Add(const TCHAR* Key, const FString& Value);
+
+    /**
+     * Look up the value stored under a key
+     * @param Key Entry key
+     * @return Pointer to the value, or null when the key is absent
+     */
+    const FString* Find(const FString& Key) const { return Find(*Key); }
+
+    /** Look up by literal key, without building an FString */
+    const FString* Find(const TCHAR* Key) const;
+
+    /**
+     * Copy of the value stored under a key
+     * @param Key Entry key
+     * @return The value, or an empty string when the key is absent
+     */
+    FString FindRef(const FString& Key) const { return FindRef(*Key); }
+
+    /** Copy of the value under a literal key */
+    FString FindRef(const TCHAR* Key) const;
+
+    /** Whether the key is present */
+    bool Contains(const FString& Key) const { return Find(*Key) != nullptr; }
+
+    /** Whether the literal key is present */
+    bool Contains(const TCHAR* Key) const { return Find(Key) != nullptr; }
+
+    /** Number of entries */
+    int32 Num() const { return Pairs.Num(); }
+
+    /** Remove all entries, keeping the inline storage */
+    void Reset() { Pairs.Reset(); }
+
+    /**
+     * Order-independent hash over all entries, for the dedup and cache
+     * key layers: stores built in any insertion order hash identically
+     */
+    uint32 ComputeHash() const;
+
+    /** Entry-wise equality, independent of insertion order */
+    bool operator==(const FAGLKeyValueStore& Other) const;
+    bool operator!=(const FAGLKeyValueStore& Other) const { return !(*this == Other); }
+
+    /** Reflection comparison hook; see TStructOpsTypeTraits below */
+    bool Identical(const FAGLKeyValueStore* Other, uint32 PortFlags) const;
+
+    // Range-for support; entries iterate in insertion order
+    FAGLKeyValuePair* begin() { return Pairs.GetData(); }
+    FAGLKeyValuePair* end() { return Pairs.GetData() + Pairs.Num(); }
+    const FAGLKeyValuePair* begin() const { return Pairs.GetData(); }
+    const FAGLKeyValuePair* end() const { return Pairs.GetData() + Pairs.Num(); }
+};
+
+// Pairs is invisible to reflection, so reflection-driven copies (Blueprint
+// pin copies, dynamic delegate parameters, CopyScriptStruct) must route
+// through the native copy constructor or they silently drop every entry
+template<>
+struct TStructOpsTypeTraits<FAGLKeyValueStore> : public TStructOpsTypeTraitsBase2<FAGLKeyValueStore>
+{
+    enum
+    {
+        WithCopy = true,
+        WithIdentical = true,
+    };
+};
+
+/**
+ * Blueprint access to FAGLKeyValueStore
+ *
+ * The store's inline allocator keeps its entries invisible to
+ * reflection, so Blueprint graphs read and write entries through these
+ * helpers or convert to and from a plain map at the boundary.
+ */
+UCLASS()
+class AGL_API UAGLKeyValueLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    /** Build a store from a Blueprint map */
+    UFUNCTION(BlueprintPure, Category = "AGL|KeyValue")
+    static FAGLKeyValueStore MakeKeyValueStore(const TMap<FString, FString>& Map);
+
+    /** Convert a store back to a Blueprint map */
+    UFUNCTION(BlueprintPure, Category = "AGL|KeyValue")
+    static TMap<FString, FString> KeyValueStoreToMap(const FAGLKeyValueStore& Store);
+
+    /** Add an entry, replacing any existing value under the same key */
+    UFUNCTION(BlueprintCallable, Category = "AGL|KeyValue")
+    static void SetKeyValue(UPARAM(ref) FAGLKeyValueStore& Store, const FString& Key, const FString& Value);
+
+    /** Value stored under a key, or an empty string when absent */
+    UFUNCTION(BlueprintPure, Category = "AGL|KeyValue")
+    static FString GetKeyValue(const FAGLKeyValueStore& Store, const FString& Key);
+
+    /** Number of entries in the store */
+    UFUNCTION(BlueprintPure, Category = "AGL|KeyValue")
+    static int32 GetKeyValueCount(const FAGLKeyValueStore& Store);
+};
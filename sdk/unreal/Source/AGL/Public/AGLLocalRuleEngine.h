@@ -0,0 +1,74 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AGLTypes.h"
+
+/**
+ * Native port of the emotion service rule engine
+ *
+ * The backend promises <50ms rule-based classification, but a network
+ * round trip can never honor that when the emotion service is slow or
+ * down. This table-driven classifier evaluates the same event-type +
+ * data-field rules locally and returns a response in microseconds with
+ * zero allocations beyond the response struct itself.
+ *
+ * Used by UAGLEmotionService as a first pass: confident matches are
+ * answered synchronously, low-confidence cases escalate to the cloud.
+ * It is also the SDK's graceful-degradation path when offline.
+ */
+class AGL_API FAGLLocalRuleEngine
+{
+public:
+    /**
+     * Classify a game event using the local rule table
+     * @param Request Emotion analysis request
+     * @return Response with Method set to "rule" and the matched rule's confidence
+     */
+    static FAGLEmotionResponse Classify(const FAGLEmotionRequest& Request);
+
+    /** Number of rule variants in the local table (a 23-rule subset of the backend's 36) */
+    static int32 GetRuleCount();
+
+private:
+    /** How a rule's data-field condition is evaluated */
+    enum class ECondition : uint8
+    {
+        /** Rule matches on event type alone */
+        Always,
+
+        /** Integer field present and >= IntThreshold */
+        IntAtLeast,
+
+        /** Boolean field present and "true" */
+        BoolTrue,
+
+        /** String field present and equal to StringValue */
+        StringEquals
+    };
+
+    /** One entry in the rule table */
+    struct FRule
+    {
+        EAGLEventType EventType;
+        const TCHAR* Field;
+        ECondition Condition;
+        int32 IntThreshold;
+        const TCHAR* StringValue;
+        EAGLEmotionType Emotion;
+        float Intensity;
+        const TCHAR* Action;
+        float Confidence;
+        const TCHAR* Reasoning;
+    };
+
+    /** Check whether a rule's condition holds for the request data */
+    static bool MatchesCondition(const FRule& Rule, const FAGLKeyValueStore& Data);
+
+    /** Rule table, ordered most specific first within each event type */
+    static const FRule Rules[];
+
+    /** Number of entries in Rules */
+    static const int32 NumRules;
+};
@@ -4,18 +4,19 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "HAL/ThreadSafeCounter64.h"
 #include "Interfaces/IHttpRequest.h"
 #include "AGLTypes.h"
+#include "AGLContextCache.h"
+#include "AGLRequestContext.h"
 #include "AGLMemoryService.generated.h"
 
-/** Delegate for memory creation completion */
-DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnMemoryCreated, bool, bSuccess, const FAGLMemory&, Memory);
-
-/** Delegate for memory search completion */
-DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnMemorySearchComplete, bool, bSuccess, const TArray<FAGLMemorySearchResult>&, Results);
-
-/** Delegate for get memories completion */
-DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnGetMemoriesComplete, bool, bSuccess, const TArray<FAGLMemory>&, Memories);
+class UAGLConnectionPool;
+class UAGLRealtimeTransport;
+class UAGLRequestScheduler;
+class UAGLMemoryWriteQueue;
+class UAGLOfflineJournal;
+class UAGLCallbackDispatcher;
 
 /**
  * Service for managing player memories
@@ -41,14 +42,103 @@ class AGL_API UAGLMemoryService : public UObject
     friend class FAGLEnumConversionTest;
     friend class FAGLMemorySerializationTest;
 
+    // Write queue reuses the service's transport and serialization
+    friend class UAGLMemoryWriteQueue;
+
 public:
     /**
      * Initialize the service
      * @param InServiceUrl Service base URL
      * @param InApiKey API key for authentication
      * @param InTimeout Request timeout in seconds
+     * @param InConnectionPool Optional shared connection pool for keep-alive reuse
+     */
+    void Initialize(const FString& InServiceUrl, const FString& InApiKey, float InTimeout, UAGLConnectionPool* InConnectionPool = nullptr);
+
+    /**
+     * Attach the shared realtime transport; requests multiplex over the
+     * WebSocket when connected and fall back to HTTP otherwise
+     * @param InTransport Transport instance, or null to disable
+     */
+    void SetRealtimeTransport(UAGLRealtimeTransport* InTransport);
+
+    /**
+     * Switch HTTP payloads between JSON and MessagePack
+     * @param bInUseBinaryEncoding Send and accept application/msgpack
+     */
+    void SetBinaryEncoding(bool bInUseBinaryEncoding);
+
+    /**
+     * Attach the shared request scheduler; memory writes queue behind
+     * user-facing traffic when the connection budget is saturated
+     * @param InScheduler Scheduler instance, or null to disable
+     */
+    void SetRequestScheduler(UAGLRequestScheduler* InScheduler);
+
+    /**
+     * Attach the write-behind queue; CreateMemory calls accumulate and
+     * upload as bulk requests instead of individual POSTs
+     * @param InWriteQueue Queue instance, or null to disable
+     */
+    void SetWriteQueue(UAGLMemoryWriteQueue* InWriteQueue);
+
+    /**
+     * Attach the offline journal; memory creations that fail at the
+     * transport level are captured and replayed when connectivity returns
+     * @param InJournal Journal instance, or null to disable
      */
-    void Initialize(const FString& InServiceUrl, const FString& InApiKey, float InTimeout);
+    void SetOfflineJournal(UAGLOfflineJournal* InJournal);
+
+    /**
+     * Negotiate gzip on HTTP traffic; the memory-heavy GetMemories and
+     * SearchMemories responses shrink 5-10x over cellular links
+     * @param bInUseCompression Advertise gzip and inflate responses
+     * @param bInCompressRequestBodies Also gzip outgoing request bodies;
+     *        requires inflation middleware on the service
+     * @param InMinRequestBytes Gzip request bodies at or above this size
+     */
+    void SetCompression(bool bInUseCompression, bool bInCompressRequestBodies, int32 InMinRequestBytes);
+
+    /**
+     * Attach the shared callback dispatcher; completed responses drain
+     * under a per-frame time budget instead of bursting in one frame
+     * @param InDispatcher Dispatcher instance, or null to run callbacks inline
+     */
+    void SetCallbackDispatcher(UAGLCallbackDispatcher* InDispatcher);
+
+    /** Wire bytes received as gzip responses */
+    UFUNCTION(BlueprintPure, Category = "AGL|Memory")
+    int64 GetCompressedBytesReceived() const { return CompressedBytesReceived.GetValue(); }
+
+    /** Inflated size of those gzip responses */
+    UFUNCTION(BlueprintPure, Category = "AGL|Memory")
+    int64 GetUncompressedBytesReceived() const { return UncompressedBytesReceived.GetValue(); }
+
+    /**
+     * Configure the client-side context cache
+     * @param bInUseCache Serve GetContext from the cache with an async
+     *        revalidate
+     * @param InTTLSeconds Seconds before a cached entry expires
+     * @param InMemoriesPerEntry Memories kept per event type
+     */
+    void ConfigureContextCache(bool bInUseCache, float InTTLSeconds, int32 InMemoriesPerEntry);
+
+    /**
+     * Warm the context cache for a player's common event types so the
+     * first dialogue of the session does not pay the context round trip
+     * @param PlayerId Player identifier
+     * @param EventTypes Event type strings to prefetch (e.g. "player.victory")
+     */
+    UFUNCTION(BlueprintCallable, Category = "AGL|Memory")
+    void PrefetchContext(const FString& PlayerId, const TArray<FString>& EventTypes);
+
+    /** Number of context lookups answered from the cache */
+    UFUNCTION(BlueprintPure, Category = "AGL|Memory")
+    int32 GetContextCacheHitCount() const { return ContextCache.GetHitCount(); }
+
+    /** Number of context lookups that went to the network */
+    UFUNCTION(BlueprintPure, Category = "AGL|Memory")
+    int32 GetContextCacheMissCount() const { return ContextCache.GetMissCount(); }
 
     /**
      * Create a new memory for a player
@@ -97,6 +187,90 @@ protected:
     /** Request timeout */
     float Timeout;
 
+    /** Shared connection pool (may be null when used standalone) */
+    UPROPERTY()
+    UAGLConnectionPool* ConnectionPool = nullptr;
+
+    /** Shared realtime transport (may be null when WebSocket mode is off) */
+    UPROPERTY()
+    UAGLRealtimeTransport* RealtimeTransport = nullptr;
+
+    /** Encode HTTP payloads as MessagePack instead of JSON */
+    bool bUseBinaryEncoding = false;
+
+    /** Negotiate gzip on HTTP traffic */
+    bool bUseCompression = false;
+
+    /** Gzip outgoing request bodies (server must inflate them) */
+    bool bCompressRequestBodies = false;
+
+    /** Gzip request bodies at or above this size */
+    int32 CompressionMinRequestBytes = 4096;
+
+    /** Wire bytes received as gzip responses (task threads write this) */
+    FThreadSafeCounter64 CompressedBytesReceived;
+
+    /** Inflated size of those gzip responses */
+    FThreadSafeCounter64 UncompressedBytesReceived;
+
+    /** Shared request scheduler (may be null when prioritization is off) */
+    UPROPERTY()
+    UAGLRequestScheduler* RequestScheduler = nullptr;
+
+    /** Write-behind queue for bulk memory uploads (may be null) */
+    UPROPERTY()
+    UAGLMemoryWriteQueue* WriteQueue = nullptr;
+
+    /** Offline journal for failed requests (may be null when disabled) */
+    UPROPERTY()
+    UAGLOfflineJournal* OfflineJournal = nullptr;
+
+    /** Shared callback dispatcher (may be null when budgeting is off) */
+    UPROPERTY()
+    UAGLCallbackDispatcher* CallbackDispatcher = nullptr;
+
+    /** Pool of reusable per-request contexts (game thread only) */
+    FAGLRequestContextPool RequestContextPool;
+
+    /** Client-side context cache keyed by event type */
+    FAGLContextCache ContextCache;
+
+    /** Serve GetContext from the cache with an async revalidate */
+    bool bUseContextCache = false;
+
+    /** Acquire a configured HTTP request, pooled when a pool is available */
+    TSharedRef<IHttpRequest, ESPMode::ThreadSafe> CreateHttpRequest();
+
+    /** Return a completed request's connection to the pool */
+    void ReleaseHttpRequest(FHttpRequestPtr Request);
+
+    /** Start a create memory request over the active transport (post scheduler gate) */
+    void SendCreateMemory(const FString& PlayerId, const FAGLCreateMemoryRequest& Request, FOnMemoryCreated OnComplete);
+
+    /** Send a create memory request over HTTP (direct path and WebSocket fallback) */
+    void CreateMemoryOverHttp(const FString& PlayerId, const FAGLCreateMemoryRequest& Request, FOnMemoryCreated OnComplete);
+
+    /** Release the scheduler slot a gated memory write claimed */
+    void ReleaseSchedulerSlot();
+
+    /** Send a search request over HTTP (direct path and WebSocket fallback) */
+    void SearchMemoriesOverHttp(const FString& PlayerId, const FAGLSearchMemoriesRequest& Request, FOnMemorySearchComplete OnComplete);
+
+    /** Send a context request over HTTP (direct path and WebSocket fallback) */
+    void GetContextOverHttp(const FString& PlayerId, const FAGLGetContextRequest& Request, FOnGetMemoriesComplete OnComplete, const FString& CacheEventType = FString());
+
+    /** Refetch one event type's context and store it in the cache */
+    void RevalidateContextEntry(const FString& PlayerId, const FString& EventType);
+
+    /** Queue or run a create memory callback through the dispatcher */
+    void FinishCreateMemory(bool bSuccess, const FAGLMemory& Memory, const FOnMemoryCreated& Callback);
+
+    /** Queue or run a search callback through the dispatcher */
+    void FinishSearchMemories(bool bSuccess, const TArray<FAGLMemorySearchResult>& Results, const FOnMemorySearchComplete& Callback);
+
+    /** Queue or run a get memories callback through the dispatcher */
+    void FinishGetMemories(bool bSuccess, const TArray<FAGLMemory>& Memories, const FOnGetMemoriesComplete& Callback);
+
     /** Handle create memory response */
     void HandleCreateMemoryResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FOnMemoryCreated Callback);
 
@@ -104,7 +278,34 @@ protected:
     void HandleSearchMemoriesResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FOnMemorySearchComplete Callback);
 
     /** Handle get memories response */
-    void HandleGetMemoriesResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FOnGetMemoriesComplete Callback);
+    void HandleGetMemoriesResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FOnGetMemoriesComplete Callback, FString CacheEventType = FString(), FString CachePlayerId = FString());
+
+    /** Parse a create memory payload off-thread and run the callback on the game thread */
+    void DispatchCreateMemoryResponse(FString ResponseContent, FOnMemoryCreated Callback);
+
+    /** Parse a search payload off-thread and run the callback on the game thread */
+    void DispatchSearchResultsResponse(FString ResponseContent, FOnMemorySearchComplete Callback);
+
+    /** Parse a memories payload off-thread and run the callback on the game thread */
+    void DispatchMemoriesResponse(FString ResponseContent, FOnGetMemoriesComplete Callback, FString CacheEventType = FString(), FString CachePlayerId = FString());
+
+    /** Decode a MessagePack memory off-thread and run the callback on the game thread */
+    void DispatchCreateMemoryResponseBinary(TArray<uint8> ResponseBytes, FOnMemoryCreated Callback, bool bGzipped = false);
+
+    /** Inflate and parse a gzip JSON create response off-thread */
+    void DispatchCreateMemoryResponseCompressed(TArray<uint8> ResponseBytes, FOnMemoryCreated Callback);
+
+    /** Decode MessagePack search results off-thread and run the callback on the game thread */
+    void DispatchSearchResultsResponseBinary(TArray<uint8> ResponseBytes, FOnMemorySearchComplete Callback, bool bGzipped = false);
+
+    /** Inflate and parse a gzip JSON search response off-thread */
+    void DispatchSearchResultsResponseCompressed(TArray<uint8> ResponseBytes, FOnMemorySearchComplete Callback);
+
+    /** Decode a MessagePack memories list off-thread and run the callback on the game thread */
+    void DispatchMemoriesResponseBinary(TArray<uint8> ResponseBytes, FOnGetMemoriesComplete Callback, FString CacheEventType = FString(), FString CachePlayerId = FString(), bool bGzipped = false);
+
+    /** Inflate and parse a gzip JSON memories response off-thread */
+    void DispatchMemoriesResponseCompressed(TArray<uint8> ResponseBytes, FOnGetMemoriesComplete Callback, FString CacheEventType = FString(), FString CachePlayerId = FString());
 
     /** Convert memory type enum to string */
     static FString MemoryTypeToString(EAGLMemoryType MemoryType);
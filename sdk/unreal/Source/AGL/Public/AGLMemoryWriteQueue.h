@@ -0,0 +1,149 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Containers/Ticker.h"
+#include "AGLTypes.h"
+#include "AGLMemoryService.h"
+#include "AGLMemoryWriteQueue.generated.h"
+
+class UAGLRequestScheduler;
+
+/**
+ * Write-behind queue that bulk-uploads memory creations
+ *
+ * Games record 5-15 memories per minute per player, and each individual
+ * CreateMemory was its own POST with its own JSON build. The queue
+ * accumulates creations locally, orders them by importance so the
+ * moments that matter most land first, and flushes them as a single
+ * bulk request to /memories/bulk on a count threshold, a timer, or an
+ * explicit flush at session end. A failed flush re-queues its items and
+ * retries with exponential backoff; items that exhaust their retries
+ * fail their delegates rather than silently vanishing.
+ *
+ * Per-item FOnMemoryCreated delegates still fire once the bulk response
+ * lands, with results matched to items by submission order.
+ *
+ * Example usage:
+ *
+ *   UAGLMemoryWriteQueue* Queue = Client->GetMemoryWriteQueue();
+ *   Queue->EnqueueMemory(PlayerId, Request, OnComplete);
+ */
+UCLASS(BlueprintType)
+class AGL_API UAGLMemoryWriteQueue : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Initialize the queue
+     * @param InMemoryService Memory service used for transport and serialization
+     * @param InBatchSize Number of queued memories that triggers a flush
+     * @param InFlushInterval Maximum seconds a memory waits before a flush
+     * @param InMaxRetries Flush attempts per item before its delegate fails
+     */
+    void Initialize(UAGLMemoryService* InMemoryService, int32 InBatchSize, float InFlushInterval, int32 InMaxRetries);
+
+    /** Stop the flush ticker and flush any remaining memories */
+    void Shutdown();
+
+    //~ Begin UObject Interface
+    virtual void BeginDestroy() override;
+    //~ End UObject Interface
+
+    /**
+     * Attach the shared request scheduler; bulk flushes queue behind
+     * user-facing traffic when the connection budget is saturated
+     * @param InScheduler Scheduler instance, or null to disable
+     */
+    void SetRequestScheduler(UAGLRequestScheduler* InScheduler);
+
+    /**
+     * Queue a memory creation for bulk upload
+     * @param PlayerId Player identifier
+     * @param Request Memory creation request
+     * @param OnComplete Callback fired with this item's result once the
+     *        bulk response lands
+     */
+    UFUNCTION(BlueprintCallable, Category = "AGL|Memory")
+    void EnqueueMemory(const FString& PlayerId, const FAGLCreateMemoryRequest& Request, FOnMemoryCreated OnComplete);
+
+    /** Immediately flush all queued memories as bulk requests */
+    UFUNCTION(BlueprintCallable, Category = "AGL|Memory")
+    void Flush();
+
+    /** Number of memories waiting for the next flush */
+    UFUNCTION(BlueprintPure, Category = "AGL|Memory")
+    int32 GetPendingCount() const { return Pending.Num(); }
+
+    /** Consecutive failed flushes (resets on success) */
+    UFUNCTION(BlueprintPure, Category = "AGL|Memory")
+    int32 GetConsecutiveFailureCount() const { return ConsecutiveFailures; }
+
+protected:
+    /** A queued memory creation awaiting bulk upload */
+    struct FPendingMemoryWrite
+    {
+        /** Player the memory belongs to */
+        FString PlayerId;
+
+        /** The original request */
+        FAGLCreateMemoryRequest Request;
+
+        /** Delegate to fire with this item's result */
+        FOnMemoryCreated OnComplete;
+
+        /** Failed flush attempts so far */
+        int32 RetryCount = 0;
+    };
+
+    /** Flush on the timer threshold */
+    bool TickFlush(float DeltaTime);
+
+    /** Send one player's drained items as a single bulk request */
+    void SendBulkRequest(const FString& PlayerId, TSharedPtr<TArray<FPendingMemoryWrite>> Items);
+
+    /** Serialize drained items into a single bulk payload */
+    FString SerializeBulkRequest(const TArray<FPendingMemoryWrite>& Items);
+
+    /** Handle the bulk response and fan results out to delegates */
+    void HandleBulkResponse(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, TSharedPtr<TArray<FPendingMemoryWrite>> Items);
+
+    /** Re-queue a failed batch for retry, failing items that are out of retries */
+    void RequeueFailedItems(TArray<FPendingMemoryWrite>& Items);
+
+    /** Release the scheduler slot a bulk flush claimed */
+    void ReleaseSchedulerSlot();
+
+    /** Memory service used for transport and per-item deserialization */
+    UPROPERTY()
+    UAGLMemoryService* MemoryService = nullptr;
+
+    /** Shared request scheduler (may be null when prioritization is off) */
+    UPROPERTY()
+    UAGLRequestScheduler* RequestScheduler = nullptr;
+
+    /** Memories waiting for the next flush (game thread only) */
+    TArray<FPendingMemoryWrite> Pending;
+
+    /** Queued memory count that triggers a flush */
+    int32 BatchSize = 16;
+
+    /** Maximum seconds a memory waits before a flush */
+    float FlushInterval = 5.0f;
+
+    /** Flush attempts per item before its delegate fails */
+    int32 MaxRetries = 3;
+
+    /** Consecutive failed flushes, drives the backoff */
+    int32 ConsecutiveFailures = 0;
+
+    /** Earliest time the next flush may run (FPlatformTime::Seconds) */
+    double NextFlushAllowedTime = 0.0;
+
+    /** Ticker handle for time-based flushing */
+    FTSTicker::FDelegateHandle FlushTickerHandle;
+};
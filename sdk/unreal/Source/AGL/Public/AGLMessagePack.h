@@ -0,0 +1,161 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AGLTypes.h"
+
+/**
+ * Low-level MessagePack writer appending to a byte buffer
+ *
+ * Covers the subset of the format the AGL wire structs need: maps,
+ * arrays, UTF-8 strings, booleans, 32-bit integers and floats.
+ */
+class AGL_API FAGLMessagePackWriter
+{
+public:
+    explicit FAGLMessagePackWriter(TArray<uint8>& InBuffer)
+        : Buffer(InBuffer)
+    {
+    }
+
+    /** Write a map header for the given entry count */
+    void WriteMapHeader(int32 Count);
+
+    /** Write an array header for the given element count */
+    void WriteArrayHeader(int32 Count);
+
+    /** Write a UTF-8 string */
+    void WriteString(const FString& Value);
+
+    /** Write a boolean */
+    void WriteBool(bool bValue);
+
+    /** Write a 32-bit integer */
+    void WriteInt(int32 Value);
+
+    /** Write a 32-bit float */
+    void WriteFloat(float Value);
+
+    /** Write a string-to-string map */
+    void WriteStringMap(const TMap<FString, FString>& Map);
+
+    /** Write a key-value store as a map of strings */
+    void WriteStringMap(const FAGLKeyValueStore& Store);
+
+private:
+    /** Output buffer */
+    TArray<uint8>& Buffer;
+};
+
+/**
+ * Low-level MessagePack reader over a byte buffer
+ *
+ * Read methods return false on type mismatch or truncation; SkipValue
+ * steps over any value so unknown map keys are tolerated.
+ */
+class AGL_API FAGLMessagePackReader
+{
+public:
+    explicit FAGLMessagePackReader(const TArray<uint8>& InBuffer)
+        : Buffer(InBuffer)
+        , Offset(0)
+    {
+    }
+
+    /** Read a map header */
+    bool ReadMapHeader(int32& OutCount);
+
+    /** Read an array header */
+    bool ReadArrayHeader(int32& OutCount);
+
+    /** Read a UTF-8 string */
+    bool ReadString(FString& OutValue);
+
+    /** Read a boolean */
+    bool ReadBool(bool& bOutValue);
+
+    /** Read an integer (any MessagePack integer width) */
+    bool ReadInt(int32& OutValue);
+
+    /** Read a float (accepts integers as well) */
+    bool ReadFloat(float& OutValue);
+
+    /** Read a string-to-string map */
+    bool ReadStringMap(TMap<FString, FString>& OutMap);
+
+    /** Read a map of strings into a key-value store */
+    bool ReadStringMap(FAGLKeyValueStore& OutStore);
+
+    /** Step over one value of any type */
+    bool SkipValue();
+
+    /** Whether the whole buffer has been consumed */
+    bool IsAtEnd() const { return Offset >= Buffer.Num(); }
+
+private:
+    /** Bytes remaining from the current offset */
+    int32 Remaining() const { return Buffer.Num() - Offset; }
+
+    /** Read big-endian unsigned integers of the given byte width */
+    bool ReadBigEndian(int32 NumBytes, uint32& OutValue);
+
+    /** Input buffer */
+    const TArray<uint8>& Buffer;
+
+    /** Current read position */
+    int32 Offset;
+};
+
+/**
+ * Binary (MessagePack) encoding of the AGL wire structs
+ *
+ * Field names match the JSON wire format, so the backend negotiates the
+ * encoding purely on the Content-Type header. Typed decode fills the
+ * structs directly without building an FJsonObject tree.
+ */
+class AGL_API FAGLMessagePack
+{
+public:
+    /** Content type negotiated for binary mode */
+    static const TCHAR* ContentType;
+
+    static void EncodeEmotionRequest(const FAGLEmotionRequest& Request, TArray<uint8>& OutBytes);
+    static bool DecodeEmotionRequest(const TArray<uint8>& Bytes, FAGLEmotionRequest& OutRequest);
+
+    static void EncodeEmotionResponse(const FAGLEmotionResponse& Response, TArray<uint8>& OutBytes);
+    static bool DecodeEmotionResponse(const TArray<uint8>& Bytes, FAGLEmotionResponse& OutResponse);
+
+    static void EncodeDialogueRequest(const FAGLDialogueRequest& Request, TArray<uint8>& OutBytes);
+    static bool DecodeDialogueRequest(const TArray<uint8>& Bytes, FAGLDialogueRequest& OutRequest);
+
+    static void EncodeDialogueResponse(const FAGLDialogueResponse& Response, TArray<uint8>& OutBytes);
+    static bool DecodeDialogueResponse(const TArray<uint8>& Bytes, FAGLDialogueResponse& OutResponse);
+
+    static void EncodeCreateMemoryRequest(const FAGLCreateMemoryRequest& Request, TArray<uint8>& OutBytes);
+    static bool DecodeCreateMemoryRequest(const TArray<uint8>& Bytes, FAGLCreateMemoryRequest& OutRequest);
+
+    static void EncodeSearchMemoriesRequest(const FAGLSearchMemoriesRequest& Request, TArray<uint8>& OutBytes);
+    static void EncodeGetContextRequest(const FAGLGetContextRequest& Request, TArray<uint8>& OutBytes);
+
+    static void EncodeMemory(const FAGLMemory& Memory, TArray<uint8>& OutBytes);
+    static bool DecodeMemory(const TArray<uint8>& Bytes, FAGLMemory& OutMemory);
+
+    static void EncodeMemorySearchResult(const FAGLMemorySearchResult& Result, TArray<uint8>& OutBytes);
+
+    /** Decode a search response: map with a "results" array */
+    static bool DecodeSearchResultsResponse(const TArray<uint8>& Bytes, TArray<FAGLMemorySearchResult>& OutResults);
+
+    /** Decode a memories response: map with a "memories" array */
+    static bool DecodeMemoriesResponse(const TArray<uint8>& Bytes, TArray<FAGLMemory>& OutMemories);
+
+private:
+    /** Encode a memory map inline with an existing writer */
+    static void WriteMemory(FAGLMessagePackWriter& Writer, const FAGLMemory& Memory);
+
+    /** Decode a memory map inline with an existing reader */
+    static bool ReadMemory(FAGLMessagePackReader& Reader, FAGLMemory& OutMemory);
+
+    /** Decode a search result map inline with an existing reader */
+    static bool ReadMemorySearchResult(FAGLMessagePackReader& Reader, FAGLMemorySearchResult& OutResult);
+};
@@ -0,0 +1,189 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "Stats/Stats.h"
+#include "AGLTypes.h"
+#include "AGLMetrics.generated.h"
+
+DECLARE_STATS_GROUP(TEXT("AGL"), STATGROUP_AGL, STATCAT_Advanced);
+
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Requests"), STAT_AGL_Requests, STATGROUP_AGL, AGL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Failures"), STAT_AGL_Failures, STATGROUP_AGL, AGL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Cache Hits"), STAT_AGL_CacheHits, STATGROUP_AGL, AGL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Emotion Latency (ms)"), STAT_AGL_EmotionLatencyMs, STATGROUP_AGL, AGL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Dialogue Latency (ms)"), STAT_AGL_DialogueLatencyMs, STATGROUP_AGL, AGL_API);
+DECLARE_DWORD_ACCUMULATOR_STAT_EXTERN(TEXT("Memory Latency (ms)"), STAT_AGL_MemoryLatencyMs, STATGROUP_AGL, AGL_API);
+DECLARE_FLOAT_ACCUMULATOR_STAT_EXTERN(TEXT("API Cost ($)"), STAT_AGL_TotalCost, STATGROUP_AGL, AGL_API);
+
+/** Which SDK service produced a metric record */
+UENUM(BlueprintType)
+enum class EAGLMetricService : uint8
+{
+    Emotion,
+    Dialogue,
+    Memory
+};
+
+/** One completed request, as recorded from a completion handler */
+struct FAGLMetricRecord
+{
+    /** Wire method that produced the response: "rule", "template", "llm", ... */
+    FName Method;
+
+    /** Server-reported latency when the response carries one, otherwise client-observed */
+    int32 LatencyMs = 0;
+
+    /** Response wire size in bytes; zero for local and cached responses */
+    int32 PayloadBytes = 0;
+
+    /** API cost reported by the backend, in dollars */
+    float Cost = 0.0f;
+
+    /** Whether the response came from a cache (local or backend) */
+    bool bCacheHit = false;
+};
+
+/** Aggregates over one service's retained window of records */
+USTRUCT(BlueprintType)
+struct AGL_API FAGLMetricsSnapshot
+{
+    GENERATED_BODY()
+
+    /** Successful requests recorded since startup (or the last reset) */
+    UPROPERTY(BlueprintReadOnly, Category = "AGL Metrics")
+    int32 TotalRequests = 0;
+
+    /** Failed requests since startup (or the last reset) */
+    UPROPERTY(BlueprintReadOnly, Category = "AGL Metrics")
+    int32 TotalFailures = 0;
+
+    /** Records in the retained window the aggregates below cover */
+    UPROPERTY(BlueprintReadOnly, Category = "AGL Metrics")
+    int32 SampleCount = 0;
+
+    /** Mean latency over the window, in milliseconds */
+    UPROPERTY(BlueprintReadOnly, Category = "AGL Metrics")
+    int32 AverageLatencyMs = 0;
+
+    /** Median latency over the window, in milliseconds */
+    UPROPERTY(BlueprintReadOnly, Category = "AGL Metrics")
+    int32 P50LatencyMs = 0;
+
+    /** 95th percentile latency over the window, in milliseconds */
+    UPROPERTY(BlueprintReadOnly, Category = "AGL Metrics")
+    int32 P95LatencyMs = 0;
+
+    /** 99th percentile latency over the window, in milliseconds */
+    UPROPERTY(BlueprintReadOnly, Category = "AGL Metrics")
+    int32 P99LatencyMs = 0;
+
+    /** Mean response wire size over the window, in bytes */
+    UPROPERTY(BlueprintReadOnly, Category = "AGL Metrics")
+    int32 AveragePayloadBytes = 0;
+
+    /** Fraction of windowed requests answered from a cache */
+    UPROPERTY(BlueprintReadOnly, Category = "AGL Metrics")
+    float CacheHitRate = 0.0f;
+
+    /** Accumulated API cost since startup (or the last reset), in dollars */
+    UPROPERTY(BlueprintReadOnly, Category = "AGL Metrics")
+    float TotalCost = 0.0f;
+};
+
+/**
+ * Hot-path request metrics for the SDK
+ *
+ * Responses carry LatencyMs and Cost on the wire, but until now the SDK
+ * dropped them after the callback ran, so integrators bolted their own
+ * logging on top to learn their P95s. This collector keeps a fixed ring
+ * of recent records per service and lifetime counters beside it, updated
+ * from completion handlers with a single atomic increment and a struct
+ * copy — no locks, no allocation, cheap enough to stay enabled in
+ * shipping builds. Records also feed the "stat AGL" group and the CSV
+ * profiler, so captures line SDK latency up against frame time.
+ *
+ * The ring write is lock-free, not linearizable: a reader lapping a
+ * writer can observe a half-written record. Aggregates tolerate that;
+ * nothing gameplay-visible ever depends on a snapshot.
+ *
+ * Aggregates come back through GetSnapshot for native telemetry
+ * pipelines, or through UAGLMetricsLibrary from Blueprint.
+ */
+class AGL_API FAGLMetrics
+{
+public:
+    /** Records retained per service; a power of two so slots wrap by mask */
+    static constexpr int32 RingCapacity = 256;
+
+    /** The process-wide collector */
+    static FAGLMetrics& Get();
+
+    /**
+     * Record a completed request
+     * @param Service Which service completed
+     * @param InRecord The request's metric fields
+     */
+    void Record(EAGLMetricService Service, const FAGLMetricRecord& InRecord);
+
+    /** Record a completed emotion request from its response */
+    void Record(EAGLMetricService Service, const FAGLEmotionResponse& Response, int32 PayloadBytes);
+
+    /** Record a completed dialogue request from its response */
+    void Record(EAGLMetricService Service, const FAGLDialogueResponse& Response, int32 PayloadBytes);
+
+    /**
+     * Record a failed request
+     * @param Service Which service failed
+     */
+    void RecordFailure(EAGLMetricService Service);
+
+    /**
+     * Aggregate the retained window for one service
+     * @param Service Which service to aggregate
+     * @return Counts, latency percentiles, cache hit rate, and cost
+     */
+    FAGLMetricsSnapshot GetSnapshot(EAGLMetricService Service) const;
+
+    /** Clear all counters and retained records */
+    void Reset();
+
+private:
+    /** Per-service ring of recent records plus lifetime counters */
+    struct FServiceRing
+    {
+        FAGLMetricRecord Records[RingCapacity];
+
+        /** Total records ever written; the slot index wraps by mask */
+        FThreadSafeCounter WriteCount;
+
+        /** Failed requests since startup */
+        FThreadSafeCounter FailureCount;
+
+        /** Lifetime cost in micro-dollars, so accumulation stays atomic */
+        FThreadSafeCounter CostMicroDollars;
+    };
+
+    /** One ring per EAGLMetricService value */
+    FServiceRing Rings[3];
+};
+
+/**
+ * Blueprint access to the SDK metrics collector
+ */
+UCLASS()
+class AGL_API UAGLMetricsLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    /** Aggregate the retained metrics window for one service */
+    UFUNCTION(BlueprintPure, Category = "AGL|Metrics")
+    static FAGLMetricsSnapshot GetMetricsSnapshot(EAGLMetricService Service);
+
+    /** Clear all metrics counters and retained records */
+    UFUNCTION(BlueprintCallable, Category = "AGL|Metrics")
+    static void ResetMetrics();
+};
@@ -0,0 +1,158 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Containers/Ticker.h"
+#include "AGLTypes.h"
+#include "AGLOfflineJournal.generated.h"
+
+class UAGLEmotionService;
+class UAGLDialogueService;
+class UAGLMemoryService;
+
+/**
+ * Bounded on-disk journal that replays requests lost to network outages
+ *
+ * When connectivity drops (console suspend/resume, flaky mobile links),
+ * a failed emotion, dialogue, or memory call used to just log an error —
+ * the companion permanently forgot what happened. The journal captures
+ * transport-level failures as compact MessagePack records, persists them
+ * under the project's Saved directory, and a replay ticker streams them
+ * back through the normal service paths in order once requests start
+ * succeeding again. A replayed request that fails while still offline
+ * simply re-journals itself, closing the loop until connectivity
+ * returns.
+ *
+ * Identical payloads coalesce into a single record, and the journal is
+ * bounded by a byte budget with oldest-first eviction, so disk and
+ * memory use stay predictable across long offline sessions. Only
+ * transport failures are journaled; HTTP error responses mean the
+ * backend was reachable and rejected the request, and replaying those
+ * would not change the outcome.
+ */
+UCLASS(BlueprintType)
+class AGL_API UAGLOfflineJournal : public UObject
+{
+    GENERATED_BODY()
+
+    // Friend test classes for testing protected members
+    friend class FAGLOfflineJournalBoundsTest;
+
+public:
+    /**
+     * Initialize the journal and load any records from a previous run
+     * @param InEmotionService Service replayed emotion requests go through
+     * @param InDialogueService Service replayed dialogue requests go through
+     * @param InMemoryService Service replayed memory requests go through
+     * @param InMaxBytes Journal byte budget before oldest-first eviction
+     * @param InReplayInterval Seconds between replay attempts
+     */
+    void Initialize(UAGLEmotionService* InEmotionService, UAGLDialogueService* InDialogueService, UAGLMemoryService* InMemoryService, int32 InMaxBytes, float InReplayInterval);
+
+    /** Stop the replay ticker and persist remaining records */
+    void Shutdown();
+
+    //~ Begin UObject Interface
+    virtual void BeginDestroy() override;
+    //~ End UObject Interface
+
+    /**
+     * Journal an emotion request that failed at the transport level
+     * @param Request The request that could not be delivered
+     */
+    void RecordEmotionRequest(const FAGLEmotionRequest& Request);
+
+    /**
+     * Journal a dialogue request that failed at the transport level
+     * @param Request The request that could not be delivered
+     */
+    void RecordDialogueRequest(const FAGLDialogueRequest& Request);
+
+    /**
+     * Journal a memory creation that failed at the transport level
+     * @param PlayerId Player the memory belongs to
+     * @param Request The request that could not be delivered
+     */
+    void RecordCreateMemoryRequest(const FString& PlayerId, const FAGLCreateMemoryRequest& Request);
+
+    /** Replay the oldest journaled requests through the services now */
+    UFUNCTION(BlueprintCallable, Category = "AGL|Offline")
+    void Replay();
+
+    /** Number of journaled records awaiting replay */
+    UFUNCTION(BlueprintPure, Category = "AGL|Offline")
+    int32 GetRecordCount() const { return Records.Num(); }
+
+    /** Total payload bytes currently journaled */
+    UFUNCTION(BlueprintPure, Category = "AGL|Offline")
+    int32 GetJournalBytes() const { return TotalPayloadBytes; }
+
+protected:
+    /** Kind tag identifying which service a record replays through */
+    enum class ERecordKind : uint8
+    {
+        Emotion = 0,
+        Dialogue = 1,
+        CreateMemory = 2
+    };
+
+    /** One journaled request */
+    struct FJournalRecord
+    {
+        /** Which service the record replays through */
+        ERecordKind Kind = ERecordKind::Emotion;
+
+        /** Player the record belongs to (memory records only) */
+        FString PlayerId;
+
+        /** MessagePack-encoded request payload */
+        TArray<uint8> Payload;
+    };
+
+    /** Replay on the timer */
+    bool TickReplay(float DeltaTime);
+
+    /** Append a record, coalescing duplicates and evicting oldest on overflow */
+    void Append(ERecordKind Kind, const FString& PlayerId, TArray<uint8>&& Payload);
+
+    /** Load journaled records from disk */
+    void LoadFromDisk();
+
+    /** Rewrite the journal file from the in-memory records */
+    void SaveToDisk();
+
+    /** Journal file location under the project's Saved directory */
+    static FString GetJournalFilePath();
+
+    /** Service replayed emotion requests go through */
+    UPROPERTY()
+    UAGLEmotionService* EmotionService = nullptr;
+
+    /** Service replayed dialogue requests go through */
+    UPROPERTY()
+    UAGLDialogueService* DialogueService = nullptr;
+
+    /** Service replayed memory requests go through */
+    UPROPERTY()
+    UAGLMemoryService* MemoryService = nullptr;
+
+    /** Journaled records in arrival order (game thread only) */
+    TArray<FJournalRecord> Records;
+
+    /** Sum of journaled payload bytes, checked against the budget */
+    int32 TotalPayloadBytes = 0;
+
+    /** Journal byte budget before oldest-first eviction */
+    int32 MaxBytes = 256 * 1024;
+
+    /** Seconds between replay attempts */
+    float ReplayInterval = 15.0f;
+
+    /** Records replayed per attempt, so a reconnect does not burst */
+    int32 ReplayBatchSize = 8;
+
+    /** Ticker handle for periodic replay */
+    FTSTicker::FDelegateHandle ReplayTickerHandle;
+};
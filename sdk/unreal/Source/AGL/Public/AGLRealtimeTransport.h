@@ -0,0 +1,105 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "Containers/Ticker.h"
+#include "AGLRealtimeTransport.generated.h"
+
+class IWebSocket;
+
+/** Delegate for a multiplexed realtime reply (raw JSON payload) */
+DECLARE_DELEGATE_TwoParams(FOnRealtimeReply, bool /*bSuccess*/, const FString& /*Payload*/);
+
+/**
+ * Persistent WebSocket transport to the realtime gateway
+ *
+ * Multiplexes emotion, dialogue and memory traffic over one long-lived
+ * connection. Each request carries an ID; replies are matched back to
+ * their caller. Compared to per-call HTTP this removes connection
+ * churn and shrinks per-message overhead to a small envelope.
+ *
+ * The transport is optional: when disconnected, SendRequest returns
+ * false and services fall back to their HTTP path. A dropped
+ * connection fails all in-flight requests the same way, so callers
+ * degrade to HTTP instead of hanging.
+ */
+UCLASS()
+class AGL_API UAGLRealtimeTransport : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Initialize the transport
+     * @param InGatewayUrl Realtime gateway URL (ws:// or wss://)
+     * @param InApiKey API key for authentication
+     * @param InTimeout Seconds before an unanswered request fails
+     */
+    void Initialize(const FString& InGatewayUrl, const FString& InApiKey, float InTimeout);
+
+    /** Open the connection; reconnects automatically are not attempted here */
+    void Connect();
+
+    /** Close the connection and fail any in-flight requests */
+    void Shutdown();
+
+    /** Whether the socket is currently open */
+    bool IsConnected() const;
+
+    /**
+     * Send a multiplexed request over the socket
+     * @param Service Target service name (emotion, dialogue, memory)
+     * @param Route Service route, matching the HTTP endpoint path
+     * @param JsonPayload Pre-serialized request body
+     * @param OnReply Invoked with the reply payload, or failure on drop/timeout
+     * @return False when not connected; caller should use the HTTP path
+     */
+    bool SendRequest(const FString& Service, const FString& Route, const FString& JsonPayload, FOnRealtimeReply OnReply);
+
+    //~ Begin UObject Interface
+    virtual void BeginDestroy() override;
+    //~ End UObject Interface
+
+protected:
+    /** An in-flight request awaiting its reply frame */
+    struct FPendingRequest
+    {
+        /** Caller's reply delegate */
+        FOnRealtimeReply Reply;
+
+        /** Platform seconds when the request was sent */
+        double SentAt = 0.0;
+    };
+
+    /** Handle an incoming reply frame */
+    void HandleMessage(const FString& Message);
+
+    /** Fail every in-flight request (connection dropped or shutting down) */
+    void FailAllPending();
+
+    /** Periodic check that fails requests older than the timeout */
+    bool TickTimeouts(float DeltaTime);
+
+    /** Gateway URL */
+    FString GatewayUrl;
+
+    /** API key */
+    FString ApiKey;
+
+    /** Request timeout in seconds */
+    float Timeout = 30.0f;
+
+    /** The underlying socket (null until Connect) */
+    TSharedPtr<IWebSocket> Socket;
+
+    /** Next request ID */
+    int32 NextRequestId = 1;
+
+    /** In-flight requests keyed by request ID */
+    TMap<int32, FPendingRequest> PendingRequests;
+
+    /** Ticker handle for the timeout sweep */
+    FTSTicker::FDelegateHandle TimeoutTickerHandle;
+};
@@ -0,0 +1,130 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Interfaces/IHttpRequest.h"
+#include "AGLTypes.h"
+
+/**
+ * Reusable per-request state for a service HTTP call
+ *
+ * Everything a completion handler needs — the typed callback, routing
+ * keys, and the original request for offline journaling — lives here
+ * instead of in a fresh lambda capture, so the handler only captures a
+ * pool index. The payload buffers keep their capacity across uses, so
+ * steady-state request issuance stops allocating for serialization.
+ *
+ * One context carries one request kind at a time; only the slots the
+ * issuing service filled are meaningful.
+ */
+struct AGL_API FAGLRequestContext
+{
+    /** Index of this context in its pool */
+    int32 PoolIndex = INDEX_NONE;
+
+    /** Reused MessagePack payload buffer (capacity survives Reset) */
+    TArray<uint8> BinaryPayload;
+
+    /** Reused JSON payload buffer */
+    FString StringPayload;
+
+    /** Reused gzip output buffer for large request bodies */
+    TArray<uint8> CompressionScratch;
+
+    /** Scheduler coalescing key, when the request went through one */
+    uint32 SchedulerKey = 0;
+
+    /** Dialogue response cache key, when caching is on */
+    uint32 CacheKey = 0;
+
+    /** Race upgrade window id, when the request is a dialogue race escalation */
+    uint32 RaceId = 0;
+
+    /** Player the request is for (memory requests) */
+    FString PlayerId;
+
+    /** Event type the fetched context is cached under */
+    FString CacheEventType;
+
+    /** Original emotion request, kept for offline journaling */
+    FAGLEmotionRequest EmotionRequest;
+
+    /** Original dialogue request, kept for offline journaling */
+    FAGLDialogueRequest DialogueRequest;
+
+    /** Original memory creation request, kept for offline journaling */
+    FAGLCreateMemoryRequest MemoryRequest;
+
+    /** Typed callback slot for emotion analysis */
+    FOnEmotionAnalysisComplete OnEmotion;
+
+    /** Typed callback slot for dialogue generation */
+    FOnDialogueGenerationComplete OnDialogue;
+
+    /** Typed callback slot for memory creation */
+    FOnMemoryCreated OnMemoryCreated;
+
+    /** Typed callback slot for memory search */
+    FOnMemorySearchComplete OnMemorySearch;
+
+    /** Typed callback slot for context/memory fetches */
+    FOnGetMemoriesComplete OnGetMemories;
+
+    /**
+     * Attach the serialized payload as the request body, gzipping it
+     * when compression is on and the payload crosses the threshold
+     * @param HttpRequest Request to attach the body to
+     * @param bBinaryPayload True to send BinaryPayload, false for
+     *        StringPayload
+     * @param bCompress Whether gzip request bodies are enabled
+     * @param MinCompressBytes Bodies below this size are sent as-is
+     */
+    void ApplyRequestBody(const TSharedRef<IHttpRequest, ESPMode::ThreadSafe>& HttpRequest, bool bBinaryPayload, bool bCompress, int32 MinCompressBytes);
+
+    /** Clear per-request state, keeping buffer capacity for reuse */
+    void Reset();
+};
+
+/**
+ * Free-list pool of request contexts
+ *
+ * Services check a context out per HTTP call and release it from the
+ * completion handler. Contexts allocate once on first use and are
+ * recycled afterwards, so the per-call delegate and payload churn the
+ * old lambda captures produced disappears at steady state.
+ *
+ * Game thread only, like the services that own a pool: requests are
+ * issued and completed there.
+ */
+class AGL_API FAGLRequestContextPool
+{
+public:
+    /** Check out a context, reusing a released one when available */
+    FAGLRequestContext& Acquire();
+
+    /**
+     * Return a context to the pool for reuse
+     * @param Context Context previously returned by Acquire
+     */
+    void Release(FAGLRequestContext& Context);
+
+    /**
+     * Look up a checked-out context by its pool index
+     * @param InPoolIndex Index captured by the completion handler
+     */
+    FAGLRequestContext& Get(int32 InPoolIndex);
+
+    /** Number of contexts the pool has ever allocated */
+    int32 GetAllocatedCount() const { return Contexts.Num(); }
+
+    /** Number of contexts currently checked out */
+    int32 GetInUseCount() const { return Contexts.Num() - FreeIndices.Num(); }
+
+private:
+    /** All contexts, checked out or free, stable-addressed by index */
+    TArray<TUniquePtr<FAGLRequestContext>> Contexts;
+
+    /** Indices of released contexts awaiting reuse */
+    TArray<int32> FreeIndices;
+};
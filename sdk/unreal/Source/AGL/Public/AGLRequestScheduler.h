@@ -0,0 +1,123 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/NoExportTypes.h"
+#include "AGLEmotionService.h"
+#include "AGLDialogueService.h"
+#include "AGLRequestScheduler.generated.h"
+
+/**
+ * Cross-service request coordinator owned by UAGLClient
+ *
+ * When several companion actors react to the same game event they fire
+ * byte-identical analyze/generate requests within the same frame. The
+ * scheduler dedups those by payload hash: the first caller becomes the
+ * leader and actually sends, later callers join the pending entry and
+ * every bound delegate receives the single response.
+ *
+ * It also acts as a priority gate. Foreground traffic (emotion,
+ * dialogue) always sends; background memory writes queue once the
+ * number of in-flight requests reaches the connection pool budget and
+ * drain as slots free up, so bursts never starve user-facing calls.
+ *
+ * All methods run on the game thread: requests are initiated there and
+ * every service marshals its completion back before finishing, so no
+ * locking is needed.
+ */
+UCLASS()
+class AGL_API UAGLRequestScheduler : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Initialize the scheduler
+     * @param InMaxConcurrentRequests In-flight budget before background requests queue
+     */
+    void Initialize(int32 InMaxConcurrentRequests);
+
+    /**
+     * Build a dedup key from the service name and serialized payload
+     * @param Service Service tag (e.g. "emotion")
+     * @param Payload Serialized request payload
+     * @return Hash identifying this request while it is in flight
+     */
+    static uint32 MakeKey(const TCHAR* Service, const FString& Payload);
+
+    /**
+     * Join an in-flight emotion request, or register as its leader
+     * @param Key Dedup key for the request
+     * @param OnComplete Delegate to run when the response arrives
+     * @return True when joined (caller must not send); false when the caller is the leader
+     */
+    bool JoinOrBeginEmotion(uint32 Key, FOnEmotionAnalysisComplete OnComplete);
+
+    /**
+     * Deliver an emotion response to every delegate waiting on the key
+     * @param Key Dedup key the leader registered with
+     * @param bSuccess Whether the request succeeded
+     * @param Response The shared response
+     */
+    void CompleteEmotion(uint32 Key, bool bSuccess, const FAGLEmotionResponse& Response);
+
+    /**
+     * Join an in-flight dialogue request, or register as its leader
+     * @param Key Dedup key for the request
+     * @param OnComplete Delegate to run when the response arrives
+     * @return True when joined (caller must not send); false when the caller is the leader
+     */
+    bool JoinOrBeginDialogue(uint32 Key, FOnDialogueGenerationComplete OnComplete);
+
+    /**
+     * Deliver a dialogue response to every delegate waiting on the key
+     * @param Key Dedup key the leader registered with
+     * @param bSuccess Whether the request succeeded
+     * @param Response The shared response
+     */
+    void CompleteDialogue(uint32 Key, bool bSuccess, const FAGLDialogueResponse& Response);
+
+    /**
+     * Run a background request now, or queue it while the budget is spent
+     * @param SendRequest Closure that performs the actual send
+     */
+    void SubmitBackground(TUniqueFunction<void()> SendRequest);
+
+    /**
+     * Release an in-flight slot and drain queued background requests.
+     * Called by services from background request completion paths.
+     */
+    void NotifyRequestFinished();
+
+    /** Requests answered by joining an in-flight duplicate */
+    UFUNCTION(BlueprintPure, Category = "AGL|Scheduler")
+    int32 GetCoalescedRequestCount() const { return CoalescedRequests; }
+
+    /** Background requests currently waiting for a free slot */
+    UFUNCTION(BlueprintPure, Category = "AGL|Scheduler")
+    int32 GetQueuedBackgroundCount() const { return BackgroundQueue.Num(); }
+
+    /** Requests currently in flight under scheduler accounting */
+    UFUNCTION(BlueprintPure, Category = "AGL|Scheduler")
+    int32 GetActiveRequestCount() const { return ActiveRequests; }
+
+protected:
+    /** Delegates waiting on an in-flight emotion request, keyed by payload hash */
+    TMap<uint32, TArray<FOnEmotionAnalysisComplete>> PendingEmotion;
+
+    /** Delegates waiting on an in-flight dialogue request, keyed by payload hash */
+    TMap<uint32, TArray<FOnDialogueGenerationComplete>> PendingDialogue;
+
+    /** Background sends waiting for a free slot, in submission order */
+    TArray<TUniqueFunction<void()>> BackgroundQueue;
+
+    /** In-flight budget before background requests queue */
+    int32 MaxConcurrentRequests = 4;
+
+    /** Requests currently in flight under scheduler accounting */
+    int32 ActiveRequests = 0;
+
+    /** Requests answered by joining an in-flight duplicate */
+    int32 CoalescedRequests = 0;
+};
@@ -0,0 +1,117 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "AGLTypes.h"
+
+/**
+ * Memory-mapped offline dialogue template library
+ *
+ * The backend's 90/10 strategy serves 90% of dialogue from templates,
+ * but the SDK still paid a network round trip to get them. A cooked
+ * binary template pack (persona x emotion x event x language) is
+ * memory-mapped at startup and served from a prebuilt index, so the
+ * template path costs one hash lookup and no network, and keeps working
+ * fully offline.
+ *
+ * Pack layout (little-endian):
+ *   [4]  magic "AGLT"
+ *   [4]  version (uint32)
+ *   [4]  entry count (uint32)
+ *   [12 * count] index records: persona, emotion, event, language (uint8
+ *        each) + text offset (uint32) + text length (uint32)
+ *   [..] UTF-8 text blob
+ */
+class AGL_API FAGLTemplateLibrary
+{
+public:
+    /** Pack format version written by CookPack */
+    static constexpr uint32 PackVersion = 1;
+
+    /** One template entry used when cooking a pack */
+    struct FTemplateEntry
+    {
+        EAGLPersona Persona;
+        EAGLEmotionType Emotion;
+        EAGLEventType EventType;
+        FString Language;
+        FString Text;
+    };
+
+    ~FAGLTemplateLibrary();
+
+    /**
+     * Memory-map a cooked template pack and build the lookup index
+     * @param PackFilePath Path to the cooked .aglt pack
+     * @return True when the pack was mapped and indexed
+     */
+    bool LoadPack(const FString& PackFilePath);
+
+    /** Release the mapped pack and index */
+    void Unload();
+
+    /** Whether a pack is loaded and ready for lookups */
+    bool IsLoaded() const { return MappedRegion != nullptr || FallbackData.Num() > 0; }
+
+    /**
+     * O(1) template lookup
+     * @param Persona NPC personality
+     * @param Emotion Current emotion
+     * @param EventType Triggering event
+     * @param Language Language code (zh, en, ja, ko)
+     * @param OutDialogue Receives the template text on success
+     * @return True when a matching template exists
+     */
+    bool TryGetTemplate(EAGLPersona Persona, EAGLEmotionType Emotion, EAGLEventType EventType, const FString& Language, FString& OutDialogue) const;
+
+    /** Number of templates in the loaded pack */
+    int32 GetTemplateCount() const { return Index.Num(); }
+
+    /**
+     * Cook a binary template pack from entries (used by tooling and tests)
+     * @param Entries Templates to pack
+     * @param PackFilePath Output file path
+     * @return True when the pack was written
+     */
+    static bool CookPack(const TArray<FTemplateEntry>& Entries, const FString& PackFilePath);
+
+private:
+    /** Location of one template's text inside the mapped blob */
+    struct FIndexedTemplate
+    {
+        uint32 TextOffset = 0;
+        uint32 TextLength = 0;
+    };
+
+    /** Pack lookup key from the four template dimensions */
+    static uint32 MakeKey(EAGLPersona Persona, EAGLEmotionType Emotion, EAGLEventType EventType, uint8 LanguageId);
+
+    /** Map a language code to its pack id (0xFF when unsupported) */
+    static uint8 LanguageToId(const FString& Language);
+
+    /** Parse the mapped pack bytes and build the index */
+    bool BuildIndex(const uint8* Data, int64 DataSize);
+
+    /** Base pointer of the pack bytes (mapped or fallback) */
+    const uint8* PackData = nullptr;
+
+    /** Total pack size in bytes */
+    int64 PackSize = 0;
+
+    /** Offset of the text blob within the pack */
+    int64 BlobOffset = 0;
+
+    /** Lookup index built once at load */
+    TMap<uint32, FIndexedTemplate> Index;
+
+    /** Memory-mapped file handle (null when the platform fell back to a read) */
+    IMappedFileHandle* MappedFile = nullptr;
+
+    /** Mapped region covering the whole pack */
+    IMappedFileRegion* MappedRegion = nullptr;
+
+    /** Full pack bytes when memory mapping is unavailable */
+    TArray<uint8> FallbackData;
+};
@@ -3,6 +3,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "AGLKeyValueStore.h"
 #include "AGLTypes.generated.h"
 
 /**
@@ -101,6 +102,152 @@ struct FAGL_API FAGLConfig
     /** Request timeout in seconds */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
     float Timeout = 30.0f;
+
+    /** Maximum warm keep-alive connections kept per service URL */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    int32 ConnectionPoolSize = 4;
+
+    /** Seconds before an idle pooled connection is evicted */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    float ConnectionIdleTimeout = 60.0f;
+
+    /** Queued emotion events that trigger a batch flush */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    int32 EventBatchSize = 16;
+
+    /** Maximum seconds a queued emotion event waits before a batch flush */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    float EventBatchFlushInterval = 0.1f;
+
+    /** Run the local rule engine as a first pass before calling the cloud */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    bool bUseLocalRuleEngine = true;
+
+    /** Minimum local rule confidence; lower results escalate to the cloud */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    float LocalRuleConfidenceThreshold = 0.85f;
+
+    /** Serve dialogue from the local template pack before calling the cloud */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    bool bUseLocalTemplates = true;
+
+    /** Path to the cooked dialogue template pack (.aglt); empty disables */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    FString DialogueTemplatePackPath;
+
+    /** Cache dialogue responses in-process to skip repeat round trips */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    bool bUseDialogueCache = true;
+
+    /** Seconds before a cached dialogue expires (matches backend 1h TTL) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    float DialogueCacheTTL = 3600.0f;
+
+    /** Maximum cached dialogue entries before LRU eviction */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    int32 DialogueCacheMaxEntries = 256;
+
+    /** Multiplex service traffic over a persistent WebSocket to the realtime gateway */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    bool bUseWebSocketTransport = false;
+
+    /** Realtime gateway URL for the WebSocket transport */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    FString RealtimeGatewayUrl = TEXT("ws://localhost:3001");
+
+    /** Encode HTTP payloads as MessagePack instead of JSON */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    bool bUseBinaryEncoding = false;
+
+    /** Coalesce identical in-flight requests and prioritize user-facing traffic */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    bool bUseRequestScheduler = true;
+
+    /** In-flight requests before background memory writes start queueing */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    int32 MaxConcurrentRequests = 8;
+
+    /** Prefetch memory context per event type and serve GetContext locally */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    bool bUseContextPrefetch = true;
+
+    /** Seconds before a cached context entry expires */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    float ContextCacheTTL = 300.0f;
+
+    /** Memories kept per cached event type */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    int32 ContextPrefetchLimit = 5;
+
+    /** Event types warmed when the player is set */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    TArray<FString> ContextPrefetchEvents = {
+        TEXT("player.victory"),
+        TEXT("player.defeat"),
+        TEXT("player.achievement"),
+        TEXT("player.levelup")
+    };
+
+    /** Accumulate memory creations and upload them as bulk requests */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    bool bUseMemoryWriteQueue = true;
+
+    /** Queued memory count that triggers a bulk flush */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    int32 MemoryWriteBatchSize = 16;
+
+    /** Maximum seconds a queued memory waits before a bulk flush */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    float MemoryWriteFlushInterval = 5.0f;
+
+    /** Failed flush attempts per memory before its delegate fails */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    int32 MemoryWriteMaxRetries = 3;
+
+    /** Journal transport-failed requests to disk and replay on reconnect */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    bool bUseOfflineJournal = true;
+
+    /** Offline journal byte budget before oldest-first eviction */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    int32 OfflineJournalMaxBytes = 262144;
+
+    /** Seconds between offline journal replay attempts */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    float OfflineReplayInterval = 15.0f;
+
+    /** Negotiate gzip on HTTP traffic */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    bool bUseCompression = true;
+
+    /** Gzip request bodies at or above this size */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    int32 CompressionMinRequestBytes = 4096;
+
+    /**
+     * Gzip request bodies at or above the threshold. Requires inflation
+     * middleware on the service; the bundled services do not ship one,
+     * so this defaults off
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    bool bCompressRequestBodies = false;
+
+    /** Drain completed-response callbacks under a per-frame time budget */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    bool bUseCallbackDispatcher = true;
+
+    /** Milliseconds of callback work allowed per frame */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    float CallbackBudgetMs = 2.0f;
+
+    /** Race local templates against a forced-LLM escalation and upgrade the
+        line when the cloud answers in time (roughly doubles dialogue spend) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    bool bUseDialogueRace = false;
+
+    /** Seconds the upgrade window stays open after the template answers */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
+    float DialogueRaceUpgradeWindow = 3.0f;
 };
 
 /**
@@ -117,11 +264,11 @@ struct FAGL_API FAGLEmotionRequest
 
     /** Event data (JSON) */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
-    TMap<FString, FString> Data;
+    FAGLKeyValueStore Data;
 
     /** Additional context */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
-    TMap<FString, FString> Context;
+    FAGLKeyValueStore Context;
 
     /** Force ML-based analysis */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
@@ -203,7 +350,7 @@ struct FAGL_API FAGLDialogueRequest
 
     /** Additional context */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
-    TMap<FString, FString> Context;
+    FAGLKeyValueStore Context;
 
     /** Force LLM generation */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
@@ -273,7 +420,7 @@ struct FAGL_API FAGLCreateMemoryRequest
 
     /** Additional context */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
-    TMap<FString, FString> Context;
+    FAGLKeyValueStore Context;
 
     /** Importance score (0-10) */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
@@ -314,7 +461,7 @@ struct FAGL_API FAGLMemory
 
     /** Additional context */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
-    TMap<FString, FString> Context;
+    FAGLKeyValueStore Context;
 
     /** Creation timestamp */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
@@ -371,3 +518,22 @@ struct FAGL_API FAGLGetContextRequest
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL")
     int32 Limit = 5;
 };
+
+// Service completion delegates, declared alongside the response types
+// they carry so shared infrastructure (request contexts, journals) can
+// hold typed callback slots without pulling in the service headers
+
+/** Delegate for emotion analysis completion */
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnEmotionAnalysisComplete, bool, bSuccess, const FAGLEmotionResponse&, Response);
+
+/** Delegate for dialogue generation completion */
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnDialogueGenerationComplete, bool, bSuccess, const FAGLDialogueResponse&, Response);
+
+/** Delegate for memory creation completion */
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnMemoryCreated, bool, bSuccess, const FAGLMemory&, Memory);
+
+/** Delegate for memory search completion */
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnMemorySearchComplete, bool, bSuccess, const TArray<FAGLMemorySearchResult>&, Results);
+
+/** Delegate for get memories completion */
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FOnGetMemoriesComplete, bool, bSuccess, const TArray<FAGLMemory>&, Memories);
@@ -0,0 +1,72 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AGLTypes.h"
+
+/**
+ * Shared wire-name tables for the AGL enums
+ *
+ * The emotion, dialogue, and memory serializers — JSON and MessagePack
+ * alike — all speak the same wire spellings ("player.victory",
+ * "first_time", ...). Each translation unit used to carry its own
+ * if-chain copy of the converters, which cost a cascade of FString
+ * compares per field on every request and response and left four copies
+ * free to drift apart.
+ *
+ * Each enum now has exactly one ordered table in AGLWireNames.cpp:
+ * ToString is a direct array index, and the StringTo direction is a
+ * single FName hash lookup against an index built once per enum.
+ * Unknown strings map to the same defaults the old converters used.
+ */
+struct AGL_API FAGLWireNames
+{
+    /**
+     * Wire spelling for an event type (e.g. "player.victory")
+     * @param EventType Event type to convert
+     */
+    static const TCHAR* EventTypeToString(EAGLEventType EventType);
+
+    /**
+     * Event type for a wire spelling; unknown strings map to Victory
+     * @param EventString Wire spelling to convert
+     */
+    static EAGLEventType StringToEventType(const FString& EventString);
+
+    /**
+     * Wire spelling for an emotion type (e.g. "happy")
+     * @param EmotionType Emotion type to convert
+     */
+    static const TCHAR* EmotionTypeToString(EAGLEmotionType EmotionType);
+
+    /**
+     * Emotion type for a wire spelling; unknown strings map to Neutral
+     * @param EmotionString Wire spelling to convert
+     */
+    static EAGLEmotionType StringToEmotionType(const FString& EmotionString);
+
+    /**
+     * Wire spelling for a persona (e.g. "cheerful")
+     * @param Persona Persona to convert
+     */
+    static const TCHAR* PersonaToString(EAGLPersona Persona);
+
+    /**
+     * Persona for a wire spelling; unknown strings map to Cheerful
+     * @param PersonaString Wire spelling to convert
+     */
+    static EAGLPersona StringToPersona(const FString& PersonaString);
+
+    /**
+     * Wire spelling for a memory type (e.g. "first_time")
+     * @param MemoryType Memory type to convert
+     */
+    static const TCHAR* MemoryTypeToString(EAGLMemoryType MemoryType);
+
+    /**
+     * Memory type for a wire spelling; unknown strings map to Event
+     * @param TypeString Wire spelling to convert
+     */
+    static EAGLMemoryType StringToMemoryType(const FString& TypeString);
+};
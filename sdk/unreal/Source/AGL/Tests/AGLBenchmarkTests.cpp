@@ -0,0 +1,277 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLTypes.h"
+#include "AGLDialogueCache.h"
+#include "AGLDialogueService.h"
+#include "AGLEmotionService.h"
+#include "AGLJsonWriter.h"
+#include "AGLMemoryService.h"
+#include "AGLMessagePack.h"
+#include "AGLWireNames.h"
+#include "Dom/JsonObject.h"
+#include "HAL/MemoryBase.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/CommandLine.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
+
+// Unreal Automation Framework
+#if WITH_DEV_AUTOMATION_TESTS
+
+/**
+ * Throughput and allocation benchmarks for the SDK hot paths
+ *
+ * The serialization tests prove the codecs are correct but say nothing
+ * about speed, so a regression like an accidental extra JSON copy would
+ * ship silently. This suite times each serializer, the enum converters,
+ * the request-hash computation, and counts heap allocations per
+ * operation where the allocator exposes its call counters.
+ *
+ * The first run writes a baseline JSON to Saved/AGL/. Later runs fail
+ * when a case's throughput drops more than the threshold below its
+ * baseline, or when its allocation count grows. Nightly device runs
+ * pass -AGLBenchThreshold=<fraction> to tune the tolerance and
+ * -AGLBenchUpdateBaseline to accept the current numbers.
+ *
+ * Registered under the Perf filter so the functional test passes stay
+ * fast; run via "Automation RunTests AGL.Benchmark".
+ */
+namespace AGLBenchmark
+{
+    struct FCaseResult
+    {
+        FString Name;
+        double OpsPerSecond = 0.0;
+        int32 AllocsPerOp = 0;
+    };
+
+    /** Time a callable over a fixed iteration count, with a short warmup */
+    template <typename FuncType>
+    FCaseResult RunCase(const TCHAR* Name, int32 Iterations, FuncType&& Func)
+    {
+        for (int32 Index = 0; Index < FMath::Max(1, Iterations / 20); ++Index)
+        {
+            Func();
+        }
+
+        const uint32 AllocsBefore = FMalloc::TotalMallocCalls.Load();
+        const double StartTime = FPlatformTime::Seconds();
+
+        for (int32 Index = 0; Index < Iterations; ++Index)
+        {
+            Func();
+        }
+
+        const double Elapsed = FPlatformTime::Seconds() - StartTime;
+        const uint32 AllocsAfter = FMalloc::TotalMallocCalls.Load();
+
+        FCaseResult Result;
+        Result.Name = Name;
+        Result.OpsPerSecond = Iterations / FMath::Max(Elapsed, KINDA_SMALL_NUMBER);
+        // The allocator only advances its call counters in instrumented
+        // builds; zero means "not measured", and the comparison skips it
+        Result.AllocsPerOp = static_cast<int32>((AllocsAfter - AllocsBefore) / Iterations);
+        return Result;
+    }
+
+    inline FString BaselinePath()
+    {
+        return FPaths::ProjectSavedDir() / TEXT("AGL") / TEXT("BenchmarkBaseline.json");
+    }
+
+    /** Build the 1k-memory search payload the memory benchmarks parse */
+    inline FString BuildMemoriesPayload(int32 Count)
+    {
+        TStringBuilder<4096> Builder;
+        FAGLJsonWriter Writer(Builder);
+        Writer.BeginObject();
+        Writer.BeginArray(TEXT("memories"));
+        for (int32 Index = 0; Index < Count; ++Index)
+        {
+            Writer.BeginObject();
+            Writer.WriteString(TEXT("id"), FString::Printf(TEXT("mem-%d"), Index));
+            Writer.WriteString(TEXT("playerId"), TEXT("player-123"));
+            Writer.WriteString(TEXT("content"), TEXT("Defeated the dragon boss on the first attempt"));
+            Writer.WriteString(TEXT("emotion"), TEXT("excited"));
+            Writer.WriteString(TEXT("type"), TEXT("achievement"));
+            Writer.WriteString(TEXT("createdAt"), TEXT("2026-01-01T00:00:00Z"));
+            Writer.BeginObject(TEXT("context"));
+            Writer.WriteString(TEXT("boss"), TEXT("dragon"));
+            Writer.WriteString(TEXT("attempts"), TEXT("1"));
+            Writer.EndObject();
+            Writer.EndObject();
+        }
+        Writer.EndArray();
+        Writer.EndObject();
+        return FString(Builder.ToString());
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLBenchmarkSuiteTest, "AGL.Benchmark.Suite",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::PerfFilter)
+
+bool FAGLBenchmarkSuiteTest::RunTest(const FString& Parameters)
+{
+    using namespace AGLBenchmark;
+
+    UAGLEmotionService* EmotionService = NewObject<UAGLEmotionService>();
+    UAGLDialogueService* DialogueService = NewObject<UAGLDialogueService>();
+    UAGLMemoryService* MemoryService = NewObject<UAGLMemoryService>();
+
+    // Representative request fixtures matching the demo game's traffic
+    FAGLEmotionRequest EmotionRequest = UAGLEmotionService::CreateVictoryRequest(true, 5);
+    EmotionRequest.PlayerId = TEXT("player-123");
+
+    FAGLDialogueRequest DialogueRequest;
+    DialogueRequest.EventType = EAGLEventType::Victory;
+    DialogueRequest.Emotion = EAGLEmotionType::Happy;
+    DialogueRequest.Persona = EAGLPersona::Cheerful;
+    DialogueRequest.PlayerId = TEXT("player-123");
+    DialogueRequest.Language = TEXT("en");
+    DialogueRequest.Context.Add(TEXT("enemy_type"), TEXT("dragon"));
+    DialogueRequest.Context.Add(TEXT("win_streak"), TEXT("5"));
+
+    const FString EmotionResponseJson = TEXT("{\"emotion\":\"excited\",\"intensity\":0.9,\"action\":\"cheer\",\"confidence\":0.92,\"reasoning\":\"Win streak going\",\"method\":\"rule\",\"cost\":0.0,\"cache_hit\":false,\"latency_ms\":12}");
+    const FString DialogueResponseJson = TEXT("{\"dialogue\":\"Amazing! Five wins in a row, you are unstoppable!\",\"emotion\":\"excited\",\"animation\":\"cheer\",\"method\":\"template\",\"cost\":0.0,\"cache_hit\":false,\"latency_ms\":8}");
+    const FString MemoriesPayload = BuildMemoriesPayload(1000);
+
+    TArray<uint8> EncodedEmotionResponse;
+    {
+        FAGLEmotionResponse SampleResponse = EmotionService->DeserializeResponse(EmotionResponseJson);
+        FAGLMessagePack::EncodeEmotionResponse(SampleResponse, EncodedEmotionResponse);
+    }
+
+    // Accumulate outputs so the optimizer cannot drop the work
+    int64 Sink = 0;
+
+    TArray<FCaseResult> Results;
+
+    Results.Add(RunCase(TEXT("EmotionSerializeRequest"), 20000, [&]()
+    {
+        Sink += EmotionService->SerializeRequest(EmotionRequest).Len();
+    }));
+
+    Results.Add(RunCase(TEXT("EmotionDeserializeResponse"), 20000, [&]()
+    {
+        Sink += static_cast<int64>(EmotionService->DeserializeResponse(EmotionResponseJson).Emotion);
+    }));
+
+    Results.Add(RunCase(TEXT("DialogueSerializeRequest"), 20000, [&]()
+    {
+        Sink += DialogueService->SerializeRequest(DialogueRequest).Len();
+    }));
+
+    Results.Add(RunCase(TEXT("DialogueDeserializeResponse"), 20000, [&]()
+    {
+        Sink += DialogueService->DeserializeResponse(DialogueResponseJson).Dialogue.Len();
+    }));
+
+    Results.Add(RunCase(TEXT("MemoryDeserialize1kMemories"), 50, [&]()
+    {
+        Sink += MemoryService->DeserializeMemories(MemoriesPayload).Num();
+    }));
+
+    Results.Add(RunCase(TEXT("MessagePackEncodeEmotionRequest"), 20000, [&]()
+    {
+        TArray<uint8> Bytes;
+        FAGLMessagePack::EncodeEmotionRequest(EmotionRequest, Bytes);
+        Sink += Bytes.Num();
+    }));
+
+    Results.Add(RunCase(TEXT("MessagePackDecodeEmotionResponse"), 20000, [&]()
+    {
+        FAGLEmotionResponse Decoded;
+        FAGLMessagePack::DecodeEmotionResponse(EncodedEmotionResponse, Decoded);
+        Sink += Decoded.LatencyMs;
+    }));
+
+    Results.Add(RunCase(TEXT("EnumConverters"), 100000, [&]()
+    {
+        Sink += FCString::Strlen(FAGLWireNames::EventTypeToString(EAGLEventType::Victory));
+        Sink += static_cast<int64>(FAGLWireNames::StringToEmotionType(TEXT("excited")));
+    }));
+
+    Results.Add(RunCase(TEXT("DialogueRequestHash"), 100000, [&]()
+    {
+        Sink += FAGLDialogueCache::ComputeKey(DialogueRequest);
+    }));
+
+    AddInfo(FString::Printf(TEXT("Benchmark sink checksum: %lld"), Sink));
+    for (const FCaseResult& Result : Results)
+    {
+        AddInfo(FString::Printf(TEXT("%s: %.0f ops/s, %d allocs/op"),
+            *Result.Name, Result.OpsPerSecond, Result.AllocsPerOp));
+    }
+
+    // Regression gate against the stored baseline
+    float Threshold = 0.3f;
+    FParse::Value(FCommandLine::Get(), TEXT("AGLBenchThreshold="), Threshold);
+    const bool bUpdateBaseline = FParse::Param(FCommandLine::Get(), TEXT("AGLBenchUpdateBaseline"));
+
+    FString BaselineJson;
+    TSharedPtr<FJsonObject> Baseline;
+    if (!bUpdateBaseline && FFileHelper::LoadFileToString(BaselineJson, *BaselinePath()))
+    {
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BaselineJson);
+        FJsonSerializer::Deserialize(Reader, Baseline);
+    }
+
+    if (Baseline.IsValid())
+    {
+        for (const FCaseResult& Result : Results)
+        {
+            const TSharedPtr<FJsonObject>* CaseObject = nullptr;
+            if (!Baseline->TryGetObjectField(Result.Name, CaseObject))
+            {
+                AddInfo(FString::Printf(TEXT("%s: no baseline entry, skipping comparison"), *Result.Name));
+                continue;
+            }
+
+            double BaselineOps = 0.0;
+            (*CaseObject)->TryGetNumberField(TEXT("ops_per_second"), BaselineOps);
+            if (BaselineOps > 0.0 && Result.OpsPerSecond < BaselineOps * (1.0 - Threshold))
+            {
+                AddError(FString::Printf(TEXT("%s regressed: %.0f ops/s vs baseline %.0f (threshold %.0f%%)"),
+                    *Result.Name, Result.OpsPerSecond, BaselineOps, Threshold * 100.0f));
+            }
+
+            int32 BaselineAllocs = 0;
+            (*CaseObject)->TryGetNumberField(TEXT("allocs_per_op"), BaselineAllocs);
+            if (BaselineAllocs > 0 && Result.AllocsPerOp > BaselineAllocs)
+            {
+                AddError(FString::Printf(TEXT("%s allocates more: %d allocs/op vs baseline %d"),
+                    *Result.Name, Result.AllocsPerOp, BaselineAllocs));
+            }
+        }
+    }
+    else
+    {
+        // First run (or explicit update): accept the current numbers
+        TStringBuilder<2048> Builder;
+        FAGLJsonWriter Writer(Builder);
+        Writer.BeginObject();
+        for (const FCaseResult& Result : Results)
+        {
+            Writer.BeginObject(*Result.Name);
+            Writer.WriteNumber(TEXT("ops_per_second"), static_cast<float>(Result.OpsPerSecond));
+            Writer.WriteNumber(TEXT("allocs_per_op"), Result.AllocsPerOp);
+            Writer.EndObject();
+        }
+        Writer.EndObject();
+
+        if (FFileHelper::SaveStringToFile(FString(Builder.ToString()), *BaselinePath()))
+        {
+            AddInfo(FString::Printf(TEXT("Wrote benchmark baseline to %s"), *BaselinePath()));
+        }
+        else
+        {
+            AddWarning(FString::Printf(TEXT("Could not write benchmark baseline to %s"), *BaselinePath()));
+        }
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
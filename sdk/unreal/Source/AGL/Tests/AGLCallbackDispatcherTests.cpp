@@ -0,0 +1,96 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLCallbackDispatcher.h"
+#include "HAL/PlatformProcess.h"
+#include "Misc/AutomationTest.h"
+
+// Unreal Automation Framework
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLCallbackDispatcherBudgetTest, "AGL.CallbackDispatcher.Budget",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLCallbackDispatcherBudgetTest::RunTest(const FString& Parameters)
+{
+    // The ticker is not started: the test drives TickDrain directly so
+    // the engine's core ticker cannot drain the lanes behind its back
+    UAGLCallbackDispatcher* Dispatcher = NewObject<UAGLCallbackDispatcher>();
+    Dispatcher->FrameBudgetMs = 2.0f;
+
+    // Queued callbacks run in FIFO order within a lane
+    {
+        TArray<int32> Order;
+        Dispatcher->Dispatch(EAGLCallbackLane::Emotion, [&Order]() { Order.Add(1); });
+        Dispatcher->Dispatch(EAGLCallbackLane::Emotion, [&Order]() { Order.Add(2); });
+        Dispatcher->Dispatch(EAGLCallbackLane::Emotion, [&Order]() { Order.Add(3); });
+
+        TestEqual("Nothing runs before the tick", Order.Num(), 0);
+        TestEqual("Three callbacks pending", Dispatcher->GetPendingCount(), 3);
+
+        Dispatcher->TickDrain(0.016f);
+
+        TestEqual("All three drained", Order.Num(), 3);
+        TestEqual("First in runs first", Order[0], 1);
+        TestEqual("Second preserved", Order[1], 2);
+        TestEqual("Third preserved", Order[2], 3);
+        TestEqual("Queue is empty", Dispatcher->GetPendingCount(), 0);
+    }
+
+    // An overrunning callback stops the drain at the budget, but at
+    // least one item runs per tick so the queue always makes progress
+    {
+        int32 Executed = 0;
+        for (int32 Index = 0; Index < 3; Index++)
+        {
+            Dispatcher->Dispatch(EAGLCallbackLane::Memory, [&Executed]()
+            {
+                FPlatformProcess::Sleep(0.004f);
+                Executed++;
+            });
+        }
+
+        Dispatcher->TickDrain(0.016f);
+        TestTrue("Budget stops the first drain early", Executed < 3);
+        TestTrue("At least one item ran", Executed >= 1);
+
+        // Subsequent ticks finish the backlog
+        for (int32 Tick = 0; Tick < 3 && Dispatcher->GetPendingCount() > 0; Tick++)
+        {
+            Dispatcher->TickDrain(0.016f);
+        }
+        TestEqual("Backlog drains across ticks", Executed, 3);
+    }
+
+    // A bypass drains its own lane first, then runs inline, so
+    // per-service ordering holds on the priority path
+    {
+        TArray<int32> Order;
+        Dispatcher->Dispatch(EAGLCallbackLane::Dialogue, [&Order]() { Order.Add(1); });
+        Dispatcher->Dispatch(EAGLCallbackLane::Dialogue, [&Order]() { Order.Add(2); });
+        Dispatcher->Dispatch(EAGLCallbackLane::Dialogue, [&Order]() { Order.Add(3); }, /*bBypassBudget*/ true);
+
+        TestEqual("Bypass ran without a tick", Order.Num(), 3);
+        TestEqual("Queued dialogue ran first", Order[0], 1);
+        TestEqual("Bypass item ran last", Order[2], 3);
+        TestEqual("Dialogue lane is empty", Dispatcher->GetPendingCount(), 0);
+    }
+
+    // A bypass in one lane leaves other lanes queued
+    {
+        int32 MemoryRuns = 0;
+        bool bDialogueRan = false;
+        Dispatcher->Dispatch(EAGLCallbackLane::Memory, [&MemoryRuns]() { MemoryRuns++; });
+        Dispatcher->Dispatch(EAGLCallbackLane::Dialogue, [&bDialogueRan]() { bDialogueRan = true; }, /*bBypassBudget*/ true);
+
+        TestTrue("Dialogue bypass ran", bDialogueRan);
+        TestEqual("Memory lane untouched by the bypass", MemoryRuns, 0);
+        TestEqual("Memory item still pending", Dispatcher->GetPendingCount(), 1);
+
+        Dispatcher->TickDrain(0.016f);
+        TestEqual("Memory drains on the next tick", MemoryRuns, 1);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,100 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLCompression.h"
+#include "Misc/AutomationTest.h"
+
+// Unreal Automation Framework
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLCompressionRoundTripTest, "AGL.Compression.RoundTrip",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLCompressionRoundTripTest::RunTest(const FString& Parameters)
+{
+    // Repetitive JSON-like text shrinks and restores byte-for-byte
+    {
+        FString Source;
+        for (int32 Index = 0; Index < 100; Index++)
+        {
+            Source += FString::Printf(TEXT("{\"id\":\"mem_%d\",\"type\":\"achievement\",\"content\":\"击败了传奇BOSS\",\"importance\":8},"), Index);
+        }
+
+        TArray<uint8> Plain;
+        FAGLCompression::StringToBytes(Source, Plain);
+
+        TArray<uint8> Compressed;
+        TestTrue("Compress succeeds", FAGLCompression::Compress(Plain, Compressed));
+        TestTrue("Repetitive payload shrinks", Compressed.Num() < Plain.Num());
+
+        TArray<uint8> Inflated;
+        TestTrue("Decompress succeeds", FAGLCompression::Decompress(Compressed, Inflated));
+        TestEqual("Inflated size matches", Inflated.Num(), Plain.Num());
+        TestEqual("Text round trips", FAGLCompression::BytesToString(Inflated), Source);
+    }
+
+    // Buffer reuse across calls produces identical results
+    {
+        TArray<uint8> Plain;
+        FAGLCompression::StringToBytes(TEXT("second payload through the same buffers"), Plain);
+
+        TArray<uint8> Compressed;
+        TArray<uint8> Inflated;
+        TestTrue("Compress into reused buffer", FAGLCompression::Compress(Plain, Compressed));
+        TestTrue("Decompress into reused buffer", FAGLCompression::Decompress(Compressed, Inflated));
+        TestEqual("Reused buffers round trip", FAGLCompression::BytesToString(Inflated),
+            TEXT("second payload through the same buffers"));
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLCompressionMalformedInputTest, "AGL.Compression.MalformedInput",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLCompressionMalformedInputTest::RunTest(const FString& Parameters)
+{
+    // Empty input has nothing to inflate
+    {
+        TArray<uint8> Empty;
+        TArray<uint8> OutPlain;
+        TestFalse("Empty input fails", FAGLCompression::Decompress(Empty, OutPlain));
+    }
+
+    // Shorter than the minimum gzip header + trailer
+    {
+        TArray<uint8> Truncated = { 0x1f, 0x8b, 0x08, 0x00 };
+        TArray<uint8> OutPlain;
+        TestFalse("Truncated stream fails", FAGLCompression::Decompress(Truncated, OutPlain));
+    }
+
+    // Valid length but garbage bytes in place of the deflate stream
+    {
+        TArray<uint8> Garbage;
+        Garbage.Init(0xAB, 64);
+        TArray<uint8> OutPlain;
+        TestFalse("Garbage stream fails", FAGLCompression::Decompress(Garbage, OutPlain));
+    }
+
+    // A corrupt trailer claiming an absurd inflated size is rejected
+    // before any allocation happens
+    {
+        TArray<uint8> Plain;
+        FAGLCompression::StringToBytes(TEXT("trailer corruption test"), Plain);
+
+        TArray<uint8> Compressed;
+        TestTrue("Compress succeeds", FAGLCompression::Compress(Plain, Compressed));
+
+        // ISIZE lives in the last four bytes, little-endian
+        Compressed[Compressed.Num() - 1] = 0xFF;
+        Compressed[Compressed.Num() - 2] = 0xFF;
+        Compressed[Compressed.Num() - 3] = 0xFF;
+        Compressed[Compressed.Num() - 4] = 0xFF;
+
+        TArray<uint8> OutPlain;
+        TestFalse("Corrupt trailer fails", FAGLCompression::Decompress(Compressed, OutPlain));
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,135 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLContextCache.h"
+#include "AGLTypes.h"
+#include "Misc/AutomationTest.h"
+
+// Unreal Automation Framework
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    FAGLMemory MakeMemory(const FString& Id, const FString& Content)
+    {
+        FAGLMemory Memory;
+        Memory.Id = Id;
+        Memory.Content = Content;
+        return Memory;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLContextCacheBehaviorTest, "AGL.ContextCache.Behavior",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLContextCacheBehaviorTest::RunTest(const FString& Parameters)
+{
+    FAGLContextCache Cache;
+    Cache.Configure(300.0f, 3);
+    Cache.SetPlayer(TEXT("player-1"));
+
+    TArray<FAGLMemory> Memories;
+    Memories.Add(MakeMemory(TEXT("m1"), TEXT("Won first match")));
+    Memories.Add(MakeMemory(TEXT("m2"), TEXT("Reached level 10")));
+
+    // Miss then hit
+    {
+        TArray<FAGLMemory> OutMemories;
+        TestFalse("Empty cache misses", Cache.TryGet(TEXT("player-1"), TEXT("player.victory"), OutMemories));
+
+        Cache.Put(TEXT("player-1"), TEXT("player.victory"), Memories);
+        TestTrue("Stored entry hits", Cache.TryGet(TEXT("player-1"), TEXT("player.victory"), OutMemories));
+        TestEqual("Cached memories preserved", OutMemories.Num(), 2);
+        TestEqual("Cached content preserved", OutMemories[0].Content, TEXT("Won first match"));
+        TestEqual("Hit counter", Cache.GetHitCount(), 1);
+        TestEqual("Miss counter", Cache.GetMissCount(), 1);
+    }
+
+    // Event types key independently
+    {
+        TArray<FAGLMemory> OutMemories;
+        TestFalse("Other event type misses", Cache.TryGet(TEXT("player-1"), TEXT("player.defeat"), OutMemories));
+    }
+
+    // Put for the wrong player is dropped, lookup for the wrong player misses
+    {
+        Cache.Put(TEXT("player-2"), TEXT("player.defeat"), Memories);
+        TestEqual("Stale player put dropped", Cache.GetEntryCount(), 1);
+
+        TArray<FAGLMemory> OutMemories;
+        TestFalse("Other player misses", Cache.TryGet(TEXT("player-2"), TEXT("player.victory"), OutMemories));
+    }
+
+    // Per-entry cap trims stored context
+    {
+        TArray<FAGLMemory> Oversized = Memories;
+        Oversized.Add(MakeMemory(TEXT("m3"), TEXT("Found rare loot")));
+        Oversized.Add(MakeMemory(TEXT("m4"), TEXT("Beat the boss")));
+        Cache.Put(TEXT("player-1"), TEXT("player.victory"), Oversized);
+
+        TArray<FAGLMemory> OutMemories;
+        Cache.TryGet(TEXT("player-1"), TEXT("player.victory"), OutMemories);
+        TestEqual("Entry trimmed to cap", OutMemories.Num(), 3);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLContextCacheUpdateTest, "AGL.ContextCache.Updates",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLContextCacheUpdateTest::RunTest(const FString& Parameters)
+{
+    FAGLContextCache Cache;
+    Cache.Configure(300.0f, 3);
+    Cache.SetPlayer(TEXT("player-1"));
+
+    TArray<FAGLMemory> Memories;
+    Memories.Add(MakeMemory(TEXT("m1"), TEXT("Won first match")));
+    Cache.Put(TEXT("player-1"), TEXT("player.victory"), Memories);
+    Cache.Put(TEXT("player-1"), TEXT("player.defeat"), Memories);
+
+    // A created memory is folded into every cached entry, newest first
+    {
+        Cache.AddMemory(TEXT("player-1"), MakeMemory(TEXT("m2"), TEXT("Beat the boss")));
+
+        TArray<FAGLMemory> OutMemories;
+        Cache.TryGet(TEXT("player-1"), TEXT("player.victory"), OutMemories);
+        TestEqual("Memory added to victory entry", OutMemories.Num(), 2);
+        TestEqual("New memory surfaces first", OutMemories[0].Id, TEXT("m2"));
+
+        Cache.TryGet(TEXT("player-1"), TEXT("player.defeat"), OutMemories);
+        TestEqual("Memory added to defeat entry", OutMemories.Num(), 2);
+    }
+
+    // A created memory for another player is ignored
+    {
+        Cache.AddMemory(TEXT("player-2"), MakeMemory(TEXT("m3"), TEXT("Someone else's moment")));
+
+        TArray<FAGLMemory> OutMemories;
+        Cache.TryGet(TEXT("player-1"), TEXT("player.victory"), OutMemories);
+        TestEqual("Other player's memory ignored", OutMemories.Num(), 2);
+    }
+
+    // Switching players drops the previous session's entries
+    {
+        Cache.SetPlayer(TEXT("player-2"));
+        TestEqual("Entries cleared on player switch", Cache.GetEntryCount(), 0);
+
+        TArray<FAGLMemory> OutMemories;
+        TestFalse("Previous player's context gone", Cache.TryGet(TEXT("player-2"), TEXT("player.victory"), OutMemories));
+    }
+
+    // Setting the same player again keeps the cache warm
+    {
+        TArray<FAGLMemory> Memories2;
+        Memories2.Add(MakeMemory(TEXT("m4"), TEXT("New session moment")));
+        Cache.Put(TEXT("player-2"), TEXT("player.victory"), Memories2);
+
+        Cache.SetPlayer(TEXT("player-2"));
+        TestEqual("Same player keeps entries", Cache.GetEntryCount(), 1);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,106 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLDialogueCache.h"
+#include "AGLTypes.h"
+#include "Misc/AutomationTest.h"
+
+// Unreal Automation Framework
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLDialogueCacheKeyTest, "AGL.DialogueCache.Keys",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLDialogueCacheKeyTest::RunTest(const FString& Parameters)
+{
+    FAGLDialogueRequest Request;
+    Request.EventType = EAGLEventType::Victory;
+    Request.Emotion = EAGLEmotionType::Happy;
+    Request.Persona = EAGLPersona::Cheerful;
+    Request.Language = TEXT("en");
+    Request.Context.Add(TEXT("enemy_type"), TEXT("dragon"));
+    Request.Context.Add(TEXT("win_streak"), TEXT("5"));
+
+    // Identical requests key identically
+    {
+        FAGLDialogueRequest Same = Request;
+        TestEqual("Identical requests share a key", FAGLDialogueCache::ComputeKey(Request), FAGLDialogueCache::ComputeKey(Same));
+    }
+
+    // Context insertion order does not change the key
+    {
+        FAGLDialogueRequest Reordered;
+        Reordered.EventType = Request.EventType;
+        Reordered.Emotion = Request.Emotion;
+        Reordered.Persona = Request.Persona;
+        Reordered.Language = Request.Language;
+        Reordered.Context.Add(TEXT("win_streak"), TEXT("5"));
+        Reordered.Context.Add(TEXT("enemy_type"), TEXT("dragon"));
+
+        TestEqual("Context order independent", FAGLDialogueCache::ComputeKey(Request), FAGLDialogueCache::ComputeKey(Reordered));
+    }
+
+    // Any differing dimension changes the key
+    {
+        FAGLDialogueRequest Different = Request;
+        Different.Language = TEXT("zh");
+        TestNotEqual("Language changes key", FAGLDialogueCache::ComputeKey(Request), FAGLDialogueCache::ComputeKey(Different));
+
+        Different = Request;
+        Different.Emotion = EAGLEmotionType::Sad;
+        TestNotEqual("Emotion changes key", FAGLDialogueCache::ComputeKey(Request), FAGLDialogueCache::ComputeKey(Different));
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLDialogueCacheBehaviorTest, "AGL.DialogueCache.Behavior",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLDialogueCacheBehaviorTest::RunTest(const FString& Parameters)
+{
+    FAGLDialogueCache Cache;
+    Cache.Configure(2, 3600.0f);
+
+    FAGLDialogueResponse Response;
+    Response.Dialogue = TEXT("Great job!");
+    Response.Method = TEXT("llm");
+
+    // Miss then hit
+    {
+        FAGLDialogueResponse OutResponse;
+        TestFalse("Empty cache misses", Cache.TryGet(1, OutResponse));
+
+        Cache.Put(1, Response);
+        TestTrue("Stored entry hits", Cache.TryGet(1, OutResponse));
+        TestEqual("Cached dialogue preserved", OutResponse.Dialogue, TEXT("Great job!"));
+        TestTrue("Hit marked as cache hit", OutResponse.bCacheHit);
+        TestEqual("Hit counter", Cache.GetHitCount(), 1);
+        TestEqual("Miss counter", Cache.GetMissCount(), 1);
+    }
+
+    // LRU eviction at the entry cap
+    {
+        Cache.Put(2, Response);
+
+        FAGLDialogueResponse OutResponse;
+        Cache.TryGet(1, OutResponse); // touch 1 so 2 is least recent
+
+        Cache.Put(3, Response); // evicts 2
+
+        TestTrue("Recently used entry survives", Cache.TryGet(1, OutResponse));
+        TestFalse("LRU entry evicted", Cache.TryGet(2, OutResponse));
+        TestTrue("New entry present", Cache.TryGet(3, OutResponse));
+    }
+
+    // Reset clears entries and counters
+    {
+        Cache.Reset();
+        TestEqual("Entries cleared", Cache.GetEntryCount(), 0);
+        TestEqual("Hits cleared", Cache.GetHitCount(), 0);
+        TestEqual("Misses cleared", Cache.GetMissCount(), 0);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,66 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLDialogueService.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+
+// Unreal Automation Framework
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLDialogueRaceWindowTest, "AGL.Dialogue.RaceWindow",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLDialogueRaceWindowTest::RunTest(const FString& Parameters)
+{
+    // The gate lives in ExecuteDialogueCallback; the test feeds it
+    // windows directly instead of standing up the network path
+    UAGLDialogueService* Service = NewObject<UAGLDialogueService>();
+    Service->ConfigureRaceMode(true, 5.0f);
+
+    FOnDialogueGenerationComplete UnboundCallback;
+    FAGLDialogueResponse LLMResponse;
+    LLMResponse.Dialogue = TEXT("You have grown so much since that first boss!");
+    LLMResponse.Method = TEXT("llm");
+
+    // An upgrade inside the window is delivered and consumes its entry
+    {
+        Service->PendingRaceDeadlines.Add(1, FPlatformTime::Seconds() + 5.0);
+        Service->ExecuteDialogueCallback(true, LLMResponse, UnboundCallback, 0, 1);
+
+        TestEqual("Upgrade inside the window delivered", Service->GetRaceUpgradesDelivered(), 1);
+        TestEqual("No upgrade expired yet", Service->GetRaceUpgradesExpired(), 0);
+        TestEqual("Window entry consumed", Service->PendingRaceDeadlines.Num(), 0);
+    }
+
+    // An upgrade after the deadline is suppressed
+    {
+        Service->PendingRaceDeadlines.Add(2, FPlatformTime::Seconds() - 1.0);
+        Service->ExecuteDialogueCallback(true, LLMResponse, UnboundCallback, 0, 2);
+
+        TestEqual("Late upgrade suppressed", Service->GetRaceUpgradesDelivered(), 1);
+        TestEqual("Late upgrade counted as expired", Service->GetRaceUpgradesExpired(), 1);
+        TestEqual("Expired entry consumed", Service->PendingRaceDeadlines.Num(), 0);
+    }
+
+    // An unknown race id is dropped without touching either counter
+    {
+        Service->ExecuteDialogueCallback(true, LLMResponse, UnboundCallback, 0, 99);
+
+        TestEqual("Unknown race delivered nothing", Service->GetRaceUpgradesDelivered(), 1);
+        TestEqual("Unknown race expired nothing", Service->GetRaceUpgradesExpired(), 1);
+    }
+
+    // A failed escalation is dropped silently; the template line stands
+    {
+        Service->PendingRaceDeadlines.Add(3, FPlatformTime::Seconds() + 5.0);
+        Service->ExecuteDialogueCallback(false, LLMResponse, UnboundCallback, 0, 3);
+
+        TestEqual("Failure delivered nothing", Service->GetRaceUpgradesDelivered(), 1);
+        TestEqual("Failure expired nothing", Service->GetRaceUpgradesExpired(), 1);
+        TestEqual("Failure consumed its window", Service->PendingRaceDeadlines.Num(), 0);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,186 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLJsonReader.h"
+#include "Misc/AutomationTest.h"
+
+// Unreal Automation Framework
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLJsonReaderFlatObjectTest, "AGL.JsonReader.FlatObject",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLJsonReaderFlatObjectTest::RunTest(const FString& Parameters)
+{
+    const FString Json = TEXT("{\"name\":\"companion\",\"count\":42,\"score\":0.75,\"active\":true,\"missing\":null}");
+
+    FAGLJsonArena Arena;
+    FAGLJsonReader Reader(Json, Arena);
+    TestTrue("Enter root object", Reader.EnterObject());
+
+    FString Name;
+    int32 Count = 0;
+    float Score = 0.0f;
+    bool bActive = false;
+    bool bSawNull = false;
+
+    FStringView Key;
+    while (Reader.NextField(Key))
+    {
+        if (Key == TEXT("name"))        { Reader.ReadString(Name); }
+        else if (Key == TEXT("count"))  { Reader.ReadNumber(Count); }
+        else if (Key == TEXT("score"))  { Reader.ReadNumber(Score); }
+        else if (Key == TEXT("active")) { Reader.ReadBool(bActive); }
+        else if (Key == TEXT("missing"))
+        {
+            FString Unused;
+            bSawNull = !Reader.ReadString(Unused);
+        }
+    }
+
+    TestFalse("No parse error", Reader.HadError());
+    TestEqual("String field", Name, FString(TEXT("companion")));
+    TestEqual("Integer field", Count, 42);
+    TestEqual("Float field", Score, 0.75f, 0.0001f);
+    TestTrue("Boolean field", bActive);
+    TestTrue("Null reads as no value", bSawNull);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLJsonReaderEscapesTest, "AGL.JsonReader.Escapes",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLJsonReaderEscapesTest::RunTest(const FString& Parameters)
+{
+    const FString Json = TEXT("{\"line\":\"He said \\\"go\\\"\\nnow\",\"tab\":\"a\\tb\",\"unicode\":\"\\u0041\\u4F60\"}");
+
+    FAGLJsonArena Arena;
+    FAGLJsonReader Reader(Json, Arena);
+    TestTrue("Enter root object", Reader.EnterObject());
+
+    FString Line;
+    FString Tab;
+    FString Unicode;
+
+    FStringView Key;
+    while (Reader.NextField(Key))
+    {
+        if (Key == TEXT("line"))         { Reader.ReadString(Line); }
+        else if (Key == TEXT("tab"))     { Reader.ReadString(Tab); }
+        else if (Key == TEXT("unicode")) { Reader.ReadString(Unicode); }
+        else                             { Reader.SkipValue(); }
+    }
+
+    TestFalse("No parse error", Reader.HadError());
+    TestEqual("Quote and newline escapes", Line, FString(TEXT("He said \"go\"\nnow")));
+    TestEqual("Tab escape", Tab, FString(TEXT("a\tb")));
+    TestEqual("Unicode escapes", Unicode, FString::Printf(TEXT("A%c"), static_cast<TCHAR>(0x4F60)));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLJsonReaderSkipAndNestingTest, "AGL.JsonReader.SkipAndNesting",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLJsonReaderSkipAndNestingTest::RunTest(const FString& Parameters)
+{
+    // Unknown fields carry nested containers and brace-laden strings the
+    // skip must step over whole
+    const FString Json = TEXT("{\"unknown\":{\"a\":[1,2,{\"b\":\"}{\"}],\"c\":null},\"items\":[\"x\",\"y\"],\"after\":7}");
+
+    FAGLJsonArena Arena;
+    FAGLJsonReader Reader(Json, Arena);
+    TestTrue("Enter root object", Reader.EnterObject());
+
+    TArray<FString> Items;
+    int32 After = 0;
+
+    FStringView Key;
+    while (Reader.NextField(Key))
+    {
+        if (Key == TEXT("items"))
+        {
+            if (Reader.EnterArray())
+            {
+                while (Reader.NextElement())
+                {
+                    FString Item;
+                    if (Reader.ReadString(Item))
+                    {
+                        Items.Add(MoveTemp(Item));
+                    }
+                }
+            }
+        }
+        else if (Key == TEXT("after")) { Reader.ReadNumber(After); }
+        else                           { Reader.SkipValue(); }
+    }
+
+    TestFalse("No parse error", Reader.HadError());
+    TestEqual("Array elements read", Items.Num(), 2);
+    if (Items.Num() == 2)
+    {
+        TestEqual("First element", Items[0], FString(TEXT("x")));
+        TestEqual("Second element", Items[1], FString(TEXT("y")));
+    }
+    TestEqual("Field after skipped container", After, 7);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLJsonReaderErrorsTest, "AGL.JsonReader.Errors",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLJsonReaderErrorsTest::RunTest(const FString& Parameters)
+{
+    // Not an object at the root
+    {
+        FAGLJsonArena Arena;
+        FAGLJsonReader Reader(TEXT("[1,2,3]"), Arena);
+        TestFalse("Root array rejected by EnterObject", Reader.EnterObject());
+        TestTrue("Error flagged", Reader.HadError());
+    }
+
+    // Truncated input stops the field walk with the error flag set
+    {
+        FAGLJsonArena Arena;
+        FAGLJsonReader Reader(TEXT("{\"a\":\"unterminated"), Arena);
+        TestTrue("Enter root object", Reader.EnterObject());
+
+        FStringView Key;
+        while (Reader.NextField(Key))
+        {
+            FString Value;
+            Reader.ReadString(Value);
+        }
+        TestTrue("Truncated string flagged", Reader.HadError());
+    }
+
+    // The arena is reusable across parses after a reset
+    {
+        FAGLJsonArena Arena;
+        {
+            FAGLJsonReader Reader(TEXT("{\"a\":\"with \\\"escape\\\"\"}"), Arena);
+            FStringView Key;
+            FString Value;
+            TestTrue("First parse enters", Reader.EnterObject());
+            TestTrue("First parse has a field", Reader.NextField(Key));
+            TestTrue("First parse reads", Reader.ReadString(Value));
+        }
+
+        Arena.Reset();
+
+        FAGLJsonReader Reader(TEXT("{\"b\":3}"), Arena);
+        FStringView Key;
+        int32 Value = 0;
+        TestTrue("Second parse enters", Reader.EnterObject());
+        TestTrue("Second parse has a field", Reader.NextField(Key));
+        TestTrue("Second parse reads", Reader.ReadNumber(Value));
+        TestEqual("Second parse value", Value, 3);
+        TestFalse("Second parse clean", Reader.HadError());
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
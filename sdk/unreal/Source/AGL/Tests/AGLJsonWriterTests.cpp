@@ -0,0 +1,92 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLJsonWriter.h"
+#include "Json.h"
+#include "Misc/AutomationTest.h"
+
+// Unreal Automation Framework
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLJsonWriterOutputTest, "AGL.JsonWriter.Output",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLJsonWriterOutputTest::RunTest(const FString& Parameters)
+{
+    // Flat object with every field kind
+    {
+        TStringBuilder<512> Builder;
+        FAGLJsonWriter Writer(Builder);
+
+        Writer.BeginObject();
+        Writer.WriteString(TEXT("type"), TEXT("player.victory"));
+        Writer.WriteBool(TEXT("force_ml"), false);
+        Writer.WriteNumber(TEXT("limit"), 10);
+        Writer.EndObject();
+
+        FString Json(Builder.ToString());
+        TestEqual("Flat object output", Json, TEXT("{\"type\":\"player.victory\",\"force_ml\":false,\"limit\":10}"));
+    }
+
+    // Nested map object
+    {
+        TStringBuilder<512> Builder;
+        FAGLJsonWriter Writer(Builder);
+
+        TMap<FString, FString> Data;
+        Data.Add(TEXT("mvp"), TEXT("true"));
+
+        Writer.BeginObject();
+        Writer.WriteMap(TEXT("data"), Data);
+        Writer.EndObject();
+
+        FString Json(Builder.ToString());
+        TestEqual("Nested map output", Json, TEXT("{\"data\":{\"mvp\":\"true\"}}"));
+    }
+
+    // Escaping matches FJsonSerializer and the result stays parseable
+    {
+        TStringBuilder<512> Builder;
+        FAGLJsonWriter Writer(Builder);
+
+        Writer.BeginObject();
+        Writer.WriteString(TEXT("content"), TEXT("NPC said: \"Hello\"\nLine\\two"));
+        Writer.WriteString(TEXT("unicode"), TEXT("击败了传奇BOSS"));
+        Writer.EndObject();
+
+        FString Json(Builder.ToString());
+        TestTrue("Quotes escaped", Json.Contains(TEXT("\\\"Hello\\\"")));
+        TestTrue("Newline escaped", Json.Contains(TEXT("\\n")));
+        TestTrue("Backslash escaped", Json.Contains(TEXT("\\\\two")));
+        TestTrue("Unicode passed through", Json.Contains(TEXT("击败了传奇BOSS")));
+
+        TSharedPtr<FJsonObject> JsonObject;
+        TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Json);
+        TestTrue("Output is valid JSON", FJsonSerializer::Deserialize(Reader, JsonObject));
+
+        FString RoundTripped;
+        if (JsonObject.IsValid() && JsonObject->TryGetStringField(TEXT("content"), RoundTripped))
+        {
+            TestEqual("Escaped content round trips", RoundTripped, TEXT("NPC said: \"Hello\"\nLine\\two"));
+        }
+    }
+
+    // Array fields
+    {
+        TStringBuilder<512> Builder;
+        FAGLJsonWriter Writer(Builder);
+
+        Writer.BeginObject();
+        Writer.BeginArray(TEXT("reasons"));
+        Writer.WriteArrayString(TEXT("win_streak"));
+        Writer.WriteArrayString(TEXT("legendary"));
+        Writer.EndArray();
+        Writer.EndObject();
+
+        FString Json(Builder.ToString());
+        TestEqual("Array output", Json, TEXT("{\"reasons\":[\"win_streak\",\"legendary\"]}"));
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,161 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLKeyValueStore.h"
+#include "Misc/AutomationTest.h"
+#include "UObject/Class.h"
+
+// Unreal Automation Framework
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLKeyValueStoreBasicsTest, "AGL.KeyValueStore.Basics",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLKeyValueStoreBasicsTest::RunTest(const FString& Parameters)
+{
+    FAGLKeyValueStore Store;
+    TestEqual("Empty store has no entries", Store.Num(), 0);
+    TestNull("Find on empty store", Store.Find(TEXT("missing")));
+    TestEqual("FindRef on empty store", Store.FindRef(TEXT("missing")), FString());
+
+    Store.Add(TEXT("winStreak"), TEXT("3"));
+    Store.Add(TEXT("mvp"), TEXT("true"));
+    TestEqual("Two entries after two adds", Store.Num(), 2);
+    TestTrue("Contains added key", Store.Contains(TEXT("winStreak")));
+    TestEqual("FindRef returns value", Store.FindRef(TEXT("mvp")), FString(TEXT("true")));
+
+    const FString* Found = Store.Find(TEXT("winStreak"));
+    TestNotNull("Find returns pointer", Found);
+    if (Found)
+    {
+        TestEqual("Find returns value", *Found, FString(TEXT("3")));
+    }
+
+    // Add replaces under an existing key, matching TMap semantics
+    Store.Add(TEXT("winStreak"), TEXT("5"));
+    TestEqual("Replace does not grow the store", Store.Num(), 2);
+    TestEqual("Replace updates the value", Store.FindRef(TEXT("winStreak")), FString(TEXT("5")));
+
+    // String keys land in the same slot as literal keys
+    Store.Add(FString(TEXT("winStreak")), TEXT("7"));
+    TestEqual("String key hits the literal key slot", Store.Num(), 2);
+    TestEqual("String key replaces the value", Store.FindRef(TEXT("winStreak")), FString(TEXT("7")));
+
+    // Keys are case-sensitive, matching the TMap the store replaced
+    Store.Add(TEXT("WinStreak"), TEXT("9"));
+    TestEqual("Case-different key is a distinct entry", Store.Num(), 3);
+    TestEqual("Original casing untouched", Store.FindRef(TEXT("winStreak")), FString(TEXT("7")));
+
+    Store.Reset();
+    TestEqual("Reset empties the store", Store.Num(), 0);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLKeyValueStoreIterationTest, "AGL.KeyValueStore.Iteration",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLKeyValueStoreIterationTest::RunTest(const FString& Parameters)
+{
+    FAGLKeyValueStore Store;
+    Store.Add(TEXT("first"), TEXT("1"));
+    Store.Add(TEXT("second"), TEXT("2"));
+    Store.Add(TEXT("third"), TEXT("3"));
+
+    // Range-for yields entries in insertion order, so serialized
+    // payloads are deterministic
+    TArray<FString> Keys;
+    for (const FAGLKeyValuePair& Pair : Store)
+    {
+        Keys.Add(Pair.Key);
+    }
+
+    TestEqual("Iterated all entries", Keys.Num(), 3);
+    if (Keys.Num() == 3)
+    {
+        TestEqual("Insertion order kept (0)", Keys[0], FString(TEXT("first")));
+        TestEqual("Insertion order kept (1)", Keys[1], FString(TEXT("second")));
+        TestEqual("Insertion order kept (2)", Keys[2], FString(TEXT("third")));
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLKeyValueStoreHashTest, "AGL.KeyValueStore.Hash",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLKeyValueStoreHashTest::RunTest(const FString& Parameters)
+{
+    FAGLKeyValueStore Store;
+    Store.Add(TEXT("enemy_type"), TEXT("dragon"));
+    Store.Add(TEXT("win_streak"), TEXT("5"));
+
+    // Insertion order does not change the hash; this backs the dialogue
+    // cache key and event dedup guarantees
+    FAGLKeyValueStore Reordered;
+    Reordered.Add(TEXT("win_streak"), TEXT("5"));
+    Reordered.Add(TEXT("enemy_type"), TEXT("dragon"));
+    TestEqual("Order independent hash", Store.ComputeHash(), Reordered.ComputeHash());
+
+    // Different values hash differently
+    FAGLKeyValueStore Different;
+    Different.Add(TEXT("enemy_type"), TEXT("dragon"));
+    Different.Add(TEXT("win_streak"), TEXT("6"));
+    TestNotEqual("Value change changes the hash", Store.ComputeHash(), Different.ComputeHash());
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLKeyValueStoreConversionTest, "AGL.KeyValueStore.Conversion",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLKeyValueStoreConversionTest::RunTest(const FString& Parameters)
+{
+    TMap<FString, FString> Map;
+    Map.Add(TEXT("game"), TEXT("moba"));
+    Map.Add(TEXT("player"), TEXT("p123"));
+
+    const FAGLKeyValueStore Store = UAGLKeyValueLibrary::MakeKeyValueStore(Map);
+    TestEqual("Map converts entry for entry", UAGLKeyValueLibrary::GetKeyValueCount(Store), 2);
+    TestEqual("Converted value survives", UAGLKeyValueLibrary::GetKeyValue(Store, TEXT("game")), FString(TEXT("moba")));
+
+    const TMap<FString, FString> RoundTrip = UAGLKeyValueLibrary::KeyValueStoreToMap(Store);
+    TestEqual("Round trip keeps entry count", RoundTrip.Num(), 2);
+    TestEqual("Round trip keeps values", RoundTrip.FindRef(TEXT("player")), FString(TEXT("p123")));
+
+    FAGLKeyValueStore Mutable;
+    UAGLKeyValueLibrary::SetKeyValue(Mutable, TEXT("difficulty"), TEXT("hard"));
+    UAGLKeyValueLibrary::SetKeyValue(Mutable, TEXT("difficulty"), TEXT("easy"));
+    TestEqual("SetKeyValue replaces", UAGLKeyValueLibrary::GetKeyValueCount(Mutable), 1);
+    TestEqual("SetKeyValue final value", UAGLKeyValueLibrary::GetKeyValue(Mutable, TEXT("difficulty")), FString(TEXT("easy")));
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLKeyValueStoreReflectionTest, "AGL.KeyValueStore.Reflection",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLKeyValueStoreReflectionTest::RunTest(const FString& Parameters)
+{
+    FAGLKeyValueStore Source;
+    Source.Add(TEXT("boss"), TEXT("dragon"));
+    Source.Add(TEXT("attempts"), TEXT("3"));
+
+    // Blueprint pin copies and dynamic delegate parameters go through
+    // CopyScriptStruct; without the struct ops traits this path would
+    // default-construct the store and drop the entries
+    FAGLKeyValueStore Copied;
+    FAGLKeyValueStore::StaticStruct()->CopyScriptStruct(&Copied, &Source);
+
+    TestEqual("Reflection copy keeps the entry count", Copied.Num(), 2);
+    TestEqual("Reflection copy keeps values", Copied.FindRef(TEXT("boss")), FString(TEXT("dragon")));
+    TestTrue("Copied store compares equal", Copied == Source);
+    TestTrue("Identical agrees with equality", Source.Identical(&Copied, 0));
+
+    Copied.Add(TEXT("attempts"), TEXT("4"));
+    TestFalse("Changed value breaks equality", Copied == Source);
+    TestFalse("Identical sees the change", Source.Identical(&Copied, 0));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
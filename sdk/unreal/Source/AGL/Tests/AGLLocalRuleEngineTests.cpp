@@ -0,0 +1,124 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLLocalRuleEngine.h"
+#include "AGLEmotionService.h"
+#include "AGLTypes.h"
+#include "Misc/AutomationTest.h"
+
+// Unreal Automation Framework
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLLocalRuleEngineClassificationTest, "AGL.LocalRules.Classification",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLLocalRuleEngineClassificationTest::RunTest(const FString& Parameters)
+{
+    // Plain victory
+    {
+        FAGLEmotionRequest Request = UAGLEmotionService::CreateVictoryRequest(false, 0);
+        FAGLEmotionResponse Response = FAGLLocalRuleEngine::Classify(Request);
+
+        TestEqual("Victory emotion", Response.Emotion, EAGLEmotionType::Happy);
+        TestEqual("Victory method", Response.Method, TEXT("rule"));
+        TestEqual("Victory cost", Response.Cost, 0.0f);
+        TestTrue("Victory confidence above threshold", Response.Confidence >= 0.85f);
+    }
+
+    // MVP victory beats the plain victory fallback
+    {
+        FAGLEmotionRequest Request = UAGLEmotionService::CreateVictoryRequest(true, 0);
+        FAGLEmotionResponse Response = FAGLLocalRuleEngine::Classify(Request);
+
+        TestEqual("MVP emotion", Response.Emotion, EAGLEmotionType::Proud);
+    }
+
+    // Long win streak beats MVP ordering
+    {
+        FAGLEmotionRequest Request = UAGLEmotionService::CreateVictoryRequest(false, 5);
+        FAGLEmotionResponse Response = FAGLLocalRuleEngine::Classify(Request);
+
+        TestEqual("Win streak emotion", Response.Emotion, EAGLEmotionType::Amazed);
+        TestTrue("Win streak intensity maxed", Response.Intensity >= 1.0f);
+    }
+
+    // Loss streak escalation
+    {
+        FAGLEmotionRequest Request = UAGLEmotionService::CreateDefeatRequest(5);
+        FAGLEmotionResponse Response = FAGLLocalRuleEngine::Classify(Request);
+
+        TestEqual("Loss streak emotion", Response.Emotion, EAGLEmotionType::Frustrated);
+    }
+
+    // Plain defeat
+    {
+        FAGLEmotionRequest Request = UAGLEmotionService::CreateDefeatRequest(0);
+        FAGLEmotionResponse Response = FAGLLocalRuleEngine::Classify(Request);
+
+        TestEqual("Defeat emotion", Response.Emotion, EAGLEmotionType::Disappointed);
+    }
+
+    // Legendary kill beats kill-count rules
+    {
+        FAGLEmotionRequest Request = UAGLEmotionService::CreateKillRequest(2, true);
+        FAGLEmotionResponse Response = FAGLLocalRuleEngine::Classify(Request);
+
+        TestEqual("Legendary kill emotion", Response.Emotion, EAGLEmotionType::Amazed);
+    }
+
+    // Legendary achievement rarity
+    {
+        FAGLEmotionRequest Request = UAGLEmotionService::CreateAchievementRequest(TEXT("legendary"));
+        FAGLEmotionResponse Response = FAGLLocalRuleEngine::Classify(Request);
+
+        TestEqual("Legendary achievement emotion", Response.Emotion, EAGLEmotionType::Amazed);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLLocalRuleEngineFallbackTest, "AGL.LocalRules.Fallback",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLLocalRuleEngineFallbackTest::RunTest(const FString& Parameters)
+{
+    // Unmatched data still resolves via the event-type fallback rule
+    {
+        FAGLEmotionRequest Request;
+        Request.EventType = EAGLEventType::Loot;
+        Request.Data.Add(TEXT("rarity"), TEXT("common"));
+
+        FAGLEmotionResponse Response = FAGLLocalRuleEngine::Classify(Request);
+
+        TestEqual("Common loot emotion", Response.Emotion, EAGLEmotionType::Satisfied);
+        TestTrue("Fallback confidence above threshold", Response.Confidence >= 0.85f);
+    }
+
+    // Rule table covers every event type with a fallback
+    {
+        const EAGLEventType AllEventTypes[] =
+        {
+            EAGLEventType::Victory, EAGLEventType::Defeat, EAGLEventType::Kill,
+            EAGLEventType::Death, EAGLEventType::Achievement, EAGLEventType::LevelUp,
+            EAGLEventType::Loot, EAGLEventType::SessionStart, EAGLEventType::SessionEnd
+        };
+
+        for (EAGLEventType EventType : AllEventTypes)
+        {
+            FAGLEmotionRequest Request;
+            Request.EventType = EventType;
+
+            FAGLEmotionResponse Response = FAGLLocalRuleEngine::Classify(Request);
+
+            TestNotEqual("Event type has a matching rule", Response.Reasoning, FString(TEXT("No matching rule")));
+        }
+    }
+
+    // Table is populated
+    {
+        TestTrue("Rule table has entries", FAGLLocalRuleEngine::GetRuleCount() > 0);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
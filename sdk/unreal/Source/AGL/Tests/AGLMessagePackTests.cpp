@@ -0,0 +1,320 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLMessagePack.h"
+#include "Misc/AutomationTest.h"
+
+// Unreal Automation Framework
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLMessagePackPrimitivesTest, "AGL.MessagePack.Primitives",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLMessagePackPrimitivesTest::RunTest(const FString& Parameters)
+{
+    // Scalars round trip through the writer and reader
+    {
+        TArray<uint8> Buffer;
+        FAGLMessagePackWriter Writer(Buffer);
+        Writer.WriteMapHeader(4);
+        Writer.WriteString(TEXT("str"));
+        Writer.WriteString(TEXT("击败了传奇BOSS"));
+        Writer.WriteString(TEXT("int"));
+        Writer.WriteInt(-1234);
+        Writer.WriteString(TEXT("float"));
+        Writer.WriteFloat(0.85f);
+        Writer.WriteString(TEXT("bool"));
+        Writer.WriteBool(true);
+
+        FAGLMessagePackReader Reader(Buffer);
+        int32 Count;
+        TestTrue("Map header read", Reader.ReadMapHeader(Count));
+        TestEqual("Map entry count", Count, 4);
+
+        FString Key;
+        FString StringValue;
+        TestTrue("Key read", Reader.ReadString(Key));
+        TestTrue("String read", Reader.ReadString(StringValue));
+        TestEqual("Unicode string round trips", StringValue, TEXT("击败了传奇BOSS"));
+
+        int32 IntValue;
+        TestTrue("Key read", Reader.ReadString(Key));
+        TestTrue("Int read", Reader.ReadInt(IntValue));
+        TestEqual("Negative int round trips", IntValue, -1234);
+
+        float FloatValue;
+        TestTrue("Key read", Reader.ReadString(Key));
+        TestTrue("Float read", Reader.ReadFloat(FloatValue));
+        TestEqual("Float round trips", FloatValue, 0.85f);
+
+        bool bBoolValue;
+        TestTrue("Key read", Reader.ReadString(Key));
+        TestTrue("Bool read", Reader.ReadBool(bBoolValue));
+        TestTrue("Bool round trips", bBoolValue);
+
+        TestTrue("Buffer fully consumed", Reader.IsAtEnd());
+    }
+
+    // Small positive ints use the single-byte fixint encoding
+    {
+        TArray<uint8> Buffer;
+        FAGLMessagePackWriter Writer(Buffer);
+        Writer.WriteInt(10);
+        TestEqual("Fixint is one byte", Buffer.Num(), 1);
+    }
+
+    // Strings over the fixstr limit take the str8 path
+    {
+        TArray<uint8> Buffer;
+        FAGLMessagePackWriter Writer(Buffer);
+        const FString LongString = FString::ChrN(100, TEXT('a'));
+        Writer.WriteString(LongString);
+
+        FAGLMessagePackReader Reader(Buffer);
+        FString Value;
+        TestTrue("Long string read", Reader.ReadString(Value));
+        TestEqual("Long string round trips", Value, LongString);
+    }
+
+    // SkipValue steps over unknown values of any type
+    {
+        TArray<uint8> Buffer;
+        FAGLMessagePackWriter Writer(Buffer);
+        Writer.WriteMapHeader(2);
+        Writer.WriteString(TEXT("unknown"));
+        Writer.WriteMapHeader(1);
+        Writer.WriteString(TEXT("nested"));
+        Writer.WriteInt(42);
+        Writer.WriteString(TEXT("known"));
+        Writer.WriteBool(true);
+
+        FAGLMessagePackReader Reader(Buffer);
+        int32 Count;
+        FString Key;
+        bool bValue = false;
+        TestTrue("Map header read", Reader.ReadMapHeader(Count));
+        TestTrue("Key read", Reader.ReadString(Key));
+        TestTrue("Nested map skipped", Reader.SkipValue());
+        TestTrue("Key after skip read", Reader.ReadString(Key));
+        TestEqual("Key after skip", Key, TEXT("known"));
+        TestTrue("Value after skip read", Reader.ReadBool(bValue));
+        TestTrue("Value after skip", bValue);
+    }
+
+    // Truncated input fails instead of reading out of bounds
+    {
+        TArray<uint8> Buffer;
+        FAGLMessagePackWriter Writer(Buffer);
+        Writer.WriteString(TEXT("truncate me"));
+        Buffer.SetNum(Buffer.Num() - 4, /*bAllowShrinking*/ false);
+
+        FAGLMessagePackReader Reader(Buffer);
+        FString Value;
+        TestFalse("Truncated string rejected", Reader.ReadString(Value));
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLMessagePackStructRoundTripTest, "AGL.MessagePack.StructRoundTrip",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLMessagePackStructRoundTripTest::RunTest(const FString& Parameters)
+{
+    // Emotion request
+    {
+        FAGLEmotionRequest Request;
+        Request.EventType = EAGLEventType::Victory;
+        Request.bForceML = true;
+        Request.Data.Add(TEXT("mvp"), TEXT("true"));
+        Request.Data.Add(TEXT("winStreak"), TEXT("5"));
+        Request.Context.Add(TEXT("map"), TEXT("summoners_rift"));
+
+        TArray<uint8> Bytes;
+        FAGLMessagePack::EncodeEmotionRequest(Request, Bytes);
+
+        FAGLEmotionRequest Decoded;
+        TestTrue("Emotion request decoded", FAGLMessagePack::DecodeEmotionRequest(Bytes, Decoded));
+        TestEqual("Event type", Decoded.EventType, EAGLEventType::Victory);
+        TestTrue("Force ML", Decoded.bForceML);
+        TestEqual("Data entries", Decoded.Data.Num(), 2);
+        TestEqual("Data value", Decoded.Data.FindRef(TEXT("winStreak")), TEXT("5"));
+        TestEqual("Context value", Decoded.Context.FindRef(TEXT("map")), TEXT("summoners_rift"));
+    }
+
+    // Emotion response
+    {
+        FAGLEmotionResponse Response;
+        Response.Emotion = EAGLEmotionType::Excited;
+        Response.Intensity = 0.9f;
+        Response.Confidence = 0.95f;
+        Response.Action = TEXT("celebrate");
+        Response.Reasoning = TEXT("win_streak");
+        Response.Method = TEXT("rule");
+        Response.Cost = 0.0f;
+        Response.bCacheHit = true;
+        Response.LatencyMs = 12;
+
+        TArray<uint8> Bytes;
+        FAGLMessagePack::EncodeEmotionResponse(Response, Bytes);
+
+        FAGLEmotionResponse Decoded;
+        TestTrue("Emotion response decoded", FAGLMessagePack::DecodeEmotionResponse(Bytes, Decoded));
+        TestEqual("Emotion", Decoded.Emotion, EAGLEmotionType::Excited);
+        TestEqual("Intensity", Decoded.Intensity, 0.9f);
+        TestEqual("Action", Decoded.Action, TEXT("celebrate"));
+        TestTrue("Cache hit", Decoded.bCacheHit);
+        TestEqual("Latency", Decoded.LatencyMs, 12);
+    }
+
+    // Dialogue request and response
+    {
+        FAGLDialogueRequest Request;
+        Request.EventType = EAGLEventType::Achievement;
+        Request.Emotion = EAGLEmotionType::Proud;
+        Request.Persona = EAGLPersona::Cute;
+        Request.PlayerId = TEXT("player-123");
+        Request.Language = TEXT("zh");
+        Request.Context.Add(TEXT("rarity"), TEXT("legendary"));
+
+        TArray<uint8> RequestBytes;
+        FAGLMessagePack::EncodeDialogueRequest(Request, RequestBytes);
+
+        FAGLDialogueRequest DecodedRequest;
+        TestTrue("Dialogue request decoded", FAGLMessagePack::DecodeDialogueRequest(RequestBytes, DecodedRequest));
+        TestEqual("Persona", DecodedRequest.Persona, EAGLPersona::Cute);
+        TestEqual("Player id", DecodedRequest.PlayerId, TEXT("player-123"));
+        TestEqual("Language", DecodedRequest.Language, TEXT("zh"));
+
+        FAGLDialogueResponse Response;
+        Response.Dialogue = TEXT("太棒了！传奇成就！");
+        Response.Method = TEXT("llm");
+        Response.Cost = 0.0008f;
+        Response.bUsedSpecialCase = true;
+        Response.SpecialCaseReasons.Add(TEXT("legendary_rarity"));
+        Response.SpecialCaseReasons.Add(TEXT("first_time"));
+        Response.MemoryCount = 3;
+        Response.LatencyMs = 420;
+
+        TArray<uint8> ResponseBytes;
+        FAGLMessagePack::EncodeDialogueResponse(Response, ResponseBytes);
+
+        FAGLDialogueResponse DecodedResponse;
+        TestTrue("Dialogue response decoded", FAGLMessagePack::DecodeDialogueResponse(ResponseBytes, DecodedResponse));
+        TestEqual("Dialogue text", DecodedResponse.Dialogue, TEXT("太棒了！传奇成就！"));
+        TestEqual("Reason count", DecodedResponse.SpecialCaseReasons.Num(), 2);
+        TestEqual("Second reason", DecodedResponse.SpecialCaseReasons[1], TEXT("first_time"));
+        TestEqual("Memory count", DecodedResponse.MemoryCount, 3);
+    }
+
+    // Memory create request and full memory
+    {
+        FAGLCreateMemoryRequest Request;
+        Request.Type = EAGLMemoryType::Milestone;
+        Request.Content = TEXT("Reached level 50");
+        Request.Emotion = TEXT("proud");
+        Request.Importance = 8;
+        Request.Context.Add(TEXT("level"), TEXT("50"));
+
+        TArray<uint8> RequestBytes;
+        FAGLMessagePack::EncodeCreateMemoryRequest(Request, RequestBytes);
+
+        FAGLCreateMemoryRequest DecodedRequest;
+        TestTrue("Create request decoded", FAGLMessagePack::DecodeCreateMemoryRequest(RequestBytes, DecodedRequest));
+        TestEqual("Memory type", DecodedRequest.Type, EAGLMemoryType::Milestone);
+        TestEqual("Importance", DecodedRequest.Importance, 8);
+
+        FAGLMemory Memory;
+        Memory.Id = TEXT("mem-001");
+        Memory.PlayerId = TEXT("player-123");
+        Memory.Type = EAGLMemoryType::Achievement;
+        Memory.Content = TEXT("Won first match");
+        Memory.Emotion = TEXT("excited");
+        Memory.Importance = 9;
+        Memory.CreatedAt = TEXT("2025-01-01T00:00:00Z");
+
+        TArray<uint8> MemoryBytes;
+        FAGLMessagePack::EncodeMemory(Memory, MemoryBytes);
+
+        FAGLMemory DecodedMemory;
+        TestTrue("Memory decoded", FAGLMessagePack::DecodeMemory(MemoryBytes, DecodedMemory));
+        TestEqual("Memory id", DecodedMemory.Id, TEXT("mem-001"));
+        TestEqual("Memory content", DecodedMemory.Content, TEXT("Won first match"));
+        TestEqual("Created at", DecodedMemory.CreatedAt, TEXT("2025-01-01T00:00:00Z"));
+    }
+
+    // Search results response with nested memories
+    {
+        FAGLMemorySearchResult Result;
+        Result.Memory.Id = TEXT("mem-002");
+        Result.Memory.Content = TEXT("Defeated the boss");
+        Result.SimilarityScore = 0.92f;
+
+        TArray<uint8> Bytes;
+        FAGLMessagePackWriter Writer(Bytes);
+        Writer.WriteMapHeader(1);
+        Writer.WriteString(TEXT("results"));
+        Writer.WriteArrayHeader(1);
+
+        TArray<uint8> ResultBytes;
+        FAGLMessagePack::EncodeMemorySearchResult(Result, ResultBytes);
+        Bytes.Append(ResultBytes);
+
+        TArray<FAGLMemorySearchResult> DecodedResults;
+        TestTrue("Search response decoded", FAGLMessagePack::DecodeSearchResultsResponse(Bytes, DecodedResults));
+        TestEqual("Result count", DecodedResults.Num(), 1);
+        if (DecodedResults.Num() == 1)
+        {
+            TestEqual("Nested memory id", DecodedResults[0].Memory.Id, TEXT("mem-002"));
+            TestEqual("Similarity score", DecodedResults[0].SimilarityScore, 0.92f);
+        }
+    }
+
+    // Decoders tolerate unknown fields added by newer backends
+    {
+        TArray<uint8> Bytes;
+        FAGLMessagePackWriter Writer(Bytes);
+        Writer.WriteMapHeader(2);
+        Writer.WriteString(TEXT("new_field"));
+        Writer.WriteString(TEXT("future"));
+        Writer.WriteString(TEXT("emotion"));
+        Writer.WriteString(TEXT("happy"));
+
+        FAGLEmotionResponse Decoded;
+        TestTrue("Unknown field skipped", FAGLMessagePack::DecodeEmotionResponse(Bytes, Decoded));
+        TestEqual("Known field still read", Decoded.Emotion, EAGLEmotionType::Happy);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLMessagePackLongStringTest, "AGL.MessagePack.LongString",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLMessagePackLongStringTest::RunTest(const FString& Parameters)
+{
+    // Memory content is arbitrary integrator text; past 65535 UTF-8
+    // bytes the writer must switch from str16 to str32 or the length
+    // header wraps and corrupts the stream
+    FString LongValue;
+    LongValue.Reserve(70000);
+    for (int32 Index = 0; Index < 70000; ++Index)
+    {
+        LongValue.AppendChar(TEXT('a') + (Index % 26));
+    }
+
+    TArray<uint8> Buffer;
+    FAGLMessagePackWriter Writer(Buffer);
+    Writer.WriteString(LongValue);
+
+    TestEqual("str32 marker emitted", Buffer[0], (uint8)0xdb);
+
+    FAGLMessagePackReader Reader(Buffer);
+    FString Decoded;
+    TestTrue("Long string read", Reader.ReadString(Decoded));
+    TestEqual("Long string length survives", Decoded.Len(), LongValue.Len());
+    TestTrue("Long string content survives", Decoded.Equals(LongValue, ESearchCase::CaseSensitive));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,83 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLMetrics.h"
+#include "Misc/AutomationTest.h"
+
+// Unreal Automation Framework
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLMetricsAggregationTest, "AGL.Metrics.Aggregation",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLMetricsAggregationTest::RunTest(const FString& Parameters)
+{
+    FAGLMetrics& Metrics = FAGLMetrics::Get();
+    Metrics.Reset();
+
+    const int32 Latencies[] = { 10, 20, 30, 40 };
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        FAGLMetricRecord Entry;
+        Entry.Method = FName(TEXT("llm"));
+        Entry.LatencyMs = Latencies[Index];
+        Entry.PayloadBytes = 100;
+        Entry.Cost = 0.001f;
+        Entry.bCacheHit = (Index == 0);
+        Metrics.Record(EAGLMetricService::Emotion, Entry);
+    }
+    Metrics.RecordFailure(EAGLMetricService::Emotion);
+
+    const FAGLMetricsSnapshot Snapshot = Metrics.GetSnapshot(EAGLMetricService::Emotion);
+    TestEqual("Total requests", Snapshot.TotalRequests, 4);
+    TestEqual("Total failures", Snapshot.TotalFailures, 1);
+    TestEqual("Sample count", Snapshot.SampleCount, 4);
+    TestEqual("Average latency", Snapshot.AverageLatencyMs, 25);
+    TestEqual("P50 latency", Snapshot.P50LatencyMs, 20);
+    TestEqual("P95 latency", Snapshot.P95LatencyMs, 30);
+    TestEqual("Average payload", Snapshot.AveragePayloadBytes, 100);
+    TestEqual("Cache hit rate", Snapshot.CacheHitRate, 0.25f, 0.001f);
+    TestEqual("Total cost", Snapshot.TotalCost, 0.004f, 0.0001f);
+
+    // Services aggregate independently
+    const FAGLMetricsSnapshot DialogueSnapshot = Metrics.GetSnapshot(EAGLMetricService::Dialogue);
+    TestEqual("Other service untouched", DialogueSnapshot.TotalRequests, 0);
+    TestEqual("Other service empty window", DialogueSnapshot.SampleCount, 0);
+
+    Metrics.Reset();
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLMetricsWindowTest, "AGL.Metrics.Window",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLMetricsWindowTest::RunTest(const FString& Parameters)
+{
+    FAGLMetrics& Metrics = FAGLMetrics::Get();
+    Metrics.Reset();
+
+    // Overfill the ring: lifetime counters keep counting while the
+    // percentile window stays capped at the ring capacity
+    const int32 Recorded = FAGLMetrics::RingCapacity + 50;
+    for (int32 Index = 0; Index < Recorded; ++Index)
+    {
+        FAGLMetricRecord Entry;
+        Entry.Method = FName(TEXT("template"));
+        Entry.LatencyMs = 5;
+        Metrics.Record(EAGLMetricService::Dialogue, Entry);
+    }
+
+    const FAGLMetricsSnapshot Snapshot = Metrics.GetSnapshot(EAGLMetricService::Dialogue);
+    TestEqual("Lifetime count exceeds window", Snapshot.TotalRequests, Recorded);
+    TestEqual("Window capped at ring capacity", Snapshot.SampleCount, FAGLMetrics::RingCapacity);
+    TestEqual("Windowed latency", Snapshot.P99LatencyMs, 5);
+
+    // Reset gates readers off the retained records
+    Metrics.Reset();
+    const FAGLMetricsSnapshot AfterReset = Metrics.GetSnapshot(EAGLMetricService::Dialogue);
+    TestEqual("Reset clears lifetime count", AfterReset.TotalRequests, 0);
+    TestEqual("Reset clears window", AfterReset.SampleCount, 0);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,68 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLOfflineJournal.h"
+#include "AGLTypes.h"
+#include "HAL/FileManager.h"
+#include "Misc/AutomationTest.h"
+
+// Unreal Automation Framework
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    FAGLEmotionRequest MakeEmotionRequest(EAGLEventType EventType, const FString& Detail)
+    {
+        FAGLEmotionRequest Request;
+        Request.EventType = EventType;
+        Request.Data.Add(TEXT("detail"), Detail);
+        return Request;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLOfflineJournalBoundsTest, "AGL.OfflineJournal.Bounds",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLOfflineJournalBoundsTest::RunTest(const FString& Parameters)
+{
+    // Start from a clean journal file so persisted records from earlier
+    // runs do not leak into the counters
+    IFileManager::Get().Delete(*UAGLOfflineJournal::GetJournalFilePath(), /*RequireExists*/ false);
+
+    UAGLOfflineJournal* Journal = NewObject<UAGLOfflineJournal>();
+
+    // Identical payloads coalesce into one record
+    {
+        FAGLEmotionRequest Request = MakeEmotionRequest(EAGLEventType::Victory, TEXT("first-win-of-the-season"));
+        Journal->RecordEmotionRequest(Request);
+        Journal->RecordEmotionRequest(Request);
+        TestEqual("Duplicate payload coalesced", Journal->GetRecordCount(), 1);
+
+        Journal->RecordEmotionRequest(MakeEmotionRequest(EAGLEventType::Defeat, TEXT("close-loss")));
+        TestEqual("Distinct payload appended", Journal->GetRecordCount(), 2);
+        TestTrue("Byte counter tracks payloads", Journal->GetJournalBytes() > 0);
+    }
+
+    // Oldest records evict when the byte budget is exceeded; the new
+    // record is smaller than the oldest, so one eviction makes room
+    {
+        Journal->MaxBytes = Journal->GetJournalBytes();
+
+        Journal->RecordEmotionRequest(MakeEmotionRequest(EAGLEventType::Achievement, TEXT("gg")));
+        TestTrue("Eviction keeps journal inside budget", Journal->GetJournalBytes() <= Journal->MaxBytes);
+        TestEqual("Oldest record evicted, newest kept", Journal->GetRecordCount(), 2);
+    }
+
+    // Journal persists across instances
+    {
+        UAGLOfflineJournal* Reloaded = NewObject<UAGLOfflineJournal>();
+        Reloaded->LoadFromDisk();
+        TestEqual("Records reload from disk", Reloaded->GetRecordCount(), Journal->GetRecordCount());
+        TestEqual("Byte counter reloads from disk", Reloaded->GetJournalBytes(), Journal->GetJournalBytes());
+    }
+
+    IFileManager::Get().Delete(*UAGLOfflineJournal::GetJournalFilePath(), /*RequireExists*/ false);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,68 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLRequestContext.h"
+#include "AGLTypes.h"
+#include "Misc/AutomationTest.h"
+
+// Unreal Automation Framework
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLRequestContextPoolTest, "AGL.RequestContext.Pool",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLRequestContextPoolTest::RunTest(const FString& Parameters)
+{
+    FAGLRequestContextPool Pool;
+
+    // Released contexts are reused instead of allocating new ones
+    {
+        FAGLRequestContext& First = Pool.Acquire();
+        const int32 FirstIndex = First.PoolIndex;
+        TestEqual("First acquire allocates", Pool.GetAllocatedCount(), 1);
+        TestEqual("First acquire checked out", Pool.GetInUseCount(), 1);
+
+        Pool.Release(First);
+        TestEqual("Release returns context", Pool.GetInUseCount(), 0);
+
+        FAGLRequestContext& Second = Pool.Acquire();
+        TestEqual("Released context reused", Second.PoolIndex, FirstIndex);
+        TestEqual("Reuse does not allocate", Pool.GetAllocatedCount(), 1);
+        Pool.Release(Second);
+    }
+
+    // Concurrent checkouts grow the pool; indices stay stable
+    {
+        FAGLRequestContext& A = Pool.Acquire();
+        FAGLRequestContext& B = Pool.Acquire();
+        TestEqual("Concurrent checkouts allocate", Pool.GetAllocatedCount(), 2);
+        TestNotEqual("Checked-out contexts are distinct", A.PoolIndex, B.PoolIndex);
+        TestTrue("Get resolves by index", &Pool.Get(B.PoolIndex) == &B);
+        Pool.Release(A);
+        Pool.Release(B);
+    }
+
+    // Reset clears per-request state but keeps payload buffer capacity
+    {
+        FAGLRequestContext& Context = Pool.Acquire();
+        Context.BinaryPayload.Append({ 1, 2, 3, 4 });
+        Context.StringPayload = TEXT("{\"event\":\"player.victory\"}");
+        Context.SchedulerKey = 42;
+        Context.PlayerId = TEXT("player-1");
+        const int32 BufferCapacity = Context.BinaryPayload.Max();
+
+        Pool.Release(Context);
+
+        FAGLRequestContext& Reused = Pool.Acquire();
+        TestEqual("Payload cleared on release", Reused.BinaryPayload.Num(), 0);
+        TestEqual("Buffer capacity retained", Reused.BinaryPayload.Max(), BufferCapacity);
+        TestEqual("String payload cleared", Reused.StringPayload.Len(), 0);
+        TestEqual("Scheduler key cleared", Reused.SchedulerKey, 0u);
+        TestEqual("Player cleared", Reused.PlayerId.Len(), 0);
+        TestFalse("Callback slot unbound", Reused.OnEmotion.IsBound());
+        Pool.Release(Reused);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,89 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLRequestScheduler.h"
+#include "Misc/AutomationTest.h"
+
+// Unreal Automation Framework
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLRequestSchedulerDedupTest, "AGL.RequestScheduler.Dedup",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLRequestSchedulerDedupTest::RunTest(const FString& Parameters)
+{
+    UAGLRequestScheduler* Scheduler = NewObject<UAGLRequestScheduler>();
+    Scheduler->Initialize(4);
+
+    // Identical payloads produce identical keys; services differ
+    const uint32 KeyA = UAGLRequestScheduler::MakeKey(TEXT("emotion"), TEXT("{\"type\":\"player.victory\"}"));
+    const uint32 KeyB = UAGLRequestScheduler::MakeKey(TEXT("emotion"), TEXT("{\"type\":\"player.victory\"}"));
+    const uint32 KeyC = UAGLRequestScheduler::MakeKey(TEXT("dialogue"), TEXT("{\"type\":\"player.victory\"}"));
+    TestEqual("Identical payloads share a key", KeyA, KeyB);
+    TestNotEqual("Service tag separates keys", KeyA, KeyC);
+
+    // First caller leads, duplicates join, completion clears the entry
+    FOnEmotionAnalysisComplete Unbound;
+    TestFalse("First caller is the leader", Scheduler->JoinOrBeginEmotion(KeyA, Unbound));
+    TestTrue("Second caller joins", Scheduler->JoinOrBeginEmotion(KeyA, Unbound));
+    TestTrue("Third caller joins", Scheduler->JoinOrBeginEmotion(KeyA, Unbound));
+    TestEqual("Two requests coalesced", Scheduler->GetCoalescedRequestCount(), 2);
+    TestEqual("One request in flight", Scheduler->GetActiveRequestCount(), 1);
+
+    FAGLEmotionResponse Response;
+    Scheduler->CompleteEmotion(KeyA, true, Response);
+    TestEqual("Slot released on completion", Scheduler->GetActiveRequestCount(), 0);
+    TestFalse("Key reusable after completion", Scheduler->JoinOrBeginEmotion(KeyA, Unbound));
+    Scheduler->CompleteEmotion(KeyA, false, Response);
+
+    // Different payloads do not coalesce
+    const uint32 OtherKey = UAGLRequestScheduler::MakeKey(TEXT("emotion"), TEXT("{\"type\":\"player.defeat\"}"));
+    TestFalse("Different payload leads independently", Scheduler->JoinOrBeginEmotion(OtherKey, Unbound));
+    Scheduler->CompleteEmotion(OtherKey, true, Response);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLRequestSchedulerPriorityTest, "AGL.RequestScheduler.Priority",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLRequestSchedulerPriorityTest::RunTest(const FString& Parameters)
+{
+    UAGLRequestScheduler* Scheduler = NewObject<UAGLRequestScheduler>();
+    Scheduler->Initialize(2);
+
+    // Fill the budget with foreground requests
+    FOnEmotionAnalysisComplete Unbound;
+    const uint32 Key1 = UAGLRequestScheduler::MakeKey(TEXT("emotion"), TEXT("a"));
+    const uint32 Key2 = UAGLRequestScheduler::MakeKey(TEXT("emotion"), TEXT("b"));
+    Scheduler->JoinOrBeginEmotion(Key1, Unbound);
+    Scheduler->JoinOrBeginEmotion(Key2, Unbound);
+    TestEqual("Budget filled", Scheduler->GetActiveRequestCount(), 2);
+
+    // Background sends queue while the budget is spent
+    int32 SendCount = 0;
+    Scheduler->SubmitBackground([&SendCount]() { SendCount++; });
+    Scheduler->SubmitBackground([&SendCount]() { SendCount++; });
+    TestEqual("Background sends deferred", SendCount, 0);
+    TestEqual("Background sends queued", Scheduler->GetQueuedBackgroundCount(), 2);
+
+    // Each completed foreground request drains one queued send in order
+    FAGLEmotionResponse Response;
+    Scheduler->CompleteEmotion(Key1, true, Response);
+    TestEqual("One queued send drained", SendCount, 1);
+    TestEqual("One send still queued", Scheduler->GetQueuedBackgroundCount(), 1);
+
+    Scheduler->CompleteEmotion(Key2, true, Response);
+    TestEqual("Second queued send drained", SendCount, 2);
+    TestEqual("Queue empty", Scheduler->GetQueuedBackgroundCount(), 0);
+    TestEqual("Drained sends hold slots", Scheduler->GetActiveRequestCount(), 2);
+
+    // Under budget, background sends run immediately
+    Scheduler->NotifyRequestFinished();
+    Scheduler->NotifyRequestFinished();
+    Scheduler->SubmitBackground([&SendCount]() { SendCount++; });
+    TestEqual("Immediate send under budget", SendCount, 3);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
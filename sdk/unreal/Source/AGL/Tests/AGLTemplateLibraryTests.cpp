@@ -0,0 +1,76 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLTemplateLibrary.h"
+#include "AGLTypes.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/Paths.h"
+#include "HAL/PlatformFileManager.h"
+
+// Unreal Automation Framework
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLTemplateLibraryRoundTripTest, "AGL.TemplateLibrary.RoundTrip",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLTemplateLibraryRoundTripTest::RunTest(const FString& Parameters)
+{
+    const FString PackPath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Tests"), TEXT("AGLTemplateLibraryTest.aglt"));
+
+    // Cook a small pack covering multiple dimensions and languages
+    TArray<FAGLTemplateLibrary::FTemplateEntry> Entries;
+    Entries.Add({ EAGLPersona::Cheerful, EAGLEmotionType::Happy, EAGLEventType::Victory, TEXT("en"), TEXT("We won! Amazing!") });
+    Entries.Add({ EAGLPersona::Cheerful, EAGLEmotionType::Happy, EAGLEventType::Victory, TEXT("zh"), TEXT("我们赢了！太棒了！") });
+    Entries.Add({ EAGLPersona::Cool, EAGLEmotionType::Sad, EAGLEventType::Defeat, TEXT("en"), TEXT("Next time.") });
+
+    TestTrue("Pack cooked", FAGLTemplateLibrary::CookPack(Entries, PackPath));
+
+    FAGLTemplateLibrary Library;
+    TestTrue("Pack loaded", Library.LoadPack(PackPath));
+    TestEqual("Template count", Library.GetTemplateCount(), 3);
+
+    // Exact lookups
+    {
+        FString Dialogue;
+        TestTrue("English victory found", Library.TryGetTemplate(EAGLPersona::Cheerful, EAGLEmotionType::Happy, EAGLEventType::Victory, TEXT("en"), Dialogue));
+        TestEqual("English victory text", Dialogue, TEXT("We won! Amazing!"));
+    }
+
+    // Unicode round trip
+    {
+        FString Dialogue;
+        TestTrue("Chinese victory found", Library.TryGetTemplate(EAGLPersona::Cheerful, EAGLEmotionType::Happy, EAGLEventType::Victory, TEXT("zh"), Dialogue));
+        TestEqual("Chinese victory text", Dialogue, TEXT("我们赢了！太棒了！"));
+    }
+
+    // Misses escalate rather than returning wrong text
+    {
+        FString Dialogue;
+        TestFalse("Unmatched persona misses", Library.TryGetTemplate(EAGLPersona::Cute, EAGLEmotionType::Happy, EAGLEventType::Victory, TEXT("en"), Dialogue));
+        TestFalse("Unsupported language misses", Library.TryGetTemplate(EAGLPersona::Cheerful, EAGLEmotionType::Happy, EAGLEventType::Victory, TEXT("fr"), Dialogue));
+    }
+
+    Library.Unload();
+    FPlatformFileManager::Get().GetPlatformFile().DeleteFile(*PackPath);
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLTemplateLibraryInvalidPackTest, "AGL.TemplateLibrary.InvalidPack",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLTemplateLibraryInvalidPackTest::RunTest(const FString& Parameters)
+{
+    FAGLTemplateLibrary Library;
+
+    // Missing file
+    TestFalse("Missing pack rejected", Library.LoadPack(TEXT("/nonexistent/path/templates.aglt")));
+    TestFalse("Library not loaded", Library.IsLoaded());
+
+    // Lookups against an unloaded library fail cleanly
+    FString Dialogue;
+    TestFalse("Lookup on unloaded library fails", Library.TryGetTemplate(EAGLPersona::Cheerful, EAGLEmotionType::Happy, EAGLEventType::Victory, TEXT("en"), Dialogue));
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,61 @@
+// Copyright AGL Team. All Rights Reserved.
+
+#include "AGLWireNames.h"
+#include "Misc/AutomationTest.h"
+
+// Unreal Automation Framework
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLWireNamesRoundTripTest, "AGL.WireNames.RoundTrip",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLWireNamesRoundTripTest::RunTest(const FString& Parameters)
+{
+    // Every enum value must survive a trip through its wire spelling;
+    // a table gap or misordering breaks this immediately
+
+    for (uint8 Value = 0; Value <= static_cast<uint8>(EAGLEventType::SessionEnd); ++Value)
+    {
+        const EAGLEventType EventType = static_cast<EAGLEventType>(Value);
+        TestEqual("Event type round trips", FAGLWireNames::StringToEventType(FAGLWireNames::EventTypeToString(EventType)), EventType);
+    }
+
+    for (uint8 Value = 0; Value <= static_cast<uint8>(EAGLEmotionType::Neutral); ++Value)
+    {
+        const EAGLEmotionType EmotionType = static_cast<EAGLEmotionType>(Value);
+        TestEqual("Emotion type round trips", FAGLWireNames::StringToEmotionType(FAGLWireNames::EmotionTypeToString(EmotionType)), EmotionType);
+    }
+
+    for (uint8 Value = 0; Value <= static_cast<uint8>(EAGLPersona::Cute); ++Value)
+    {
+        const EAGLPersona Persona = static_cast<EAGLPersona>(Value);
+        TestEqual("Persona round trips", FAGLWireNames::StringToPersona(FAGLWireNames::PersonaToString(Persona)), Persona);
+    }
+
+    for (uint8 Value = 0; Value <= static_cast<uint8>(EAGLMemoryType::Observation); ++Value)
+    {
+        const EAGLMemoryType MemoryType = static_cast<EAGLMemoryType>(Value);
+        TestEqual("Memory type round trips", FAGLWireNames::StringToMemoryType(FAGLWireNames::MemoryTypeToString(MemoryType)), MemoryType);
+    }
+
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAGLWireNamesFallbackTest, "AGL.WireNames.Fallbacks",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+bool FAGLWireNamesFallbackTest::RunTest(const FString& Parameters)
+{
+    // Unknown wire strings map to the same defaults the old per-service
+    // converters used
+
+    TestEqual("Unknown event falls back", FAGLWireNames::StringToEventType(TEXT("player.unheard_of")), EAGLEventType::Victory);
+    TestEqual("Unknown emotion falls back", FAGLWireNames::StringToEmotionType(TEXT("melancholic")), EAGLEmotionType::Neutral);
+    TestEqual("Unknown persona falls back", FAGLWireNames::StringToPersona(TEXT("grumpy")), EAGLPersona::Cheerful);
+    TestEqual("Unknown memory type falls back", FAGLWireNames::StringToMemoryType(TEXT("daydream")), EAGLMemoryType::Event);
+    TestEqual("Empty string falls back", FAGLWireNames::StringToEmotionType(FString()), EAGLEmotionType::Neutral);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,126 @@
+/**
+ * AGL Vision Base64 - Unreal Engine Plugin
+ *
+ * Implementation file for the vectorized Base64 encoder
+ *
+ * Place in: [YourProject]/Plugins/AGLVision/Source/AGLVision/Private/
+ *
+ * @author AGL Team
+ * @version 0.1.0
+ */
+
+#include "AGLVisionBase64.h"
+
+#if defined(__SSSE3__) || defined(__AVX__) || (defined(PLATFORM_ALWAYS_HAS_SSE4_1) && PLATFORM_ALWAYS_HAS_SSE4_1)
+	#define AGLVISION_BASE64_SSSE3 1
+	#include <tmmintrin.h>
+#elif defined(__aarch64__) || defined(_M_ARM64)
+	#define AGLVISION_BASE64_NEON 1
+	#include <arm_neon.h>
+#endif
+
+static const ANSICHAR GBase64Alphabet[65] =
+	"ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+int32 FAGLVisionBase64::Encode(const uint8* Source, int32 NumBytes, ANSICHAR* Dest)
+{
+	int32 Position = 0;
+	ANSICHAR* Out = Dest;
+
+#if AGLVISION_BASE64_SSSE3
+	// Process 12 input bytes to 16 output chars per iteration; each load
+	// reads 16 bytes so stop while a full load is still in bounds
+	while (NumBytes - Position >= 16)
+	{
+		__m128i In = _mm_loadu_si128(reinterpret_cast<const __m128i*>(Source + Position));
+
+		// Spread the four 3-byte triples into 32-bit lanes
+		const __m128i Shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+		In = _mm_shuffle_epi8(In, Shuffle);
+
+		// Isolate the four 6-bit indices per lane
+		const __m128i T0 = _mm_and_si128(In, _mm_set1_epi32(0x0fc0fc00));
+		const __m128i T1 = _mm_mulhi_epu16(T0, _mm_set1_epi32(0x04000040));
+		const __m128i T2 = _mm_and_si128(In, _mm_set1_epi32(0x003f03f0));
+		const __m128i T3 = _mm_mullo_epi16(T2, _mm_set1_epi32(0x01000010));
+		const __m128i Indices = _mm_or_si128(T1, T3);
+
+		// Map indices 0-63 to ASCII by adding a per-range offset
+		__m128i Offsets = _mm_subs_epu8(Indices, _mm_set1_epi8(51));
+		const __m128i Less = _mm_cmpgt_epi8(_mm_set1_epi8(26), Indices);
+		Offsets = _mm_or_si128(Offsets, _mm_and_si128(Less, _mm_set1_epi8(13)));
+
+		const __m128i ShiftLUT = _mm_setr_epi8(
+			'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+			'0' - 52, '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63,
+			'A', 0, 0, 0);
+		const __m128i Ascii = _mm_add_epi8(_mm_shuffle_epi8(ShiftLUT, Offsets), Indices);
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(Out), Ascii);
+		Position += 12;
+		Out += 16;
+	}
+#elif AGLVISION_BASE64_NEON
+	// Process 48 input bytes to 64 output chars per iteration using a
+	// deinterleaving load and a full-alphabet table lookup
+	uint8x16x4_t AlphabetTable;
+	AlphabetTable.val[0] = vld1q_u8(reinterpret_cast<const uint8*>(GBase64Alphabet));
+	AlphabetTable.val[1] = vld1q_u8(reinterpret_cast<const uint8*>(GBase64Alphabet + 16));
+	AlphabetTable.val[2] = vld1q_u8(reinterpret_cast<const uint8*>(GBase64Alphabet + 32));
+	AlphabetTable.val[3] = vld1q_u8(reinterpret_cast<const uint8*>(GBase64Alphabet + 48));
+
+	while (NumBytes - Position >= 48)
+	{
+		const uint8x16x3_t In = vld3q_u8(Source + Position);
+
+		uint8x16x4_t Indices;
+		Indices.val[0] = vshrq_n_u8(In.val[0], 2);
+		Indices.val[1] = vorrq_u8(vshlq_n_u8(vandq_u8(In.val[0], vdupq_n_u8(0x03)), 4), vshrq_n_u8(In.val[1], 4));
+		Indices.val[2] = vorrq_u8(vshlq_n_u8(vandq_u8(In.val[1], vdupq_n_u8(0x0F)), 2), vshrq_n_u8(In.val[2], 6));
+		Indices.val[3] = vandq_u8(In.val[2], vdupq_n_u8(0x3F));
+
+		uint8x16x4_t Ascii;
+		Ascii.val[0] = vqtbl4q_u8(AlphabetTable, Indices.val[0]);
+		Ascii.val[1] = vqtbl4q_u8(AlphabetTable, Indices.val[1]);
+		Ascii.val[2] = vqtbl4q_u8(AlphabetTable, Indices.val[2]);
+		Ascii.val[3] = vqtbl4q_u8(AlphabetTable, Indices.val[3]);
+
+		vst4q_u8(reinterpret_cast<uint8*>(Out), Ascii);
+		Position += 48;
+		Out += 64;
+	}
+#endif
+
+	// Scalar path: remaining whole triples
+	while (NumBytes - Position >= 3)
+	{
+		const uint32 Triple = (Source[Position] << 16) | (Source[Position + 1] << 8) | Source[Position + 2];
+		*Out++ = GBase64Alphabet[(Triple >> 18) & 0x3F];
+		*Out++ = GBase64Alphabet[(Triple >> 12) & 0x3F];
+		*Out++ = GBase64Alphabet[(Triple >> 6) & 0x3F];
+		*Out++ = GBase64Alphabet[Triple & 0x3F];
+		Position += 3;
+	}
+
+	// Tail with padding
+	const int32 Remaining = NumBytes - Position;
+	if (Remaining == 1)
+	{
+		const uint32 Bits = Source[Position] << 16;
+		*Out++ = GBase64Alphabet[(Bits >> 18) & 0x3F];
+		*Out++ = GBase64Alphabet[(Bits >> 12) & 0x3F];
+		*Out++ = '=';
+		*Out++ = '=';
+	}
+	else if (Remaining == 2)
+	{
+		const uint32 Bits = (Source[Position] << 16) | (Source[Position + 1] << 8);
+		*Out++ = GBase64Alphabet[(Bits >> 18) & 0x3F];
+		*Out++ = GBase64Alphabet[(Bits >> 12) & 0x3F];
+		*Out++ = GBase64Alphabet[(Bits >> 6) & 0x3F];
+		*Out++ = '=';
+	}
+
+	*Out = '\0';
+	return (int32)(Out - Dest);
+}
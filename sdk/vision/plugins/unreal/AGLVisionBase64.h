@@ -0,0 +1,46 @@
+/**
+ * AGL Vision Base64 - Unreal Engine Plugin
+ *
+ * Header file for the vectorized Base64 encoder
+ *
+ * Place in: [YourProject]/Plugins/AGLVision/Source/AGLVision/Public/
+ *
+ * @author AGL Team
+ * @version 0.1.0
+ */
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Base64 encoder for capture payloads
+ *
+ * FBase64::Encode is a scalar byte-at-a-time loop and allocates a fresh
+ * FString per call; at one 100-300KB JPEG per second that is a steady
+ * cost in the capture pipeline. This encoder uses SSSE3 or NEON when
+ * available (scalar fallback otherwise) and writes into a caller-owned
+ * buffer so the output allocation can be reused across captures.
+ */
+class FAGLVisionBase64
+{
+public:
+	/**
+	 * Buffer size needed to encode the given byte count,
+	 * including the trailing null terminator
+	 */
+	static int32 GetEncodedSize(int32 NumBytes)
+	{
+		return ((NumBytes + 2) / 3) * 4 + 1;
+	}
+
+	/**
+	 * Encode bytes into a preallocated, null-terminated Base64 string
+	 *
+	 * @param Source Input bytes
+	 * @param NumBytes Input byte count
+	 * @param Dest Output buffer of at least GetEncodedSize(NumBytes) chars
+	 * @return Number of characters written, excluding the null terminator
+	 */
+	static int32 Encode(const uint8* Source, int32 NumBytes, ANSICHAR* Dest);
+};
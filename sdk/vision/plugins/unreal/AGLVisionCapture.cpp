@@ -10,6 +10,7 @@
  */
 
 #include "AGLVisionCapture.h"
+#include "AGLVisionBase64.h"
 #include "Engine/GameViewportClient.h"
 #include "Engine/World.h"
 #include "TimerManager.h"
@@ -18,6 +19,13 @@
 #include "IImageWrapper.h"
 #include "IImageWrapperModule.h"
 #include "Modules/ModuleManager.h"
+#include "RenderingThread.h"
+#include "RHICommandList.h"
+#include "RHIGPUReadback.h"
+#include "Async/Async.h"
+#include "HttpModule.h"
+#include "Interfaces/IHttpRequest.h"
+#include "Interfaces/IHttpResponse.h"
 
 // HTML5 (WebAssembly) JavaScript interop
 #if PLATFORM_HTML5
@@ -71,6 +79,10 @@ void AAGLVisionCapture::BeginPlay()
 void AAGLVisionCapture::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	StopCapture();
+
+	// Drop any in-flight readback before the render target goes away
+	PendingReadback.Reset();
+
 	CleanupRenderTarget();
 
 	Super::EndPlay(EndPlayReason);
@@ -80,12 +92,23 @@ void AAGLVisionCapture::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	// Pick up the previous frame's readback once its fence has passed
+	PollReadback();
+
+	// Scene captures matter least during frenetic combat — exactly when
+	// frames are most expensive — so shed capture load before it lands
+	// on an already GPU-bound frame
+	if (bAdaptiveCapture)
+	{
+		UpdateAdaptiveController(DeltaTime);
+	}
+
 	// Manual timing (alternative to timer for more control)
 	if (bIsCapturing)
 	{
 		TimeAccumulator += DeltaTime;
 
-		if (TimeAccumulator >= CaptureInterval)
+		if (TimeAccumulator >= GetEffectiveCaptureInterval())
 		{
 			TimeAccumulator = 0.0f;
 			PerformCapture();
@@ -93,6 +116,60 @@ void AAGLVisionCapture::Tick(float DeltaTime)
 	}
 }
 
+void AAGLVisionCapture::UpdateAdaptiveController(float DeltaTime)
+{
+	// Exponential moving average over roughly the last ten frames, so a
+	// single hitch does not whipsaw the controller
+	const float FrameTimeMs = DeltaTime * 1000.0f;
+	SmoothedFrameTimeMs = FMath::Lerp(SmoothedFrameTimeMs, FrameTimeMs, 0.1f);
+
+	// Frame-time pressure: zero at the budget, saturating at 1.5x over it
+	float TargetLoad = (SmoothedFrameTimeMs - AdaptiveFrameBudgetMs) / (AdaptiveFrameBudgetMs * 0.5f);
+
+	// A saturated encode or upload pipeline means frames are already
+	// backing up; shed fully regardless of frame time
+	if (EncodeJobsInFlight.GetValue() >= MaxPendingEncodes || UploadsInFlight.GetValue() >= MaxPendingUploads)
+	{
+		TargetLoad = 1.0f;
+	}
+
+	TargetLoad = FMath::Clamp(TargetLoad, 0.0f, 1.0f);
+
+	// Fast attack, slow release: back off within a couple of frames when a
+	// heavy scene arrives, restore over seconds so the controller does not
+	// oscillate around the budget
+	const float InterpRate = (TargetLoad > CaptureLoadFactor) ? 4.0f : 0.25f;
+	const float PreviousLoad = CaptureLoadFactor;
+	CaptureLoadFactor = FMath::FInterpConstantTo(CaptureLoadFactor, TargetLoad, DeltaTime, InterpRate);
+
+	if (bEnableDebug && FMath::FloorToInt(PreviousLoad * 4.0f) != FMath::FloorToInt(CaptureLoadFactor * 4.0f))
+	{
+		UE_LOG(LogTemp, Log, TEXT("[AGLVision] Load factor %.2f (frame %.1fms, interval %.2fs, quality %d)"),
+			CaptureLoadFactor, SmoothedFrameTimeMs, GetEffectiveCaptureInterval(), GetEffectiveJPEGQuality());
+	}
+}
+
+float AAGLVisionCapture::GetEffectiveCaptureInterval() const
+{
+	if (!bAdaptiveCapture)
+	{
+		return CaptureInterval;
+	}
+
+	return FMath::Lerp(CaptureInterval, FMath::Max(CaptureInterval, MaxCaptureInterval), CaptureLoadFactor);
+}
+
+int32 AAGLVisionCapture::GetEffectiveJPEGQuality() const
+{
+	if (!bAdaptiveCapture)
+	{
+		return JPEGQuality;
+	}
+
+	const float FloorQuality = (float)FMath::Min(MinJPEGQuality, JPEGQuality);
+	return FMath::RoundToInt(FMath::Lerp((float)JPEGQuality, FloorQuality, CaptureLoadFactor));
+}
+
 void AAGLVisionCapture::StartCapture()
 {
 	if (bIsCapturing)
@@ -135,17 +212,84 @@ void AAGLVisionCapture::InitializeRenderTarget()
 	if (!RenderTarget)
 	{
 		RenderTarget = NewObject<UTextureRenderTarget2D>(this);
+		RenderTarget->bAutoGenerateMips = bDownscaleOnGPU;
 		RenderTarget->InitAutoFormat(CaptureWidth, CaptureHeight);
 		RenderTarget->UpdateResourceImmediate(true);
 
+		// Walk the mip chain until the readback fits MaxReadbackSize; the
+		// vision models are fed ~512-768px images regardless, so reading
+		// the full 1080p target back is wasted bandwidth and encode time
+		DownscaleMipLevel = 0;
+		ReadbackWidth = CaptureWidth;
+		ReadbackHeight = CaptureHeight;
+		if (bDownscaleOnGPU)
+		{
+			while (ReadbackWidth > MaxReadbackSize || ReadbackHeight > MaxReadbackSize)
+			{
+				ReadbackWidth = FMath::Max(1, ReadbackWidth / 2);
+				ReadbackHeight = FMath::Max(1, ReadbackHeight / 2);
+				DownscaleMipLevel++;
+			}
+
+			if (DownscaleMipLevel > 0)
+			{
+				DownscaleTarget = NewObject<UTextureRenderTarget2D>(this);
+				DownscaleTarget->InitAutoFormat(ReadbackWidth, ReadbackHeight);
+				DownscaleTarget->UpdateResourceImmediate(true);
+			}
+		}
+
+		// Size the buffer pool once: one set per encode job in flight plus
+		// one for the readback being resolved. Base64 capacity assumes the
+		// JPEG stays under the raw pixel byte count, which holds in practice;
+		// the buffer grows once if a frame ever exceeds it.
+		{
+			FScopeLock Lock(&BufferPoolLock);
+			FreeBuffers.Reset();
+			for (int32 Index = 0; Index < MaxPendingEncodes + 1; ++Index)
+			{
+				TSharedPtr<FAGLVisionCaptureBuffers> Buffers = MakeShared<FAGLVisionCaptureBuffers>();
+				Buffers->Pixels.Reserve(ReadbackWidth * ReadbackHeight);
+				Buffers->Jpeg.Reserve(ReadbackWidth * ReadbackHeight);
+				Buffers->Base64.Reserve(FAGLVisionBase64::GetEncodedSize(ReadbackWidth * ReadbackHeight));
+				FreeBuffers.Add(MoveTemp(Buffers));
+			}
+		}
+
 		if (bEnableDebug)
 		{
-			UE_LOG(LogTemp, Log, TEXT("[AGLVision] Created render target %dx%d"),
-				CaptureWidth, CaptureHeight);
+			UE_LOG(LogTemp, Log, TEXT("[AGLVision] Created render target %dx%d (readback %dx%d, mip %d)"),
+				CaptureWidth, CaptureHeight, ReadbackWidth, ReadbackHeight, DownscaleMipLevel);
 		}
 	}
 }
 
+TSharedPtr<FAGLVisionCaptureBuffers> AAGLVisionCapture::AcquireCaptureBuffers()
+{
+	FScopeLock Lock(&BufferPoolLock);
+	if (FreeBuffers.Num() > 0)
+	{
+		return FreeBuffers.Pop(/*bAllowShrinking*/ false);
+	}
+	return MakeShared<FAGLVisionCaptureBuffers>();
+}
+
+void AAGLVisionCapture::ReleaseCaptureBuffers(TSharedPtr<FAGLVisionCaptureBuffers> Buffers)
+{
+	if (!Buffers.IsValid())
+	{
+		return;
+	}
+
+	// Reset lengths but keep the allocations for the next capture
+	Buffers->Pixels.Reset();
+	Buffers->Jpeg.Reset();
+	Buffers->Base64.Reset();
+
+	FScopeLock Lock(&BufferPoolLock);
+	FreeBuffers.Add(MoveTemp(Buffers));
+}
+
 void AAGLVisionCapture::CleanupRenderTarget()
 {
 	if (RenderTarget)
@@ -153,6 +297,12 @@ void AAGLVisionCapture::CleanupRenderTarget()
 		RenderTarget->ConditionalBeginDestroy();
 		RenderTarget = nullptr;
 	}
+
+	if (DownscaleTarget)
+	{
+		DownscaleTarget->ConditionalBeginDestroy();
+		DownscaleTarget = nullptr;
+	}
 }
 
 void AAGLVisionCapture::PerformCapture()
@@ -177,7 +327,24 @@ void AAGLVisionCapture::PerformCapture()
 		return;
 	}
 
-	// Capture viewport to render target
+	// A blocking ReadPixels here flushes the rendering pipeline and costs
+	// 8-20ms on the game thread; enqueue an asynchronous copy instead and
+	// pick the pixels up a frame or two later in PollReadback
+	BeginReadback();
+}
+
+void AAGLVisionCapture::BeginReadback()
+{
+	if (PendingReadback.IsValid())
+	{
+		// Previous readback still in flight; skip this capture
+		if (bEnableDebug)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[AGLVision] Readback still in flight, skipping capture"));
+		}
+		return;
+	}
+
 	FTextureRenderTargetResource* RenderTargetResource = RenderTarget->GameThread_GetRenderTargetResource();
 	if (!RenderTargetResource)
 	{
@@ -185,53 +352,341 @@ void AAGLVisionCapture::PerformCapture()
 		return;
 	}
 
-	// Read pixels from render target
-	TArray<FColor> OutBMP;
-	if (!RenderTargetResource->ReadPixels(OutBMP))
+	TSharedPtr<FRHIGPUTextureReadback> Readback = MakeShared<FRHIGPUTextureReadback>(TEXT("AGLVisionReadback"));
+	PendingReadback = Readback;
+
+	// With GPU downscale the chosen mip is copied into the small target
+	// and only that is read back (~10x less bandwidth at 1080p)
+	FTextureRenderTargetResource* DownscaleResource =
+		(DownscaleMipLevel > 0 && DownscaleTarget) ? DownscaleTarget->GameThread_GetRenderTargetResource() : nullptr;
+	const int32 MipLevel = DownscaleMipLevel;
+	const FIntVector MipSize(ReadbackWidth, ReadbackHeight, 1);
+
+	ENQUEUE_RENDER_COMMAND(AGLVisionEnqueueReadback)(
+		[Readback, RenderTargetResource, DownscaleResource, MipLevel, MipSize](FRHICommandListImmediate& RHICmdList)
+		{
+			FRHITexture* Texture = RenderTargetResource->GetRenderTargetTexture();
+			if (!Texture)
+			{
+				return;
+			}
+
+			if (DownscaleResource)
+			{
+				FRHITexture* SmallTexture = DownscaleResource->GetRenderTargetTexture();
+				if (SmallTexture)
+				{
+					FRHICopyTextureInfo CopyInfo;
+					CopyInfo.SourceMipIndex = MipLevel;
+					CopyInfo.Size = MipSize;
+					RHICmdList.CopyTexture(Texture, SmallTexture, CopyInfo);
+					Texture = SmallTexture;
+				}
+			}
+
+			Readback->EnqueueCopy(RHICmdList, Texture);
+		});
+}
+
+void AAGLVisionCapture::PollReadback()
+{
+	if (!PendingReadback.IsValid() || !PendingReadback->IsReady())
 	{
-		UE_LOG(LogTemp, Error, TEXT("[AGLVision] Failed to read pixels from render target"));
 		return;
 	}
 
-	// Convert to JPEG
-	TArray<uint8> CompressedData;
-	IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
-	TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::JPEG);
+	TSharedPtr<FRHIGPUTextureReadback> Readback = PendingReadback;
+	PendingReadback.Reset();
+
+	const int32 Width = ReadbackWidth;
+	const int32 Height = ReadbackHeight;
+	TWeakObjectPtr<AAGLVisionCapture> WeakThis(this);
+
+	// Pooled buffer set rides through the whole pipeline and returns to
+	// the pool after the send, so steady-state capture is allocation-free
+	TSharedPtr<FAGLVisionCaptureBuffers> Buffers = AcquireCaptureBuffers();
 
-	if (ImageWrapper.IsValid() && ImageWrapper->SetRaw(OutBMP.GetData(), OutBMP.Num() * sizeof(FColor), CaptureWidth, CaptureHeight, ERGBFormat::BGRA, 8))
+	// Lock must happen on the render thread; copy the rows out there and
+	// hand the buffer back to the game thread for compression
+	ENQUEUE_RENDER_COMMAND(AGLVisionResolveReadback)(
+		[Readback, Buffers, Width, Height, WeakThis](FRHICommandListImmediate& RHICmdList)
+		{
+			int32 RowPitchInPixels = 0;
+			void* Data = Readback->Lock(RowPitchInPixels);
+			if (Data)
+			{
+				Buffers->Pixels.SetNumUninitialized(Width * Height);
+				const FColor* Source = static_cast<const FColor*>(Data);
+				for (int32 Row = 0; Row < Height; ++Row)
+				{
+					FMemory::Memcpy(
+						Buffers->Pixels.GetData() + Row * Width,
+						Source + Row * RowPitchInPixels,
+						Width * sizeof(FColor));
+				}
+				Readback->Unlock();
+			}
+
+			AsyncTask(ENamedThreads::GameThread,
+				[WeakThis, Buffers, Width, Height]()
+				{
+					if (!WeakThis.IsValid())
+					{
+						return;
+					}
+
+					if (Buffers->Pixels.Num() > 0)
+					{
+						WeakThis->CompressAndSend(Buffers, Width, Height);
+					}
+					else
+					{
+						WeakThis->ReleaseCaptureBuffers(Buffers);
+					}
+				});
+		});
+}
+
+bool AAGLVisionCapture::PassesChangeDetection(const TArray<FColor>& Pixels, int32 Width, int32 Height)
+{
+	// Downsample to a tiny luminance grid and compare against the last
+	// uploaded frame; static lobby/menu screens score near zero
+	uint8 Grid[ChangeGridSize * ChangeGridSize];
+	for (int32 GridY = 0; GridY < ChangeGridSize; ++GridY)
 	{
-		CompressedData = ImageWrapper->GetCompressed(JPEGQuality);
+		const int32 PixelY = GridY * Height / ChangeGridSize;
+		for (int32 GridX = 0; GridX < ChangeGridSize; ++GridX)
+		{
+			const int32 PixelX = GridX * Width / ChangeGridSize;
+			const FColor& Pixel = Pixels[PixelY * Width + PixelX];
+			Grid[GridY * ChangeGridSize + GridX] =
+				(uint8)((Pixel.R * 299 + Pixel.G * 587 + Pixel.B * 114) / 1000);
+		}
+	}
 
-		if (CompressedData.Num() > 0)
+	bool bChanged = true;
+	if (bHasPreviousGrid)
+	{
+		int32 SumOfAbsoluteDifferences = 0;
+		for (int32 Index = 0; Index < ChangeGridSize * ChangeGridSize; ++Index)
 		{
-			// Convert to Base64
-			FString Base64String = FBase64::Encode(CompressedData);
+			SumOfAbsoluteDifferences += FMath::Abs((int32)Grid[Index] - (int32)PreviousFrameGrid[Index]);
+		}
 
-			// Send to JavaScript
-			SendToJavaScript(Base64String);
+		const float AverageDelta = (float)SumOfAbsoluteDifferences / (ChangeGridSize * ChangeGridSize);
+		bChanged = AverageDelta >= ChangeThreshold;
 
+		if (!bChanged)
+		{
+			const int32 Skipped = SkippedFrames.Increment();
 			if (bEnableDebug)
 			{
-				UE_LOG(LogTemp, Log, TEXT("[AGLVision] Captured %d bytes (%d base64 chars)"),
-					CompressedData.Num(), Base64String.Len());
+				UE_LOG(LogTemp, Log, TEXT("[AGLVision] Frame unchanged (delta %.2f), skipping upload (%d skipped total)"),
+					AverageDelta, Skipped);
 			}
 		}
-		else
+	}
+
+	// Only remember frames that uploaded, so slow fades still trip the
+	// threshold eventually instead of creeping under it
+	if (bChanged)
+	{
+		FMemory::Memcpy(PreviousFrameGrid, Grid, sizeof(Grid));
+		bHasPreviousGrid = true;
+	}
+
+	return bChanged;
+}
+
+void AAGLVisionCapture::CompressAndSend(TSharedPtr<FAGLVisionCaptureBuffers> Buffers, int32 Width, int32 Height)
+{
+	if (bSkipUnchangedFrames && !PassesChangeDetection(Buffers->Pixels, Width, Height))
+	{
+		ReleaseCaptureBuffers(Buffers);
+		return;
+	}
+
+	// Back-pressure: a slow consumer drops frames instead of queueing
+	// ~2MP buffers unboundedly behind it
+	if (EncodeJobsInFlight.GetValue() >= MaxPendingEncodes)
+	{
+		const int32 Dropped = DroppedFrames.Increment();
+		if (bEnableDebug)
 		{
-			UE_LOG(LogTemp, Error, TEXT("[AGLVision] JPEG compression failed"));
+			UE_LOG(LogTemp, Log, TEXT("[AGLVision] Encode pipeline saturated, dropping frame (%d dropped total)"), Dropped);
 		}
+		ReleaseCaptureBuffers(Buffers);
+		return;
 	}
-	else
+
+	// Module loading is not thread-safe; resolve it here before the hop
+	IImageWrapperModule& ImageWrapperModule = FModuleManager::LoadModuleChecked<IImageWrapperModule>(FName("ImageWrapper"));
+
+	EncodeJobsInFlight.Increment();
+
+	const int32 Quality = GetEffectiveJPEGQuality();
+	const bool bDebug = bEnableDebug;
+	TWeakObjectPtr<AAGLVisionCapture> WeakThis(this);
+
+	// JPEG compression of a ~2MP frame costs 10-30ms; run it on a worker
+	// and come back to the game thread only to send
+	Async(EAsyncExecution::TaskGraph,
+		[WeakThis, Buffers, Width, Height, Quality, bDebug, &ImageWrapperModule]()
+		{
+			TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule.CreateImageWrapper(EImageFormat::JPEG);
+
+			if (ImageWrapper.IsValid() && ImageWrapper->SetRaw(Buffers->Pixels.GetData(), Buffers->Pixels.Num() * sizeof(FColor), Width, Height, ERGBFormat::BGRA, 8))
+			{
+				Buffers->Jpeg = ImageWrapper->GetCompressed(Quality);
+			}
+
+			const int32 CompressedSize = Buffers->Jpeg.Num();
+
+#if PLATFORM_HTML5
+			// Only the JavaScript bridge needs Base64; native builds post the
+			// raw JPEG bytes and skip the encode pass and its 33% inflation.
+			// Vectorized encode straight into the pooled ANSI buffer; no
+			// FString round trip before the char* JavaScript boundary
+			if (CompressedSize > 0)
+			{
+				Buffers->Base64.SetNumUninitialized(FAGLVisionBase64::GetEncodedSize(CompressedSize));
+				FAGLVisionBase64::Encode(Buffers->Jpeg.GetData(), CompressedSize, Buffers->Base64.GetData());
+			}
+#endif
+
+			AsyncTask(ENamedThreads::GameThread,
+				[WeakThis, Buffers, CompressedSize, bDebug]()
+				{
+					if (!WeakThis.IsValid())
+					{
+						return;
+					}
+
+					WeakThis->EncodeJobsInFlight.Decrement();
+
+					if (CompressedSize == 0)
+					{
+						UE_LOG(LogTemp, Error, TEXT("[AGLVision] JPEG compression failed"));
+						WeakThis->ReleaseCaptureBuffers(Buffers);
+						return;
+					}
+
+#if PLATFORM_HTML5
+					// Send to JavaScript
+					WeakThis->SendToJavaScript(Buffers->Base64.GetData());
+#else
+					if (WeakThis->bUploadToVisionService)
+					{
+						// The request copies the body, so the pooled buffer is
+						// free to recycle as soon as the POST is bound
+						WeakThis->SendToVisionService(Buffers->Jpeg);
+					}
+					else if (bDebug)
+					{
+						UE_LOG(LogTemp, Warning, TEXT("[AGLVision] Vision service upload disabled and JavaScript interop is HTML5-only, frame discarded"));
+					}
+#endif
+
+					if (bDebug)
+					{
+						UE_LOG(LogTemp, Log, TEXT("[AGLVision] Captured %d bytes"), CompressedSize);
+					}
+
+					WeakThis->ReleaseCaptureBuffers(Buffers);
+				});
+		});
+}
+
+void AAGLVisionCapture::SendToVisionService(const TArray<uint8>& JpegData)
+{
+	// Back-pressure mirrors the encode stage: a slow or unreachable service
+	// drops frames instead of queueing requests unboundedly behind it
+	if (UploadsInFlight.GetValue() >= MaxPendingUploads)
 	{
-		UE_LOG(LogTemp, Error, TEXT("[AGLVision] Image wrapper setup failed"));
+		const int32 Dropped = DroppedFrames.Increment();
+		if (bEnableDebug)
+		{
+			UE_LOG(LogTemp, Log, TEXT("[AGLVision] Upload pipeline saturated, dropping frame (%d dropped total)"), Dropped);
+		}
+		return;
 	}
+
+	// Multipart keeps the JPEG raw on the wire; /analyze/file reads the
+	// part bytes directly, so no Base64 happens on either end. The service
+	// picks the image format from the part's filename extension.
+	const FString Boundary = FString::Printf(TEXT("----AGLVisionBoundary%08x%08x"), FMath::Rand(), FMath::Rand());
+
+	TArray<uint8> Body;
+	Body.Reserve(JpegData.Num() + 1024);
+	auto AppendUtf8 = [&Body](const FString& Text)
+	{
+		FTCHARToUTF8 Converted(*Text);
+		Body.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	};
+	auto AppendField = [&Boundary, &AppendUtf8](const FString& Name, const FString& Value)
+	{
+		AppendUtf8(FString::Printf(TEXT("--%s\r\nContent-Disposition: form-data; name=\"%s\"\r\n\r\n%s\r\n"),
+			*Boundary, *Name, *Value));
+	};
+
+	AppendUtf8(FString::Printf(TEXT("--%s\r\nContent-Disposition: form-data; name=\"file\"; filename=\"frame.jpg\"\r\nContent-Type: image/jpeg\r\n\r\n"),
+		*Boundary));
+	Body.Append(JpegData);
+	AppendUtf8(TEXT("\r\n"));
+	AppendField(TEXT("analysis_type"), AnalysisType);
+	if (!GameName.IsEmpty())
+	{
+		AppendField(TEXT("game_name"), GameName);
+	}
+	if (!PlayerId.IsEmpty())
+	{
+		AppendField(TEXT("player_id"), PlayerId);
+	}
+	AppendUtf8(FString::Printf(TEXT("--%s--\r\n"), *Boundary));
+
+	TSharedRef<IHttpRequest, ESPMode::ThreadSafe> HttpRequest = FHttpModule::Get().CreateRequest();
+	HttpRequest->SetURL(VisionServiceUrl + TEXT("/analyze/file"));
+	HttpRequest->SetVerb(TEXT("POST"));
+	HttpRequest->SetHeader(TEXT("Content-Type"), FString::Printf(TEXT("multipart/form-data; boundary=%s"), *Boundary));
+	HttpRequest->SetContent(MoveTemp(Body));
+
+	UploadsInFlight.Increment();
+
+	TWeakObjectPtr<AAGLVisionCapture> WeakThis(this);
+	HttpRequest->OnProcessRequestComplete().BindLambda(
+		[WeakThis](FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+		{
+			if (!WeakThis.IsValid())
+			{
+				return;
+			}
+
+			WeakThis->UploadsInFlight.Decrement();
+
+			if (!bWasSuccessful || !Response.IsValid())
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[AGLVision] Frame upload failed: no response from vision service"));
+				return;
+			}
+
+			if (Response->GetResponseCode() != 200)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("[AGLVision] Frame upload failed with status %d"), Response->GetResponseCode());
+			}
+			else if (WeakThis->bEnableDebug)
+			{
+				UE_LOG(LogTemp, Log, TEXT("[AGLVision] Frame uploaded to vision service"));
+			}
+		});
+
+	HttpRequest->ProcessRequest();
 }
 
-void AAGLVisionCapture::SendToJavaScript(const FString& Base64Data)
+void AAGLVisionCapture::SendToJavaScript(const ANSICHAR* Base64Data)
 {
 #if PLATFORM_HTML5
 	// Call JavaScript function
-	JS_CaptureScreen(TCHAR_TO_ANSI(*Base64Data));
+	JS_CaptureScreen(Base64Data);
 #else
 	if (bEnableDebug)
 	{
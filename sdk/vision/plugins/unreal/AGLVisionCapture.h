@@ -17,6 +17,26 @@
 #include "ImageUtils.h"
 #include "AGLVisionCapture.generated.h"
 
+class FRHIGPUTextureReadback;
+
+/**
+ * Reusable buffer set for one capture in flight
+ *
+ * Recycled through the actor's pool so steady-state capture does not
+ * reallocate the multi-megabyte pixel and encode buffers every second
+ */
+struct FAGLVisionCaptureBuffers
+{
+	/** Readback pixel buffer */
+	TArray<FColor> Pixels;
+
+	/** Compressed JPEG bytes */
+	TArray<uint8> Jpeg;
+
+	/** Base64 output buffer (null-terminated, HTML5 bridge only) */
+	TArray<ANSICHAR> Base64;
+};
+
 /**
  * Actor that captures viewport screenshots and sends them to JavaScript for vision analysis
  */
@@ -62,6 +82,66 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL Vision|Capture")
 	bool bAutoStart = true;
 
+	/** Encode jobs allowed in flight before new frames are dropped */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL Vision|Capture", meta = (ClampMin = "1", ClampMax = "4"))
+	int32 MaxPendingEncodes = 1;
+
+	/** Downscale on the GPU before readback; the backend resizes to ~512-768px anyway */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL Vision|Capture")
+	bool bDownscaleOnGPU = true;
+
+	/** Largest readback dimension when GPU downscale is enabled */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL Vision|Capture", meta = (ClampMin = "256", ClampMax = "2160"))
+	int32 MaxReadbackSize = 768;
+
+	/** Skip compression and upload when the frame barely changed */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL Vision|Capture")
+	bool bSkipUnchangedFrames = true;
+
+	/** Stretch the interval and lower JPEG quality when frames run over budget */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL Vision|Adaptive")
+	bool bAdaptiveCapture = true;
+
+	/** Smoothed frame time (ms) above which capture load starts shedding */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL Vision|Adaptive", meta = (ClampMin = "8.0", ClampMax = "100.0"))
+	float AdaptiveFrameBudgetMs = 33.3f;
+
+	/** Longest interval the controller may stretch to under load */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL Vision|Adaptive", meta = (ClampMin = "0.1", ClampMax = "30.0"))
+	float MaxCaptureInterval = 4.0f;
+
+	/** Lowest JPEG quality the controller may drop to under load */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL Vision|Adaptive", meta = (ClampMin = "1", ClampMax = "100"))
+	int32 MinJPEGQuality = 40;
+
+	/** POST frames to the vision service on native platforms (HTML5 uses the JS bridge) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL Vision|Upload")
+	bool bUploadToVisionService = true;
+
+	/** Vision service base URL */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL Vision|Upload")
+	FString VisionServiceUrl = TEXT("http://localhost:8007");
+
+	/** Analysis type sent with each frame (full, scene, ui, text) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL Vision|Upload")
+	FString AnalysisType = TEXT("full");
+
+	/** Game name sent with each frame (optional) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL Vision|Upload")
+	FString GameName;
+
+	/** Player ID sent with each frame (optional) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL Vision|Upload")
+	FString PlayerId;
+
+	/** Uploads allowed in flight before new frames are dropped */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL Vision|Upload", meta = (ClampMin = "1", ClampMax = "8"))
+	int32 MaxPendingUploads = 2;
+
+	/** Average per-cell luminance delta (0-255) below which a frame counts as unchanged */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL Vision|Capture", meta = (ClampMin = "0.0", ClampMax = "64.0"))
+	float ChangeThreshold = 4.0f;
+
 	/** Enable debug logging */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AGL Vision|Debug")
 	bool bEnableDebug = false;
@@ -86,6 +166,30 @@ public:
 	UFUNCTION(BlueprintPure, Category = "AGL Vision")
 	bool IsCapturing() const { return bIsCapturing; }
 
+	/** Frames skipped because they matched the previous frame */
+	UFUNCTION(BlueprintPure, Category = "AGL Vision")
+	int32 GetSkippedFrameCount() const { return SkippedFrames.GetValue(); }
+
+	/** Frames dropped because the encode pipeline was saturated */
+	UFUNCTION(BlueprintPure, Category = "AGL Vision")
+	int32 GetDroppedFrameCount() const { return DroppedFrames.GetValue(); }
+
+	/** Current load shed factor: 0 = full rate and quality, 1 = fully shed */
+	UFUNCTION(BlueprintPure, Category = "AGL Vision")
+	float GetCaptureLoadFactor() const { return CaptureLoadFactor; }
+
+	/** Capture interval currently in effect, after adaptive stretching */
+	UFUNCTION(BlueprintPure, Category = "AGL Vision")
+	float GetEffectiveCaptureInterval() const;
+
+	/** JPEG quality currently in effect, after adaptive reduction */
+	UFUNCTION(BlueprintPure, Category = "AGL Vision")
+	int32 GetEffectiveJPEGQuality() const;
+
+	/** Frame uploads currently in flight to the vision service */
+	UFUNCTION(BlueprintPure, Category = "AGL Vision")
+	int32 GetPendingUploadCount() const { return UploadsInFlight.GetValue(); }
+
 	//~ End Public Functions
 
 private:
@@ -93,6 +197,19 @@ private:
 	UPROPERTY(Transient)
 	UTextureRenderTarget2D* RenderTarget;
 
+	/** Small target the chosen mip is copied into before readback */
+	UPROPERTY(Transient)
+	UTextureRenderTarget2D* DownscaleTarget;
+
+	/** Mip level of the capture target sampled for readback */
+	int32 DownscaleMipLevel = 0;
+
+	/** Resolution actually read back and encoded */
+	int32 ReadbackWidth = 0;
+
+	/** Resolution actually read back and encoded */
+	int32 ReadbackHeight = 0;
+
 	/** Timer for automatic capture */
 	FTimerHandle CaptureTimerHandle;
 
@@ -102,11 +219,71 @@ private:
 	/** Accumulator for delta time */
 	float TimeAccumulator;
 
+	/** In-flight GPU readback, polled in Tick (null when idle) */
+	TSharedPtr<FRHIGPUTextureReadback> PendingReadback;
+
+	/** Encode jobs currently running on worker threads */
+	FThreadSafeCounter EncodeJobsInFlight;
+
+	/** Frames dropped because the encode pipeline was saturated */
+	FThreadSafeCounter DroppedFrames;
+
+	/** Frames skipped by change detection */
+	FThreadSafeCounter SkippedFrames;
+
+	/** Frame uploads currently in flight to the vision service */
+	FThreadSafeCounter UploadsInFlight;
+
+	/** Grid cells per side for the perceptual difference stage */
+	static constexpr int32 ChangeGridSize = 16;
+
+	/** Downsampled luminance grid of the last uploaded frame */
+	uint8 PreviousFrameGrid[ChangeGridSize * ChangeGridSize];
+
+	/** Whether PreviousFrameGrid holds a frame yet */
+	bool bHasPreviousGrid = false;
+
+	/** Exponentially smoothed frame time in milliseconds */
+	float SmoothedFrameTimeMs = 16.7f;
+
+	/** Load shed factor driven by frame time and backlog (game thread only) */
+	float CaptureLoadFactor = 0.0f;
+
+	/** Move the load factor toward the current frame-time and backlog pressure */
+	void UpdateAdaptiveController(float DeltaTime);
+
 	/** Perform the actual capture and send to JavaScript */
 	void PerformCapture();
 
-	/** Send base64 data to JavaScript */
-	void SendToJavaScript(const FString& Base64Data);
+	/** Enqueue a non-blocking GPU copy of the render target */
+	void BeginReadback();
+
+	/** Poll the in-flight readback; resolves pixels once the fence passes */
+	void PollReadback();
+
+	/** Free buffer sets ready for reuse */
+	TArray<TSharedPtr<FAGLVisionCaptureBuffers>> FreeBuffers;
+
+	/** Guards FreeBuffers (worker threads release into the pool) */
+	FCriticalSection BufferPoolLock;
+
+	/** Take a buffer set from the pool, or allocate one if empty */
+	TSharedPtr<FAGLVisionCaptureBuffers> AcquireCaptureBuffers();
+
+	/** Return a buffer set to the pool, keeping its capacity */
+	void ReleaseCaptureBuffers(TSharedPtr<FAGLVisionCaptureBuffers> Buffers);
+
+	/** Hand pixels to a worker for JPEG + Base64, dropping frames under back-pressure */
+	void CompressAndSend(TSharedPtr<FAGLVisionCaptureBuffers> Buffers, int32 Width, int32 Height);
+
+	/** Compare against the previous frame's grid; true when the frame should upload */
+	bool PassesChangeDetection(const TArray<FColor>& Pixels, int32 Width, int32 Height);
+
+	/** Send null-terminated base64 data to JavaScript */
+	void SendToJavaScript(const ANSICHAR* Base64Data);
+
+	/** POST raw JPEG bytes to the vision service's /analyze/file route */
+	void SendToVisionService(const TArray<uint8>& JpegData);
 
 	/** Initialize render target */
 	void InitializeRenderTarget();
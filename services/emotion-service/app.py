@@ -8,7 +8,13 @@ import os
 from dotenv import load_dotenv
 
 from src.config import settings
-from src.models import EmotionRequest, EmotionResponse, HealthResponse
+from src.models import (
+    BatchEmotionRequest,
+    BatchEmotionResponse,
+    EmotionRequest,
+    EmotionResponse,
+    HealthResponse,
+)
 from src.emotion_service import EmotionService
 from src.cache import emotion_cache
 from src.cost_tracker import cost_manager
@@ -69,6 +75,22 @@ async def analyze_emotion(request: EmotionRequest):
     return response
 
 
+@app.post("/analyze/batch", response_model=BatchEmotionResponse)
+async def analyze_emotion_batch(request: BatchEmotionRequest):
+    """
+    Analyze a batch of game events in one round trip
+
+    Client SDKs coalesce event bursts (raids, boss fights) into a single
+    request instead of one POST per event. Events are analyzed in order
+    and the results array matches the submitted order, so clients can fan
+    results back out by index.
+    """
+    results = []
+    for event in request.events:
+        results.append(await emotion_service.analyze_emotion(event))
+    return BatchEmotionResponse(results=results)
+
+
 @app.get("/stats")
 async def get_stats():
     """Get service statistics"""
@@ -2,7 +2,7 @@
 Data models for Emotion Service
 """
 from pydantic import BaseModel, Field
-from typing import Dict, Any, Optional
+from typing import Dict, Any, List, Optional
 from enum import Enum
 
 
@@ -70,6 +70,16 @@ class EmotionResponse(BaseModel):
     }
 
 
+class BatchEmotionRequest(BaseModel):
+    """Batched emotion analysis requests from the SDK event batcher"""
+    events: List[EmotionRequest] = Field(..., description="Events to analyze, in order")
+
+
+class BatchEmotionResponse(BaseModel):
+    """Batched emotion analysis results, ordered to match the request"""
+    results: List[EmotionResponse] = Field(..., description="Per-event results")
+
+
 class HealthResponse(BaseModel):
     """Health check response"""
     status: str
@@ -123,6 +123,31 @@ class TestAPI:
             result = response.json()
             assert result["emotion"] == expected_emotion
 
+    def test_analyze_batch(self, client):
+        """Test batched emotion analysis"""
+        request_data = {
+            "events": [
+                {"type": "player.victory", "data": {}, "context": {}},
+                {"type": "player.defeat", "data": {}, "context": {}}
+            ]
+        }
+
+        response = client.post("/analyze/batch", json=request_data)
+
+        assert response.status_code == 200
+        data = response.json()
+        assert len(data["results"]) == 2
+        # Results come back in the submitted order
+        assert data["results"][0]["emotion"] == "happy"
+        assert data["results"][1]["emotion"] == "sad"
+
+    def test_analyze_batch_empty(self, client):
+        """Test batch endpoint with no events"""
+        response = client.post("/analyze/batch", json={"events": []})
+
+        assert response.status_code == 200
+        assert response.json()["results"] == []
+
     def test_stats_endpoint(self, client):
         """Test stats endpoint"""
         response = client.get("/stats")
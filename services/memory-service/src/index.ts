@@ -94,6 +94,43 @@ app.post('/players/:playerId/memories', async (req: Request, res: Response) => {
   }
 });
 
+// Create multiple memories in one request (SDK write-behind queue)
+app.post('/players/:playerId/memories/bulk', async (req: Request, res: Response) => {
+  try {
+    const { playerId } = req.params;
+    const { memories } = req.body;
+
+    if (!Array.isArray(memories) || memories.length === 0) {
+      return res.status(400).json({ error: 'Memories array is required' });
+    }
+
+    for (const item of memories) {
+      if (!item || !item.type || !item.content) {
+        return res.status(400).json({ error: 'Each memory requires type and content' });
+      }
+    }
+
+    // Created sequentially so the response array matches the submitted order
+    const created = [];
+    for (const item of memories) {
+      const { type, content, emotion, context } = item;
+      created.push(
+        await memoryService.createMemory(playerId, {
+          type,
+          content,
+          emotion,
+          context,
+        })
+      );
+    }
+
+    res.status(201).json({ memories: created });
+  } catch (error) {
+    console.error('Error creating memories in bulk:', error);
+    res.status(500).json({ error: 'Failed to create memories' });
+  }
+});
+
 // Get contextual memories for dialogue generation
 app.post('/players/:playerId/context', async (req: Request, res: Response) => {
   try {